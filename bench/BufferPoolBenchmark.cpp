@@ -0,0 +1,160 @@
+/**
+ * BufferPoolBenchmark.cpp
+ *
+ * BufferPool under concurrent allocate / deallocate (Treiber stack +
+ * per-thread magazines): throughput and a corruption check
+ *
+ * Setup per run:
+ * - N threads share one pool (1024 × 256 B)
+ * - Each thread holds up to HELD_MAX buffers, allocating 2 of every 3
+ *   steps and freeing otherwise (mix of magazine hits and batch moves)
+ * - An allocated buffer must be zeroed in byte 0; the owner writes its
+ *   tag there and checks it again before freeing it
+ *
+ * Reported per thread count:
+ * - ns per allocate / deallocate, allocation failures
+ * - corrupted buffers (tag mismatch = same buffer handed out twice)
+ * - buffers returned after all threads flushed (must equal pool size)
+ *
+ * Exit code 1 on corruption or lost buffers. Build with
+ * -fsanitize=thread to check the stack for data races.
+ *
+ * Usage:
+ *   ./buffer_pool_benchmark [iterations per thread] [threads ...]
+ *   (default: 1000000, 1 2 4 8 threads)
+ */
+
+#include "BufferPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace aeron::example;
+
+namespace {
+
+constexpr size_t POOL_SIZE = 1024;
+constexpr size_t PAYLOAD_SIZE = 256;
+constexpr size_t HELD_MAX = 40;
+
+struct Result {
+    double ns_per_op;
+    uint64_t failures;
+    uint64_t corrupted;
+    size_t returned;
+};
+
+Result run(int threads, int iterations) {
+    BufferPool pool(POOL_SIZE, PAYLOAD_SIZE);
+    std::atomic<uint64_t> corrupted{0};
+    std::atomic<uint64_t> failures{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            const uint8_t tag = static_cast<uint8_t>(t + 1);
+            std::vector<MessageBuffer> held;
+            held.reserve(HELD_MAX);
+
+            for (int i = 0; i < iterations; i++) {
+                if (held.size() < HELD_MAX && i % 3 != 2) {
+                    MessageBuffer buf = pool.allocate();
+                    if (!buf) {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                        continue;
+                    }
+                    if (buf.payload[0] != 0) {
+                        corrupted.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    buf.payload[0] = tag;
+                    held.push_back(buf);
+                } else if (!held.empty()) {
+                    MessageBuffer buf = held.back();
+                    held.pop_back();
+                    if (buf.payload[0] != tag) {
+                        corrupted.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    buf.payload[0] = 0;
+                    pool.deallocate(buf.id);
+                }
+            }
+
+            for (MessageBuffer& buf : held) {
+                buf.payload[0] = 0;
+                pool.deallocate(buf.id);
+            }
+            pool.flushThreadCache();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Every buffer must be back on the shared stack
+    size_t returned = 0;
+    std::vector<MessageBuffer> drained;
+    while (MessageBuffer buf = pool.allocate()) {
+        drained.push_back(buf);
+        returned++;
+    }
+    for (const MessageBuffer& buf : drained) {
+        pool.deallocate(buf.id);
+    }
+    pool.flushThreadCache();
+
+    Result result;
+    result.ns_per_op = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())
+        / (static_cast<double>(threads) * iterations);
+    result.failures = failures.load();
+    result.corrupted = corrupted.load();
+    result.returned = returned;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    std::vector<int> thread_counts;
+    for (int i = 2; i < argc; i++) {
+        thread_counts.push_back(std::atoi(argv[i]));
+    }
+    if (thread_counts.empty()) {
+        thread_counts = {1, 2, 4, 8};
+    }
+
+    std::cout << "BufferPool: " << POOL_SIZE << " × " << PAYLOAD_SIZE << " B, "
+              << iterations << " ops per thread, up to " << HELD_MAX << " held\n" << std::endl;
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(12) << "ns/op"
+              << std::setw(12) << "failures"
+              << std::setw(12) << "corrupted"
+              << "returned" << std::endl;
+
+    bool ok = true;
+    for (int threads : thread_counts) {
+        const Result result = run(threads, iterations);
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(12) << std::fixed << std::setprecision(1) << result.ns_per_op
+                  << std::setw(12) << result.failures
+                  << std::setw(12) << result.corrupted
+                  << result.returned << "/" << POOL_SIZE << std::endl;
+        if (result.corrupted != 0 || result.returned != POOL_SIZE) {
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        std::cerr << "\nFAILED: corrupted or lost buffers" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * ChecksumBenchmark.cpp
+ *
+ * Per-message checksum cost: old byte-table CRC32 vs. Checksum.h
+ *
+ * - byte table CRC32   : previous calculateMessageCRC32 (header copy +
+ *                        1 table lookup per byte)
+ * - slicing-by-8 CRC32 : calculateMessageCRC32 now (same wire value)
+ * - slicing-by-8 CRC32C: software fallback of crc32c()
+ * - dispatched CRC32C  : calculateMessageChecksum(CRC32C) (SSE4.2 if present)
+ *
+ * Also checks the standard "123456789" check values and that both
+ * CRC32C implementations agree.
+ *
+ * Usage:
+ *   ./checksum_benchmark [iterations]   (default: 1,000,000)
+ */
+
+#include "MessageBuffer.h"
+#include "Checksum.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace aeron::example;
+
+namespace {
+
+volatile uint32_t g_sink = 0;
+
+// Previous implementation (kept here only as the baseline)
+uint32_t byteTableMessageCRC32(const MessageHeader* header, const uint8_t* payload, uint32_t payload_length) {
+    static uint32_t table[256];
+    static bool initialized = false;
+    if (!initialized) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+            }
+            table[i] = crc;
+        }
+        initialized = true;
+    }
+
+    MessageHeader temp_header;
+    memcpy(&temp_header, header, sizeof(MessageHeader));
+    temp_header.checksum = 0;
+
+    uint32_t crc = 0xFFFFFFFF;
+    const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(&temp_header);
+    for (size_t i = 0; i < sizeof(MessageHeader); ++i) {
+        crc = (crc >> 8) ^ table[(crc ^ header_bytes[i]) & 0xFF];
+    }
+    for (size_t i = 0; i < payload_length; ++i) {
+        crc = (crc >> 8) ^ table[(crc ^ payload[i]) & 0xFF];
+    }
+    return ~crc;
+}
+
+template<typename Fn>
+double measure(const char* label, int64_t iterations, size_t bytes, Fn&& fn) {
+    // Warm-up
+    for (int64_t i = 0; i < iterations / 10; i++) {
+        g_sink = g_sink + fn();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < iterations; i++) {
+        g_sink = g_sink + fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ns_per_call =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(iterations);
+
+    std::cout << "  " << std::left << std::setw(24) << label
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << ns_per_call << " ns/msg"
+              << std::setw(10) << std::setprecision(2)
+              << static_cast<double>(bytes) / ns_per_call << " GB/s" << std::endl;
+    return ns_per_call;
+}
+
+bool checkValues() {
+    const char* check = "123456789";
+    const uint32_t crc32 = checksum::crc32(0, check, 9);
+    const uint32_t crc32c = checksum::crc32c(0, check, 9);
+    const uint32_t crc32c_sw = checksum::crc32cSoftware(0, check, 9);
+
+    std::cout << std::hex << std::setfill('0')
+              << "  crc32(\"123456789\")  = 0x" << std::setw(8) << crc32 << " (expected 0xcbf43926)\n"
+              << "  crc32c(\"123456789\") = 0x" << std::setw(8) << crc32c << " (expected 0xe3069283)"
+              << std::dec << std::setfill(' ') << std::endl;
+
+    // Chaining + every length / alignment against the fallback
+    std::vector<uint8_t> data(1024);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    bool agree = true;
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t length = 0; length + offset <= 300; length++) {
+            const uint32_t whole = checksum::crc32c(0, data.data() + offset, length);
+            const uint32_t split = checksum::crc32c(
+                checksum::crc32c(0, data.data() + offset, length / 3),
+                data.data() + offset + length / 3, length - length / 3);
+            agree = agree && whole == split &&
+                    whole == checksum::crc32cSoftware(0, data.data() + offset, length);
+        }
+    }
+    std::cout << "  crc32c " << checksum::crc32cImplementation() << " vs slicing-by-8: "
+              << (agree ? "match" : "MISMATCH") << std::endl;
+
+    return crc32 == 0xCBF43926 && crc32c == 0xE3069283 && crc32c_sw == 0xE3069283 && agree;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int64_t iterations = argc > 1 ? std::atoll(argv[1]) : 1'000'000;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Message Checksum Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "CRC32C implementation: " << checksum::crc32cImplementation() << std::endl;
+    std::cout << "\nCheck values:" << std::endl;
+    if (!checkValues()) {
+        std::cerr << "ERROR: checksum check values failed" << std::endl;
+        return 1;
+    }
+
+    std::vector<uint8_t> message(sizeof(MessageHeader) + 4096);
+    for (size_t i = 0; i < message.size(); i++) {
+        message[i] = static_cast<uint8_t>(i * 31 + 1);
+    }
+    MessageHeader* header = reinterpret_cast<MessageHeader*>(message.data());
+    const uint8_t* payload = message.data() + sizeof(MessageHeader);
+    header->recv_time_ns = 0;   // As sent (filled by the subscriber, counted as zero)
+
+    if (byteTableMessageCRC32(header, payload, 4096) != calculateMessageCRC32(header, payload, 4096)) {
+        std::cerr << "ERROR: CRC32 wire value changed" << std::endl;
+        return 1;
+    }
+
+    for (uint32_t payload_length : {32u, 256u, 4096u}) {
+        const size_t bytes = sizeof(MessageHeader) + payload_length;
+        std::cout << "\n64 B header + " << payload_length << " B payload:" << std::endl;
+
+        const double baseline = measure("byte table CRC32", iterations, bytes, [&]() {
+            return byteTableMessageCRC32(header, payload, payload_length);
+        });
+        measure("slicing-by-8 CRC32", iterations, bytes, [&]() {
+            return calculateMessageCRC32(header, payload, payload_length);
+        });
+        measure("slicing-by-8 CRC32C", iterations, bytes, [&]() {
+            const uint8_t* bytes_ptr = reinterpret_cast<const uint8_t*>(header);
+            return checksum::crc32cSoftware(checksum::crc32cSoftware(0, bytes_ptr, sizeof(MessageHeader)),
+                                            payload, payload_length);
+        });
+        const double dispatched = measure("dispatched CRC32C", iterations, bytes, [&]() {
+            return calculateMessageChecksum(ChecksumType::CRC32C, header, payload, payload_length);
+        });
+        std::cout << "  → " << std::setprecision(1) << baseline / dispatched
+                  << "x faster than byte table" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * ClockBenchmark.cpp
+ *
+ * Hot path timestamp cost: current calls vs. NanoClock
+ *
+ * - clock_gettime(CLOCK_REALTIME)  : MessageBuffer.h getCurrentTimeNanos()
+ * - system_clock::now()            : old AeronSubscriber / CheckpointManager
+ * - NanoClock::nanoTime() fallback : before start() (vDSO)
+ * - NanoClock::nanoTime() TSC      : after start()
+ * - raw rdtsc                      : lower bound
+ *
+ * Also reports |NanoClock - CLOCK_REALTIME| over a few recalibrations.
+ *
+ * Usage:
+ *   ./clock_benchmark [iterations]   (default: 10,000,000)
+ */
+
+#include "NanoClock.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+using namespace aeron::example;
+
+namespace {
+
+volatile int64_t g_sink = 0;
+
+template<typename Fn>
+double measure(const char* label, int64_t iterations, Fn&& fn) {
+    // Warm-up
+    for (int64_t i = 0; i < iterations / 10; i++) {
+        g_sink = g_sink + fn();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < iterations; i++) {
+        g_sink = g_sink + fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ns_per_call =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(iterations);
+
+    std::cout << "  " << std::left << std::setw(36) << label
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(8) << ns_per_call << " ns/call" << std::endl;
+    return ns_per_call;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int64_t iterations = argc > 1 ? std::atoll(argv[1]) : 10'000'000;
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Clock Benchmark (" << iterations << " calls each)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Invariant TSC: " << (NanoClock::isTscInvariant() ? "yes" : "no") << std::endl;
+
+    measure("clock_gettime(CLOCK_REALTIME)", iterations, []() {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        return static_cast<int64_t>(ts.tv_nsec);
+    });
+
+    measure("clock_gettime(CLOCK_MONOTONIC)", iterations, []() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<int64_t>(ts.tv_nsec);
+    });
+
+    measure("std::chrono::system_clock::now()", iterations, []() {
+        return static_cast<int64_t>(
+            std::chrono::system_clock::now().time_since_epoch().count());
+    });
+
+    measure("NanoClock::nanoTime() [fallback]", iterations, []() {
+        return NanoClock::nanoTime();
+    });
+
+    NanoClockConfig config;
+    config.calibration_interval_ms = 200;
+    const bool tsc = NanoClock::start(config);
+
+    if (tsc) {
+        measure("NanoClock::nanoTime() [tsc]", iterations, []() {
+            return NanoClock::nanoTime();
+        });
+
+#if AERON_EXAMPLE_HAS_TSC
+        measure("__rdtsc() (lower bound)", iterations, []() {
+            return static_cast<int64_t>(__rdtsc());
+        });
+#endif
+
+        // Accuracy against CLOCK_REALTIME across recalibrations
+        int64_t max_error = 0;
+        int64_t sum_error = 0;
+        int samples = 0;
+        const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < until) {
+            const int64_t a = NanoClock::realtimeNanos();
+            const int64_t t = NanoClock::nanoTime();
+            const int64_t b = NanoClock::realtimeNanos();
+            const int64_t mid = a + (b - a) / 2;
+            const int64_t error = std::llabs(t - mid);
+            max_error = std::max(max_error, error);
+            sum_error += error;
+            samples++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        std::cout << "\nAccuracy vs CLOCK_REALTIME (" << samples << " samples, 2 s):" << std::endl;
+        std::cout << "  avg |error|: " << (samples > 0 ? sum_error / samples : 0) << " ns" << std::endl;
+        std::cout << "  max |error|: " << max_error << " ns" << std::endl;
+
+        NanoClock::printStatistics();
+    } else {
+        std::cout << "\nTSC path inactive - NanoClock uses CLOCK_REALTIME" << std::endl;
+    }
+
+    NanoClock::stop();
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * DedupBenchmark.cpp
+ *
+ * Worker duplicate detection: unordered_set (old) vs. DedupTable
+ *
+ * Workload per run:
+ * - Two sources (publisher/session), interleaved in-order sequences
+ * - Every 97th message re-sends a sequence 500 behind (duplicate)
+ * - Every 1009th message arrives 3 late (out-of-order, not a duplicate)
+ *
+ * Reported per structure:
+ * - ns/message, worst 1024-message burst (clear() spike)
+ * - duplicates caught vs. injected, false positives
+ * - approximate memory
+ *
+ * Usage:
+ *   ./dedup_benchmark [messages ...]   (default: 1000000 10000000 100000000)
+ */
+
+#include "DedupTable.h"
+#include "AeronConfig.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <unordered_set>
+#include <vector>
+
+using namespace aeron::example;
+
+namespace {
+
+struct Result {
+    double ns_per_msg;
+    double worst_burst_us;
+    uint64_t duplicates;
+    uint64_t false_positives;
+    size_t memory_bytes;
+};
+
+struct Message {
+    uint16_t publisher_id;
+    uint64_t session_id;
+    int64_t sequence;
+    bool duplicate;
+};
+
+// Deterministic stream of messages (generated on the fly, no 100M array)
+class Workload {
+public:
+    explicit Workload(uint64_t count) : count_(count) {}
+
+    bool next(Message& msg) {
+        if (emitted_ >= count_) {
+            return false;
+        }
+        emitted_++;
+
+        const int source = static_cast<int>(emitted_ & 1);
+        msg.publisher_id = static_cast<uint16_t>(source + 1);
+        msg.session_id = 1000 + source;
+        msg.duplicate = false;
+
+        if (emitted_ % 97 == 0 && next_[source] > 500) {
+            msg.sequence = next_[source] - 500;
+            msg.duplicate = true;
+            injected_++;
+            return true;
+        }
+
+        if (emitted_ % 1009 == 0) {
+            // Hold one sequence back, deliver it three messages later
+            held_[source] = next_[source]++;
+            hold_countdown_[source] = 3;
+        } else if (hold_countdown_[source] > 0 && --hold_countdown_[source] == 0) {
+            msg.sequence = held_[source];
+            return true;
+        }
+
+        msg.sequence = next_[source]++;
+        return true;
+    }
+
+    uint64_t injected() const { return injected_; }
+
+private:
+    uint64_t count_;
+    uint64_t emitted_ = 0;
+    uint64_t injected_ = 0;
+    int64_t next_[2] = {1, 1};
+    int64_t held_[2] = {0, 0};
+    int hold_countdown_[2] = {0, 0};
+};
+
+template<typename Check>
+Result run(uint64_t count, Check&& check) {
+    Workload workload(count);
+    Message msg;
+    Result result{0.0, 0.0, 0, 0, 0};
+
+    double worst_ns = 0;
+    uint64_t in_burst = 0;
+    auto burst_start = std::chrono::steady_clock::now();
+    const auto start = burst_start;
+
+    while (workload.next(msg)) {
+        const bool duplicate = check(msg);
+        if (duplicate) {
+            if (msg.duplicate) {
+                result.duplicates++;
+            } else {
+                result.false_positives++;
+            }
+        }
+
+        if (++in_burst == 1024) {
+            const auto now = std::chrono::steady_clock::now();
+            worst_ns = std::max(worst_ns, static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - burst_start).count()));
+            burst_start = now;
+            in_burst = 0;
+        }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    result.ns_per_msg = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(count);
+    result.worst_burst_us = worst_ns / 1000.0;
+    return result;
+}
+
+void print(const char* label, const Result& r, uint64_t injected) {
+    std::cout << "  " << std::left << std::setw(26) << label << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(8) << r.ns_per_msg << " ns/msg"
+              << std::setw(10) << r.worst_burst_us << " us worst/1024"
+              << "   dups " << r.duplicates << "/" << injected
+              << ", false+ " << r.false_positives
+              << ", ~" << r.memory_bytes / 1024 << " KB" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<uint64_t> sizes;
+    for (int i = 1; i < argc; i++) {
+        sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {1'000'000, 10'000'000, 100'000'000};
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "Worker Dedup Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    for (const uint64_t count : sizes) {
+        const uint64_t injected = [&]() {
+            Workload w(count);
+            Message m;
+            while (w.next(m)) {}
+            return w.injected();
+        }();
+
+        std::cout << "\n" << count << " messages:" << std::endl;
+
+        // Old MessageWorker::checkDuplicate (clear() at 1M entries)
+        {
+            std::unordered_set<uint64_t> seen;
+            seen.reserve(100000);
+            size_t peak = 0;
+            Result r = run(count, [&](const Message& msg) {
+                const uint64_t key = static_cast<uint64_t>(msg.sequence)
+                    ^ (static_cast<uint64_t>(msg.publisher_id) << 48);
+                if (seen.count(key) > 0) {
+                    return true;
+                }
+                seen.insert(key);
+                peak = std::max(peak, seen.size());
+                if (seen.size() > 1000000) {
+                    seen.clear();
+                }
+                return false;
+            });
+            // node (next + key + hash) + bucket pointer
+            r.memory_bytes = peak * (3 * sizeof(void*)) + seen.bucket_count() * sizeof(void*);
+            print("unordered_set (old)", r, injected);
+        }
+
+        {
+            DedupTable dedup(AeronConfig::WORKER_DEDUP_WINDOW, AeronConfig::WORKER_DEDUP_MAX_SOURCES);
+            Result r = run(count, [&](const Message& msg) {
+                return dedup.checkAndInsert(0, msg.publisher_id, msg.session_id, msg.sequence);
+            });
+            r.memory_bytes = dedup.getStatistics().memory_bytes;
+            print("DedupTable", r, injected);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * DoorbellBenchmark.cpp
+ *
+ * Worker wakeup latency on quiet and busy streams: backoff (current
+ * default) vs. park (spin budget + futex doorbell), spin as reference
+ *
+ * Setup per run:
+ * - Producer thread enqueues ids into a MessageQueue at a fixed rate
+ *   (busy-paced), recording the send time per id
+ * - Consumer thread runs the MessageWorker loop shape: drainTo() burst,
+ *   then IdleStrategy::idle(processed)
+ * - park: the queue rings the consumer's Doorbell after each publish
+ *
+ * Reported per strategy × rate:
+ * - enqueue → dequeue latency p50 / p99 / p99.9 / max (μs)
+ * - consumer CPU (thread CPU time / wall time)
+ * - futex parks / wakeups (park only)
+ *
+ * Usage:
+ *   ./doorbell_benchmark [seconds per run] [rates ...]
+ *   (default: 2 s, 100 10000 1000000 msg/s)
+ */
+
+#include "MessageQueue.h"
+#include "IdleStrategy.h"
+#include "Doorbell.h"
+#include "NanoClock.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <time.h>
+
+using namespace aeron::example;
+
+namespace {
+
+// In-flight ids are bounded by the queue (4096), so ids wrap safely
+constexpr size_t SEND_SLOTS = 1 << 16;
+
+struct Result {
+    double p50_us;
+    double p99_us;
+    double p999_us;
+    double max_us;
+    double cpu_percent;
+    size_t samples;
+    Doorbell::Statistics doorbell;
+};
+
+int64_t threadCpuNanos() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+double percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const size_t index = std::min(sorted.size() - 1,
+                                  static_cast<size_t>(p * static_cast<double>(sorted.size())));
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+Result run(const IdleStrategyConfig& config, int64_t rate, double seconds) {
+    MessageQueue queue(4096);
+    Doorbell doorbell;
+    std::vector<std::atomic<int64_t>> send_ns(SEND_SLOTS);
+
+    std::unique_ptr<IdleStrategy> idle = IdleStrategy::create(config);
+    auto* parking = dynamic_cast<ParkingIdleStrategy*>(idle.get());
+    if (parking) {
+        queue.setDoorbell(&doorbell);
+        parking->attach(&doorbell, [&queue]() { return !queue.empty(); });
+    }
+
+    const int64_t total = std::max<int64_t>(1, static_cast<int64_t>(rate * seconds));
+    std::vector<int64_t> latencies;
+    latencies.reserve(static_cast<size_t>(total));
+    std::atomic<bool> producer_done{false};
+    double cpu_percent = 0.0;
+
+    std::thread consumer([&]() {
+        const int64_t wall_start = NanoClock::nanoTime();
+        const int64_t cpu_start = threadCpuNanos();
+        int64_t received = 0;
+
+        while (received < total) {
+            const size_t n = queue.drainTo([&](BufferId id) {
+                const int64_t now = NanoClock::nanoTime();
+                latencies.push_back(now - send_ns[id & (SEND_SLOTS - 1)].load(std::memory_order_relaxed));
+            }, 64);
+            received += static_cast<int64_t>(n);
+            if (n == 0 && producer_done.load(std::memory_order_acquire) && queue.empty()) {
+                break;
+            }
+            idle->idle(static_cast<int>(n));
+        }
+
+        const int64_t wall = NanoClock::nanoTime() - wall_start;
+        cpu_percent = wall > 0 ? 100.0 * static_cast<double>(threadCpuNanos() - cpu_start) / wall : 0.0;
+    });
+
+    // Busy-paced producer (pacing itself is not what is measured)
+    const int64_t interval_ns = 1000000000LL / rate;
+    int64_t next_send = NanoClock::nanoTime() + 1000000;  // let the consumer go idle first
+    for (int64_t i = 0; i < total; i++) {
+        while (NanoClock::nanoTime() < next_send) {
+        }
+        next_send += interval_ns;
+
+        const BufferId id = static_cast<BufferId>(i);
+        send_ns[id & (SEND_SLOTS - 1)].store(NanoClock::nanoTime(), std::memory_order_relaxed);
+        while (!queue.enqueue(id)) {
+        }
+    }
+    producer_done.store(true, std::memory_order_release);
+    doorbell.ring();
+    consumer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    Result result;
+    result.p50_us = percentile(latencies, 0.50);
+    result.p99_us = percentile(latencies, 0.99);
+    result.p999_us = percentile(latencies, 0.999);
+    result.max_us = latencies.empty() ? 0.0 : static_cast<double>(latencies.back()) / 1000.0;
+    result.cpu_percent = cpu_percent;
+    result.samples = latencies.size();
+    result.doorbell = doorbell.getStatistics();
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 2.0;
+    std::vector<int64_t> rates;
+    for (int i = 2; i < argc; i++) {
+        rates.push_back(std::atoll(argv[i]));
+    }
+    if (rates.empty()) {
+        rates = {100, 10000, 1000000};
+    }
+
+    NanoClock::start();
+
+    // Same defaults as AeronConfig.h / [idle]
+    IdleStrategyConfig backoff;
+    backoff.name = "backoff";
+    IdleStrategyConfig park;
+    park.name = "park";
+    IdleStrategyConfig spin;
+    spin.name = "spin";
+    const IdleStrategyConfig* strategies[] = {&backoff, &park, &spin};
+
+    std::cout << "Doorbell benchmark: " << seconds << " s per run, consumer = worker loop shape"
+              << std::endl;
+    std::cout << "backoff: " << backoff.backoff_max_spins << " spins, "
+              << backoff.backoff_max_yields << " yields, park "
+              << backoff.backoff_min_park_ns / 1000 << "-" << backoff.backoff_max_park_ns / 1000
+              << " us; park: spin " << park.park_spin_ns / 1000 << " us, futex timeout "
+              << park.park_timeout_ns / 1000 << " us" << std::endl;
+    std::cout << "\n    Rate  Strategy     p50 us    p99 us  p99.9 us    max us   CPU %"
+              << "   parks / wakeups" << std::endl;
+
+    for (int64_t rate : rates) {
+        for (const IdleStrategyConfig* config : strategies) {
+            const Result r = run(*config, rate, seconds);
+            std::cout << std::setw(8) << rate << "  " << std::left << std::setw(8)
+                      << config->name << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(11) << r.p50_us
+                      << std::setw(10) << r.p99_us
+                      << std::setw(10) << r.p999_us
+                      << std::setw(10) << r.max_us
+                      << std::setw(8) << r.cpu_percent;
+            if (config->name == "park") {
+                std::cout << "   " << r.doorbell.parks << " / " << r.doorbell.wakeups;
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    NanoClock::stop();
+    return 0;
+}
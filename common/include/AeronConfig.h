@@ -57,6 +57,90 @@ public:
     // 타임아웃
     static constexpr long long IDLE_SLEEP_MS = 1;
     static constexpr long long MESSAGE_TIMEOUT_NS = 10000000000LL; // 10초
+
+    // Subscriber 수신 모드 ("copy", "in-place" 또는 "ring")
+    static constexpr const char* RECEIVE_MODE = "copy";
+
+    // Pool/queue 고갈 시 동작 ("drop" 또는 "backpressure")
+    static constexpr const char* OVERFLOW_POLICY = "drop";
+
+    // Idle strategy (noop | spin | yield | backoff | sleeping)
+    static constexpr const char* SUBSCRIBER_IDLE_STRATEGY = "sleeping";
+    static constexpr const char* WORKER_IDLE_STRATEGY = "backoff";
+    static constexpr const char* MONITOR_IDLE_STRATEGY = "sleeping";
+    static constexpr const char* PUBLISHER_IDLE_STRATEGY = "backoff";   // publish 재시도 대기
+    static constexpr long long IDLE_SLEEP_NS = IDLE_SLEEP_MS * 1000000LL;
+    static constexpr long long IDLE_BACKOFF_MAX_SPINS = 10;
+    static constexpr long long IDLE_BACKOFF_MAX_YIELDS = 100;
+    static constexpr long long IDLE_BACKOFF_MIN_PARK_NS = 1000;    // 1μs
+    static constexpr long long IDLE_BACKOFF_MAX_PARK_NS = 10000;   // 10μs
+    static constexpr long long IDLE_PARK_SPIN_NS = 20000;          // park: futex 전 spin 20μs
+    static constexpr long long IDLE_PARK_TIMEOUT_NS = 1000000;     // park: futex timeout 1ms
+
+    // Thread 배치 (CPU -1: 고정 안 함, priority 0: SCHED_OTHER)
+    static constexpr bool MLOCK_ALL = false;
+    static constexpr bool NUMA_FIRST_TOUCH = true;   // pool/queue를 subscriber CPU 노드에 할당
+
+    // Pool / queue 크기 (queue, ring 은 2의 거듭제곱)
+    static constexpr long long POOL_SMALL = 4096;          // 256 B buffers
+    static constexpr long long POOL_MEDIUM = 1024;         // 4 KB
+    static constexpr long long POOL_LARGE = 64;            // 64 KB
+    static constexpr long long POOL_HUGE = 8;              // 1 MB
+    static constexpr long long MESSAGE_QUEUE_SIZE = 4096;  // copy mode (per queue)
+    static constexpr long long VIEW_QUEUE_SIZE = 4096;     // in-place mode
+    static constexpr long long STATS_QUEUE_SIZE = 16384;   // monitoring
+    static constexpr long long RING_BYTES = 4LL * 1024 * 1024;  // ring mode
+
+    // Pool / queue backing memory (hugepages: none | transparent | 2mb | 1gb)
+    static constexpr const char* HUGEPAGES = "none";
+    static constexpr bool MEMORY_PREFAULT = true;
+    static constexpr bool MEMORY_LOCK = false;
+
+    // Hot path timestamp clock (auto | tsc | realtime)
+    static constexpr const char* CLOCK_SOURCE = "auto";
+    static constexpr long long CLOCK_CALIBRATION_INTERVAL_MS = 1000;
+
+    // Worker duplicate detection (sources × window / 8 bytes = 2 MB)
+    static constexpr long long WORKER_DEDUP_WINDOW = 1LL << 20;      // sequences per source
+    static constexpr long long WORKER_DEDUP_MAX_SOURCES = 16;        // (stream, publisher, session)
+
+    // Worker sharding (shards = 1: single worker)
+    // shard key: session | publisher | payload (payload: offset/width 바이트 정수)
+    static constexpr int WORKER_SHARDS = 1;
+    static constexpr const char* WORKER_SHARD_KEY = "session";
+    static constexpr int WORKER_SHARD_PAYLOAD_OFFSET = 0;
+    static constexpr int WORKER_SHARD_PAYLOAD_WIDTH = 8;
+
+    // Gap fill (archive replay of missing ranges, subscriber 로컬 유니캐스트)
+    // 분산 환경에서는 [gap_fill] replay_channel에 Subscriber IP 지정
+    static constexpr bool GAP_FILL_ENABLED = true;
+    static constexpr const char* GAP_FILL_REPLAY_CHANNEL =
+        "aeron:udp?endpoint=localhost:40458";
+    static constexpr int GAP_FILL_REPLAY_STREAM_ID = 21;
+    static constexpr long long GAP_FILL_MAX_REPLAY_BYTES = 16LL * 1024 * 1024;  // 16 MB
+    static constexpr long long GAP_FILL_TIMEOUT_MS = 2000;
+
+    // Counters file (aeron_substat 로 실시간 확인, file 비어있으면 <aeron_dir>/subscriber.counters)
+    static constexpr bool COUNTERS_ENABLED = true;
+    static constexpr const char* COUNTERS_FILE = "";
+    static constexpr long long COUNTERS_MAX = 256;
+    static constexpr long long COUNTERS_UPDATE_INTERVAL_MS = 100;
+    static constexpr bool COUNTERS_PRINT_STATS = true;   // 100건마다 stdout 출력
+
+    // Message validation (magic / version / length / type, flag 된 checksum)
+    // worker: worker thread 에서 burst 단위, receiver: subscriber thread 에서 sequence 추적 전
+    static constexpr bool VALIDATION_ENABLED = true;
+    static constexpr const char* VALIDATION_STAGE = "worker";
+
+    // Publisher back pressure / not connected 처리 ("retry", "bounded" 또는 "drop")
+    // bounded: PUBLISH_TIMEOUT_MS 동안 재시도 후 drop
+    static constexpr const char* PUBLISH_POLICY = "bounded";
+    static constexpr long long PUBLISH_TIMEOUT_MS = 1000;
+
+    // 작은 메시지를 MSG_BATCH envelope 로 묶기 (bytes 0: MTU 한도)
+    static constexpr bool PUBLISH_BATCH = false;
+    static constexpr long long PUBLISH_BATCH_BYTES = 0;
+    static constexpr long long PUBLISH_BATCH_LINGER_US = 50;
 };
 
 } // namespace example
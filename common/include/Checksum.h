@@ -0,0 +1,83 @@
+/**
+ * Checksum.h
+ *
+ * CRC32 (IEEE 802.3) / CRC32C (Castagnoli) for message integrity
+ *
+ * Why:
+ * - 기존 calculateCRC32 는 byte 당 table lookup 1번 (~0.4 GB/s)
+ *   → 메시지마다 checksum 을 켜두기엔 비쌈
+ * - CRC32C 는 x86 SSE4.2 `crc32` 명령으로 ~10 GB/s (8 byte/명령)
+ *
+ * Design:
+ * - crc32c(): 시작 시 CPU 확인 후 SSE4.2 / slicing-by-8 중 하나로 고정
+ *   (함수 포인터 1번 load, 이후 분기 없음)
+ * - crc32(): IEEE polynomial, slicing-by-8 (기존 wire format 호환)
+ * - zlib 스타일 chaining: crc32c(crc32c(0, a), b) == crc32c(0, a + b)
+ *   → header / payload 를 복사 없이 이어서 계산
+ *
+ * Performance (64 B header + 256 B payload, bench/checksum_benchmark):
+ * - byte table (기존): ~800 ns
+ * - slicing-by-8: ~150 ns
+ * - SSE4.2 CRC32C: ~30 ns (32 B payload 에서도 ~10x)
+ *
+ * Usage:
+ *   uint32_t crc = checksum::crc32c(0, header, header_length);
+ *   crc = checksum::crc32c(crc, payload, payload_length);
+ */
+
+#ifndef AERON_EXAMPLE_CHECKSUM_H
+#define AERON_EXAMPLE_CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Message checksum 알고리즘 (publisher 설정, header flag 로 전달)
+ */
+enum class ChecksumType : uint8_t {
+    NONE = 0,
+    CRC32 = 1,    // IEEE 802.3 (FLAG_CHECKSUM_ENABLED)
+    CRC32C = 2    // Castagnoli (FLAG_CHECKSUM_ENABLED | FLAG_CHECKSUM_CRC32C)
+};
+
+const char* checksumTypeName(ChecksumType type) noexcept;
+
+// "none" | "crc32" | "crc32c" (throws std::invalid_argument)
+ChecksumType parseChecksumType(const std::string& name);
+
+namespace checksum {
+
+/**
+ * CRC32 (IEEE 802.3, reflected 0xEDB88320), slicing-by-8
+ *
+ * @param crc 이전 결과 (처음엔 0)
+ */
+uint32_t crc32(uint32_t crc, const void* data, size_t length) noexcept;
+
+/**
+ * CRC32C (Castagnoli, reflected 0x82F63B78), runtime dispatch
+ *
+ * @param crc 이전 결과 (처음엔 0)
+ */
+uint32_t crc32c(uint32_t crc, const void* data, size_t length) noexcept;
+
+// Software fallback (benchmark / SSE4.2 결과 비교용)
+uint32_t crc32cSoftware(uint32_t crc, const void* data, size_t length) noexcept;
+
+// crc32c() 가 사용하는 구현: "sse4.2" | "slicing-by-8"
+const char* crc32cImplementation() noexcept;
+
+inline uint32_t compute(ChecksumType type, uint32_t crc, const void* data, size_t length) noexcept {
+    return type == ChecksumType::CRC32C ? crc32c(crc, data, length) : crc32(crc, data, length);
+}
+
+} // namespace checksum
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_CHECKSUM_H
@@ -1,13 +1,102 @@
 #ifndef CONFIG_LOADER_H
 #define CONFIG_LOADER_H
 
+#include "IdleStrategy.h"
+#include "ThreadUtil.h"
+#include "NanoClock.h"
 #include <string>
 #include <map>
+#include <vector>
 #include <stdexcept>
 
 namespace aeron {
 namespace example {
 
+/**
+ * 추가 구독 스트림 ([stream.<name>] 섹션)
+ */
+struct StreamSettings {
+    std::string name;                 // 섹션 이름의 <name> 부분
+    std::string channel;
+    int stream_id = 0;
+    bool dedicated_queue = false;     // queue = dedicated (전용 queue + worker)
+    int worker_cpu = -1;              // 전용 worker CPU (-1: 고정 안 함)
+};
+
+/**
+ * Gap fill agent ([gap_fill] 섹션, 기본값은 AeronConfig.h)
+ */
+struct GapFillSettings {
+    bool enabled;
+    std::string replay_channel;       // Archive → subscriber 유니캐스트
+    int replay_stream_id;
+    long long max_replay_bytes;       // 요청당 replay 상한
+    long long timeout_ms;             // replay당 타임아웃
+};
+
+/**
+ * Key 기반 worker sharding ([workers] 섹션, 기본값은 AeronConfig.h)
+ */
+struct WorkerShardSettings {
+    int shards;                       // worker 수 (1 = sharding 안 함)
+    std::string key;                  // session | publisher | payload
+    int payload_offset;               // key = payload: payload 내 byte offset
+    int payload_width;                // key = payload: 1..8 bytes (little-endian)
+    std::vector<int> cpus;            // shard별 CPU (없으면 threads.worker_cpu)
+};
+
+/**
+ * Pool / queue 크기와 backing memory ([memory] 섹션, 기본값은 AeronConfig.h)
+ */
+struct MemorySettings {
+    long long pool_small;             // 256 B buffers
+    long long pool_medium;            // 4 KB buffers
+    long long pool_large;             // 64 KB buffers
+    long long pool_huge;              // 1 MB buffers
+    long long message_queue;          // copy mode queue slots (2의 거듭제곱)
+    long long view_queue;             // in-place mode queue slots (2의 거듭제곱)
+    long long stats_queue;            // monitoring queue slots (2의 거듭제곱)
+    long long ring_bytes;             // ring mode bytes (2의 거듭제곱, >= 4096)
+    std::string hugepages;            // none | transparent | 2mb | 1gb
+    bool prefault;                    // 시작 시 모든 페이지 touch
+    bool lock;                        // mlock (arena 영역만)
+};
+
+/**
+ * Shared-memory counters ([counters] 섹션, 기본값은 AeronConfig.h)
+ */
+struct CountersSettings {
+    bool enabled;
+    std::string file;                 // 비어있으면 <aeron_dir>/subscriber.counters
+    long long max_counters;           // counter slot 수
+    long long update_interval_ms;     // main thread 가 통계를 counter 로 복사하는 주기
+    bool print_stats;                 // false: 100건마다 stdout 출력 안 함
+
+    // file 또는 기본 경로
+    std::string path(const std::string& aeron_dir) const {
+        return file.empty() ? aeron_dir + "/subscriber.counters" : file;
+    }
+};
+
+/**
+ * Message validation ([validation] 섹션, 기본값은 AeronConfig.h)
+ */
+struct ValidationSettings {
+    bool enabled;
+    std::string stage;                // worker | receiver
+};
+
+/**
+ * Publisher 재시도 정책 / batching ([publish] 섹션, 기본값은 AeronConfig.h)
+ */
+struct PublishSettings {
+    std::string policy;               // retry | bounded | drop
+    long long timeout_ms;             // bounded: 재시도 한도
+    bool batch;                       // MSG_BATCH envelope 사용
+    long long batch_bytes;            // envelope 한도 (0: maxPayloadLength)
+    long long batch_linger_us;        // 첫 메시지 후 최대 대기
+};
+
 /**
  * Aeron 설정을 담는 구조체
  * Config file, 환경변수, CLI 옵션에서 로드 가능
@@ -36,6 +125,51 @@ struct AeronSettings {
     long long idle_sleep_ms;
     long long message_timeout_ns;
 
+    // Subscriber 수신 모드: "copy" (pool memcpy) 또는 "in-place" (term buffer view)
+    std::string receive_mode;
+
+    // Pool/queue 고갈 시: "drop" (시세, 버림) 또는 "backpressure" (무손실, 흐름제어)
+    std::string overflow_policy;
+
+    // Multi-stream 구독 ([stream.<name>] 섹션, 비어있으면 [subscription] 단일 스트림)
+    std::vector<StreamSettings> streams;
+
+    // Idle strategy (폴링 루프별, [idle] 섹션)
+    IdleStrategyConfig subscriber_idle;
+    IdleStrategyConfig worker_idle;
+    IdleStrategyConfig monitor_idle;
+    IdleStrategyConfig publisher_idle;     // publish 재시도 대기
+
+    // Thread 배치 ([threads] 섹션: CPU affinity, SCHED_FIFO)
+    ThreadSettings subscriber_thread;
+    ThreadSettings worker_thread;
+    ThreadSettings monitor_thread;
+    ThreadSettings checkpoint_thread;
+    ThreadSettings gap_fill_thread;
+    bool mlock_all;            // mlockall(MCL_CURRENT | MCL_FUTURE)
+    bool numa_first_touch;     // pool/queue를 subscriber_cpu 노드에서 할당
+
+    // Hot path timestamp clock ([clock] 섹션)
+    NanoClockConfig clock;
+
+    // Archive replay of missing ranges ([gap_fill] 섹션)
+    GapFillSettings gap_fill;
+
+    // Shared queue를 여러 worker로 분산 ([workers] 섹션)
+    WorkerShardSettings workers;
+
+    // Pool / queue 크기, hugepage backing ([memory] 섹션)
+    MemorySettings memory;
+
+    // 외부 프로세스용 counters 파일 ([counters] 섹션)
+    CountersSettings counters;
+
+    // 메시지 무결성 검사 ([validation] 섹션)
+    ValidationSettings validation;
+
+    // Publisher back pressure 재시도 정책 / batching ([publish] 섹션)
+    PublishSettings publish;
+
     // 기본값으로 초기화 (AeronConfig.h 값 사용)
     AeronSettings();
 
@@ -102,6 +236,11 @@ private:
      * 문자열을 long long으로 변환
      */
     static long long parseLongLong(const std::string& str, const std::string& key);
+
+    /**
+     * 문자열을 bool로 변환 (true/false, yes/no, on/off, 1/0)
+     */
+    static bool parseBool(const std::string& str, const std::string& key);
 };
 
 } // namespace example
@@ -0,0 +1,235 @@
+/**
+ * CountersFile.h
+ *
+ * 메모리 매핑 counters 파일 (Aeron CnC counters 와 같은 방식)
+ *
+ * Why:
+ * - 통계는 std::atomic 멤버 → 종료 시 / 100건마다 stdout 으로만 보임
+ * - 파일에 매핑된 counter 는 다른 프로세스(aeron_substat)가 실시간으로 읽음
+ *   → 운영 중 throughput / drop / queue depth 를 subscriber 출력 없이 확인
+ *
+ * Layout (64 B 정렬):
+ *   [Header    64 B]          magic, version, max / allocated counters,
+ *                             pid, start time, heartbeat
+ *   [Metadata  max × 128 B]   type + label (counter 별)
+ *   [Values    max × 64 B]    int64 value (counter 별 cache line 하나)
+ *
+ * Design:
+ * - Counter 하나는 한 스레드만 씀 (relaxed plain store, lock / RMW 없음)
+ * - Metadata 를 다 쓴 뒤 counter_count 를 release store
+ *   → reader 는 acquire load 한 개수까지만 읽음
+ * - 시작할 때 기존 파일은 unlink 후 새로 생성 (새 inode)
+ *   → 이전 프로세스를 보던 reader 는 기존 매핑을 계속 안전하게 읽음
+ * - 종료 후에도 파일은 남음 (마지막 값 확인용); heartbeat / pid 로 생존 판단
+ *
+ * Usage (writer):
+ *   CountersFile counters("/dev/shm/aeron/subscriber.counters", 256);
+ *   Counter received = counters.allocate("subscriber: messages received");
+ *   received.set(n);                          // owning thread only
+ *   counters.heartbeat();                     // periodically
+ *
+ * Usage (reader, another process):
+ *   CountersReader reader(path);
+ *   for (size_t i = 0; i < reader.count(); i++)
+ *       std::cout << reader.label(i) << " " << reader.value(i) << std::endl;
+ */
+
+#ifndef AERON_EXAMPLE_COUNTERS_FILE_H
+#define AERON_EXAMPLE_COUNTERS_FILE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Counter 종류 (reader 가 rate 표시 여부 결정)
+ */
+enum class CounterType : uint32_t {
+    COUNT = 1,      // 단조 증가 (reader 가 /s rate 표시)
+    GAUGE = 2       // 현재 값 (queue depth, 사용 중 buffer 등)
+};
+
+/**
+ * 파일 포맷 (writer / reader 공용)
+ */
+namespace counters_layout {
+
+constexpr uint64_t MAGIC = 0x3154415453425553ULL;   // "SUBSTAT1"
+constexpr uint32_t VERSION = 1;
+constexpr size_t HEADER_LENGTH = 64;
+constexpr size_t METADATA_LENGTH = 128;
+constexpr size_t VALUE_LENGTH = 64;
+constexpr size_t MAX_LABEL_LENGTH = 112;
+constexpr size_t MAX_COUNTERS = 4096;
+
+struct alignas(64) Header {
+    uint64_t magic;                           // 마지막에 씀 (초기화 완료 표시)
+    uint32_t version;
+    uint32_t max_counters;
+    std::atomic<uint32_t> counter_count;      // 할당된 counter 수 (release)
+    uint32_t reserved;
+    int64_t pid;
+    int64_t start_time_ms;                    // CLOCK_REALTIME
+    std::atomic<int64_t> heartbeat_ms;        // 마지막 갱신 (CLOCK_REALTIME)
+};
+
+struct alignas(64) Metadata {
+    uint32_t type;                            // CounterType
+    uint32_t label_length;
+    uint64_t reserved;
+    char label[MAX_LABEL_LENGTH];
+};
+
+struct alignas(64) Value {
+    std::atomic<int64_t> value;
+};
+
+static_assert(sizeof(Header) == HEADER_LENGTH, "Header must be one cache line");
+static_assert(sizeof(Metadata) == METADATA_LENGTH, "Metadata must be 128 bytes");
+static_assert(sizeof(Value) == VALUE_LENGTH, "Value must be one cache line");
+static_assert(std::atomic<int64_t>::is_always_lock_free, "shared counters need lock-free int64");
+
+/**
+ * max_counters 개를 담는 파일 크기
+ */
+constexpr size_t fileLength(size_t max_counters) {
+    return HEADER_LENGTH + max_counters * (METADATA_LENGTH + VALUE_LENGTH);
+}
+
+} // namespace counters_layout
+
+/**
+ * Counter slot handle (값 복사 가능, 8 bytes)
+ *
+ * 한 counter 는 한 스레드만 씀: set / add 는 relaxed load + store
+ * (다른 프로세스 reader 는 찢어지지 않은 64-bit 값을 봄)
+ */
+class Counter {
+public:
+    Counter() noexcept : slot_(&scratch_) {}
+    explicit Counter(std::atomic<int64_t>* slot) noexcept : slot_(slot) {}
+
+    void set(int64_t value) noexcept {
+        slot_->store(value, std::memory_order_relaxed);
+    }
+
+    void add(int64_t delta) noexcept {
+        slot_->store(slot_->load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    int64_t get() const noexcept {
+        return slot_->load(std::memory_order_relaxed);
+    }
+
+private:
+    // 할당 실패 / counters 비활성 시 쓰는 곳 (값은 버려짐)
+    static thread_local std::atomic<int64_t> scratch_;
+
+    std::atomic<int64_t>* slot_;
+};
+
+/**
+ * Counters 파일 writer (subscriber 프로세스)
+ */
+class CountersFile {
+public:
+    /**
+     * path 에 max_counters 개짜리 counters 파일 생성 + 매핑
+     * @throws std::invalid_argument max_counters 범위 밖 (1..MAX_COUNTERS)
+     * @throws std::runtime_error 파일 생성 / mmap 실패
+     */
+    CountersFile(const std::string& path, size_t max_counters);
+    ~CountersFile();
+
+    // Non-copyable
+    CountersFile(const CountersFile&) = delete;
+    CountersFile& operator=(const CountersFile&) = delete;
+
+    /**
+     * Counter slot 할당 (시작 시, 한 스레드에서)
+     *
+     * label 은 MAX_LABEL_LENGTH 로 잘림. 파일이 가득 차면 경고 후
+     * 값이 버려지는 counter 반환.
+     */
+    Counter allocate(const std::string& label, CounterType type = CounterType::COUNT);
+
+    /**
+     * Writer 생존 표시 (reader 가 stale 판단에 사용)
+     */
+    void heartbeat() noexcept;
+
+    const std::string& path() const noexcept { return path_; }
+    size_t counterCount() const noexcept { return count_; }
+    size_t maxCounters() const noexcept { return max_counters_; }
+
+private:
+    std::string path_;
+    size_t max_counters_;
+    size_t count_ = 0;
+    size_t length_;
+    uint8_t* base_ = nullptr;
+    counters_layout::Header* header_ = nullptr;
+    counters_layout::Metadata* metadata_ = nullptr;
+    counters_layout::Value* values_ = nullptr;
+};
+
+/**
+ * Counters 파일 reader (aeron_substat, read-only 매핑)
+ */
+class CountersReader {
+public:
+    /**
+     * @throws std::runtime_error 파일 없음 / 포맷 불일치 / 초기화 중
+     */
+    explicit CountersReader(const std::string& path);
+    ~CountersReader();
+
+    // Non-copyable
+    CountersReader(const CountersReader&) = delete;
+    CountersReader& operator=(const CountersReader&) = delete;
+
+    /**
+     * 할당된 counter 수 (writer 가 실행 중이면 증가할 수 있음)
+     */
+    size_t count() const noexcept;
+
+    std::string label(size_t index) const;
+    CounterType type(size_t index) const noexcept;
+    int64_t value(size_t index) const noexcept;
+
+    int64_t pid() const noexcept { return header_->pid; }
+    int64_t startTimeMs() const noexcept { return header_->start_time_ms; }
+    int64_t heartbeatMs() const noexcept {
+        return header_->heartbeat_ms.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Writer 프로세스가 살아 있는지 (kill(pid, 0))
+     */
+    bool isWriterAlive() const noexcept;
+
+    /**
+     * path 가 다른 파일로 교체되었는지 (writer 재시작 → 다시 열어야 함)
+     */
+    bool isReplaced() const noexcept;
+
+    const std::string& path() const noexcept { return path_; }
+
+private:
+    std::string path_;
+    size_t length_ = 0;
+    uint64_t inode_ = 0;
+    const uint8_t* base_ = nullptr;
+    const counters_layout::Header* header_ = nullptr;
+    const counters_layout::Metadata* metadata_ = nullptr;
+    const counters_layout::Value* values_ = nullptr;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_COUNTERS_FILE_H
@@ -0,0 +1,125 @@
+/**
+ * Doorbell.h
+ *
+ * Futex 기반 consumer wakeup (저빈도 스트림용 hybrid wait)
+ *
+ * Why:
+ * - backoff 의 마지막 단계 sleep_for(10µs) 는 실제로 50~60µs 후에 깨어남
+ *   (timer slack + scheduler) → 조용한 스트림에서 첫 메시지 지연
+ * - spin / yield 만 쓰면 지연은 낮지만 코어 하나를 계속 점유
+ * - Consumer 가 futex 에서 잠들고 producer 가 enqueue 직후 깨우면
+ *   CPU 는 반납하면서 wakeup 은 수 µs
+ *
+ * Protocol (Dekker, lost wakeup 없음):
+ *   consumer: state = PARKED; fence; 큐 재확인 → 비어 있으면 futex_wait(PARKED)
+ *   producer: tail 게시; fence; state == PARKED 이면 state = AWAKE + futex_wake
+ * - Producer 비용: 게시마다 fence 1번 + load 1번 (batch 는 batch 당 1번),
+ *   syscall 은 consumer 가 실제로 잠들어 있을 때만
+ * - futex_wait 는 timeout 이 있음 (종료 플래그 확인, 안전망)
+ *
+ * Usage:
+ *   // Consumer (idle 시)
+ *   doorbell.park(timeout_ns, [&] { return !queue.empty(); });
+ *   // Producer (enqueue 후)
+ *   doorbell.ring();
+ */
+
+#ifndef AERON_EXAMPLE_DOORBELL_H
+#define AERON_EXAMPLE_DOORBELL_H
+
+#include "StatCounter.h"
+#include <atomic>
+#include <cstdint>
+
+namespace aeron {
+namespace example {
+
+class Doorbell {
+public:
+    Doorbell() = default;
+
+    // Non-copyable (futex word 주소가 고정이어야 함)
+    Doorbell(const Doorbell&) = delete;
+    Doorbell& operator=(const Doorbell&) = delete;
+
+    /**
+     * Producer: 게시 후 호출 (여러 producer 가능)
+     *
+     * Consumer 가 잠들어 있을 때만 futex_wake syscall.
+     */
+    void ring() noexcept {
+        // 게시(tail store) → state load 순서 보장 (store-load)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (state_.load(std::memory_order_relaxed) == PARKED) {
+            wake();
+        }
+    }
+
+    /**
+     * Consumer: ring() 또는 timeout 까지 잠듦 (consumer 는 한 스레드)
+     *
+     * @param timeout_ns 최대 대기 시간
+     * @param has_work PARKED 게시 후 다시 확인 (true 면 잠들지 않음)
+     * @return true if the thread actually slept
+     */
+    template<typename HasWork>
+    bool park(int64_t timeout_ns, HasWork&& has_work) {
+        state_.store(PARKED, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (has_work()) {
+            state_.store(AWAKE, std::memory_order_relaxed);
+            bump(cancelled_parks_);
+            return false;
+        }
+
+        bump(parks_);
+        if (!wait(timeout_ns)) {
+            bump(timeouts_);
+        }
+        state_.store(AWAKE, std::memory_order_relaxed);
+        return true;
+    }
+
+    struct Statistics {
+        uint64_t parks;             // futex_wait 호출
+        uint64_t cancelled_parks;   // PARKED 게시 후 work 발견 (잠들지 않음)
+        uint64_t timeouts;          // ring 없이 timeout 으로 깨어남
+        uint64_t wakeups;           // producer 의 futex_wake 호출
+    };
+
+    Statistics getStatistics() const noexcept {
+        Statistics stats;
+        stats.parks = parks_.load(std::memory_order_relaxed);
+        stats.cancelled_parks = cancelled_parks_.load(std::memory_order_relaxed);
+        stats.timeouts = timeouts_.load(std::memory_order_relaxed);
+        stats.wakeups = wakeups_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    static constexpr uint32_t AWAKE = 0;
+    static constexpr uint32_t PARKED = 1;
+
+    // Producer 측: state 를 AWAKE 로 바꾼 스레드만 futex_wake
+    void wake() noexcept;
+
+    // futex_wait(state_ == PARKED), false on timeout
+    bool wait(int64_t timeout_ns) noexcept;
+
+    // Futex word: producer / consumer 가 공유하는 유일한 line
+    alignas(64) std::atomic<uint32_t> state_{AWAKE};
+
+    // Consumer 측 통계
+    alignas(64) std::atomic<uint64_t> parks_{0};
+    std::atomic<uint64_t> cancelled_parks_{0};
+    std::atomic<uint64_t> timeouts_{0};
+
+    // Producer 측 통계 (여러 producer → fetch_add, wake 시에만)
+    alignas(64) std::atomic<uint64_t> wakeups_{0};
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_DOORBELL_H
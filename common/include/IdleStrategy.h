@@ -0,0 +1,258 @@
+/**
+ * IdleStrategy.h
+ *
+ * Pluggable idle strategies for polling loops (subscriber / worker / monitor)
+ *
+ * Usage:
+ *   auto idle = IdleStrategy::create(config);
+ *   while (running) {
+ *       int work = doWork();
+ *       idle->idle(work);   // work > 0 이면 reset, 0 이면 대기
+ *   }
+ *
+ * Strategies (지연시간 ↔ CPU 사용량 트레이드오프):
+ * - noop:     대기 없음 (100% CPU, 최저 지연)
+ * - spin:     busy-spin + CPU pause 명령 (100% CPU, 코어 독점 시)
+ * - yield:    sched_yield() (다른 스레드에 양보)
+ * - backoff:  spin → yield → park(지수 증가) 단계적 대기
+ * - sleeping: 고정 시간 sleep (최소 CPU, 최대 지연)
+ * - park:     spin(시간 예산) → futex park, producer 가 Doorbell 로 깨움
+ *             (저빈도 스트림: CPU 반납 + 수 µs wakeup)
+ *
+ * Counters:
+ * - 각 strategy는 idle/busy 호출 수와 spin/yield/park 횟수를 기록
+ * - 폴링 스레드 한 개만 기록 (single-writer), 다른 스레드는 stats()로 조회
+ */
+
+#ifndef AERON_EXAMPLE_IDLE_STRATEGY_H
+#define AERON_EXAMPLE_IDLE_STRATEGY_H
+
+#include "Doorbell.h"
+#include "StatCounter.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Idle strategy 설정 (INI [idle] 섹션에서 로드)
+ */
+struct IdleStrategyConfig {
+    std::string name = "sleeping";       // noop | spin | yield | backoff | sleeping | park
+    int64_t sleep_ns = 1000000;          // sleeping: 고정 sleep 시간
+    int64_t backoff_max_spins = 10;      // backoff: spin 단계 횟수
+    int64_t backoff_max_yields = 100;    // backoff: yield 단계 횟수
+    int64_t backoff_min_park_ns = 1000;  // backoff: 첫 park 시간
+    int64_t backoff_max_park_ns = 10000; // backoff: park 상한 (2배씩 증가)
+    int64_t park_spin_ns = 20000;        // park: futex 전 spin 예산
+    int64_t park_timeout_ns = 1000000;   // park: futex 최대 대기 (종료 확인 주기)
+};
+
+/**
+ * Idle strategy 통계 (snapshot)
+ */
+struct IdleStats {
+    uint64_t idle_calls;   // work == 0
+    uint64_t busy_calls;   // work > 0
+    uint64_t spins;        // pause/no-op 대기
+    uint64_t yields;       // sched_yield
+    uint64_t parks;        // sleep (nanosleep / futex)
+
+    double busyRatio() const {
+        uint64_t total = idle_calls + busy_calls;
+        return total > 0 ? static_cast<double>(busy_calls) / total : 0.0;
+    }
+};
+
+class IdleStrategy {
+public:
+    virtual ~IdleStrategy() = default;
+
+    /**
+     * 폴링 결과에 따라 대기
+     *
+     * @param work_count 이번 루프에서 처리한 작업 수 (0 이면 idle)
+     */
+    void idle(int work_count) {
+        if (work_count > 0) {
+            bump(busy_calls_);
+            reset();
+            return;
+        }
+        bump(idle_calls_);
+        onIdle();
+    }
+
+    /**
+     * 작업 발생 - backoff 상태 초기화
+     */
+    virtual void reset() {}
+
+    /**
+     * Strategy 이름 (설정 값과 동일)
+     */
+    virtual const char* name() const = 0;
+
+    /**
+     * 통계 조회 (다른 스레드에서 호출 가능)
+     */
+    IdleStats stats() const;
+
+    /**
+     * 통계 출력
+     */
+    void printStatistics(const std::string& label) const;
+
+    /**
+     * 설정으로부터 strategy 생성
+     *
+     * @throws std::runtime_error 알 수 없는 이름
+     */
+    static std::unique_ptr<IdleStrategy> create(const IdleStrategyConfig& config);
+
+    /**
+     * 지원되는 strategy 이름인지 확인
+     */
+    static bool isValidName(const std::string& name);
+
+    // CPU pause hint (spin-wait loop 전력/파이프라인 최적화)
+    static void cpuPause() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+protected:
+    // 작업 없음 - strategy별 대기 1회
+    virtual void onIdle() = 0;
+
+    static void parkNanos(int64_t ns);
+
+    std::atomic<uint64_t> idle_calls_{0};
+    std::atomic<uint64_t> busy_calls_{0};
+    std::atomic<uint64_t> spins_{0};
+    std::atomic<uint64_t> yields_{0};
+    std::atomic<uint64_t> parks_{0};
+};
+
+/**
+ * 대기 없음 (호출자가 자체적으로 대기하거나 최저 지연이 필요한 경우)
+ */
+class NoOpIdleStrategy : public IdleStrategy {
+public:
+    const char* name() const override { return "noop"; }
+
+protected:
+    void onIdle() override {}
+};
+
+/**
+ * Busy-spin + CPU pause (전용 코어에서만 사용)
+ */
+class BusySpinIdleStrategy : public IdleStrategy {
+public:
+    const char* name() const override { return "spin"; }
+
+protected:
+    void onIdle() override {
+        bump(spins_);
+        cpuPause();
+    }
+};
+
+/**
+ * sched_yield (코어 공유 시)
+ */
+class YieldingIdleStrategy : public IdleStrategy {
+public:
+    const char* name() const override { return "yield"; }
+
+protected:
+    void onIdle() override;
+};
+
+/**
+ * 고정 시간 sleep (기존 1ms sleep 동작)
+ */
+class SleepingIdleStrategy : public IdleStrategy {
+public:
+    explicit SleepingIdleStrategy(int64_t sleep_ns) : sleep_ns_(sleep_ns) {}
+    const char* name() const override { return "sleeping"; }
+
+protected:
+    void onIdle() override;
+
+private:
+    const int64_t sleep_ns_;
+};
+
+/**
+ * spin → yield → park (park 시간은 min → max 로 2배씩 증가)
+ *
+ * 트래픽이 막 끊긴 직후에는 spin으로 빠르게 반응하고,
+ * 조용한 구간이 길어지면 park로 CPU를 반납한다.
+ */
+class BackoffIdleStrategy : public IdleStrategy {
+public:
+    BackoffIdleStrategy(int64_t max_spins, int64_t max_yields,
+                        int64_t min_park_ns, int64_t max_park_ns);
+    void reset() override;
+    const char* name() const override { return "backoff"; }
+
+protected:
+    void onIdle() override;
+
+private:
+    const int64_t max_spins_;
+    const int64_t max_yields_;
+    const int64_t min_park_ns_;
+    const int64_t max_park_ns_;
+
+    int64_t spin_count_;
+    int64_t yield_count_;
+    int64_t park_ns_;
+};
+
+/**
+ * spin (park_spin_ns 동안) → Doorbell futex park (park_timeout_ns 상한)
+ *
+ * Consumer 가 attach() 로 doorbell 과 큐 확인 함수를 연결하고, 그 큐의
+ * producer 는 게시 후 doorbell.ring() 을 호출해야 함. 연결 전에는 park 대신
+ * park_timeout_ns 만큼 sleep.
+ */
+class ParkingIdleStrategy : public IdleStrategy {
+public:
+    ParkingIdleStrategy(int64_t spin_ns, int64_t park_timeout_ns);
+    void reset() override;
+    const char* name() const override { return "park"; }
+
+    /**
+     * Consumer 스레드 시작 전에 호출
+     *
+     * @param doorbell Producer 가 ring 하는 doorbell (not owned)
+     * @param has_work PARKED 게시 후 큐 재확인 (true: 잠들지 않음)
+     */
+    void attach(Doorbell* doorbell, std::function<bool()> has_work);
+
+protected:
+    void onIdle() override;
+
+private:
+    const int64_t spin_ns_;
+    const int64_t park_timeout_ns_;
+
+    Doorbell* doorbell_ = nullptr;
+    std::function<bool()> has_work_;
+    int64_t spin_start_ns_ = 0;     // 0: 이번 idle 구간 시작 전
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_IDLE_STRATEGY_H
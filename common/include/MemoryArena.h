@@ -0,0 +1,155 @@
+/**
+ * MemoryArena.h
+ *
+ * mmap 기반 bump allocator (pool / queue / ring 의 backing memory)
+ *
+ * Why:
+ * - Pool + queue + ring 합계 4~40 MB → 4 KB 페이지로는 TLB entry 수천 개,
+ *   worker/subscriber 가 buffer 를 돌 때마다 TLB miss
+ * - 2 MB / 1 GB hugepage 로 매핑하면 entry 수십 개 (1 GB 면 1개)
+ * - 시작 시 pre-fault + mlock → hot path 에서 page fault / swap-out 없음
+ *
+ * Design:
+ * - 페이지 크기 단위 chunk 를 mmap, 그 안에서 64 B 정렬 bump 할당
+ *   (작은 queue 여러 개가 hugepage 하나를 공유)
+ * - chunk 보다 큰 요청은 자기 크기(페이지 단위 올림)의 chunk 를 따로 매핑
+ * - hugetlb 매핑 실패(예약된 hugepage 부족) → 경고 후 일반 페이지 +
+ *   MADV_HUGEPAGE 로 fallback (시작은 계속)
+ * - 개별 해제 없음: arena 가 파괴될 때 모든 chunk munmap
+ *   (arena 는 그 위에 만든 pool/queue 보다 오래 살아야 함)
+ *
+ * Usage:
+ *   MemoryConfig memory;
+ *   memory.hugepages = HugePages::HUGE_2MB;
+ *   memory.lock = true;
+ *   MemoryArena arena(memory);
+ *   MessageBufferPool pool(sizing, &arena);
+ *   MessageBufferQueue queue(8192, &arena);
+ *
+ * 2 MB / 1 GB 페이지는 미리 예약 필요:
+ *   echo 64 > /sys/kernel/mm/hugepages/hugepages-2048kB/nr_hugepages
+ * mlock 은 RLIMIT_MEMLOCK (또는 CAP_IPC_LOCK) 필요, 실패는 경고만 출력.
+ */
+
+#ifndef AERON_EXAMPLE_MEMORY_ARENA_H
+#define AERON_EXAMPLE_MEMORY_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Backing page 종류
+ */
+enum class HugePages {
+    NONE,           // 4 KB 페이지
+    TRANSPARENT,    // 4 KB 매핑 + MADV_HUGEPAGE (THP, 예약 불필요)
+    HUGE_2MB,       // MAP_HUGETLB 2 MB
+    HUGE_1GB        // MAP_HUGETLB 1 GB
+};
+
+/**
+ * Arena 설정 (INI [memory] 섹션에서 로드)
+ */
+struct MemoryConfig {
+    HugePages hugepages = HugePages::NONE;
+    bool prefault = true;      // 매핑 직후 모든 페이지 touch (first-touch NUMA)
+    bool lock = false;         // mlock (swap-out / minor fault 방지)
+
+    /**
+     * "none" | "transparent" | "2mb" | "1gb"
+     * @throws std::invalid_argument unknown name
+     */
+    static HugePages parseHugePages(const std::string& name);
+    static const char* hugePagesName(HugePages pages);
+};
+
+class MemoryArena {
+public:
+    explicit MemoryArena(const MemoryConfig& config);
+    ~MemoryArena();
+
+    // Non-copyable
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    /**
+     * bytes 할당 (alignment: 2의 거듭제곱, 최대 페이지 크기)
+     *
+     * 반환 메모리는 0 으로 채워져 있음 (새 anonymous 매핑).
+     * @throws std::bad_alloc mmap 실패 (fallback 포함)
+     */
+    void* allocate(size_t bytes, size_t alignment = 64);
+
+    /**
+     * T[count] 생성: arena 가 있으면 arena, 없으면 64 B 정렬 heap
+     * (각 원소는 value-initialize)
+     */
+    template<typename T>
+    static T* newArray(MemoryArena* arena, size_t count) {
+        const size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+        void* memory = arena
+            ? arena->allocate(count * sizeof(T), alignment)
+            : ::operator new(count * sizeof(T), std::align_val_t(alignment));
+        T* array = static_cast<T*>(memory);
+        for (size_t i = 0; i < count; i++) {
+            new (&array[i]) T();
+        }
+        return array;
+    }
+
+    /**
+     * newArray() 의 짝 (arena 메모리는 arena 파괴 시 반환)
+     */
+    template<typename T>
+    static void deleteArray(MemoryArena* arena, T* array, size_t count) noexcept {
+        if (!array) {
+            return;
+        }
+        for (size_t i = 0; i < count; i++) {
+            array[i].~T();
+        }
+        if (!arena) {
+            const size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+            ::operator delete(array, std::align_val_t(alignment));
+        }
+    }
+
+    const MemoryConfig& config() const noexcept { return config_; }
+    size_t pageSize() const noexcept { return page_size_; }
+    size_t mappedBytes() const noexcept { return mapped_bytes_; }
+    size_t usedBytes() const noexcept { return used_bytes_; }
+    size_t chunkCount() const noexcept { return chunks_.size(); }
+    size_t hugePageFallbacks() const noexcept { return fallbacks_; }
+    size_t lockedBytes() const noexcept { return locked_bytes_; }
+
+    void printStatistics() const;
+
+private:
+    struct Chunk {
+        uint8_t* base;
+        size_t size;
+        size_t used;
+    };
+
+    // min_bytes 이상을 담는 chunk 매핑 (hugetlb 실패 시 일반 페이지)
+    Chunk mapChunk(size_t min_bytes);
+
+    MemoryConfig config_;
+    size_t page_size_;             // 요청한 페이지 크기 (4 KB / 2 MB / 1 GB)
+    std::vector<Chunk> chunks_;
+    size_t mapped_bytes_ = 0;
+    size_t used_bytes_ = 0;
+    size_t locked_bytes_ = 0;
+    size_t fallbacks_ = 0;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_MEMORY_ARENA_H
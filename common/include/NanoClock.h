@@ -0,0 +1,157 @@
+/**
+ * NanoClock.h
+ *
+ * Low-overhead wall-clock timestamps for the hot path
+ *
+ * Design:
+ * - nanoTime() = base_ns + (rdtsc - base_tsc) × ns_per_tick
+ * - ns_per_tick / base pair is recalibrated against CLOCK_REALTIME by a
+ *   background thread (default every 1 s), so timestamps stay comparable
+ *   with the publisher's clock_gettime(CLOCK_REALTIME) send timestamps
+ * - Recalibration never steps the clock: the new base continues from the
+ *   current reading and the offset to CLOCK_REALTIME is slewed out over
+ *   the next interval (rate adjusted by at most 500 ppm), so differences
+ *   of nanoTime() are safe as durations; wall-clock steps are absorbed
+ *   slowly rather than followed
+ * - Readers take a seqlock snapshot of the calibration (no lock, no
+ *   syscall); the writer is the calibration thread only
+ * - TSC is used only when invariant (CPUID 0x80000007 EDX[8]); otherwise
+ *   nanoTime() falls back to clock_gettime(CLOCK_REALTIME) (vDSO)
+ *
+ * Performance (typical x86-64):
+ * - rdtsc path:           ~7-10 ns
+ * - clock_gettime (vDSO): ~20-25 ns
+ * - system_clock::now():  ~20-25 ns
+ * Under virtualization rdtsc may be slower (measure with
+ * bench/ClockBenchmark.cpp).
+ *
+ * Usage:
+ *   NanoClock::start();                 // once, at process start
+ *   int64_t t = NanoClock::nanoTime();  // any thread
+ *   NanoClock::stop();                  // at shutdown
+ *
+ * Before start() (or after stop()), nanoTime() uses the vDSO fallback.
+ */
+
+#ifndef AERON_EXAMPLE_NANO_CLOCK_H
+#define AERON_EXAMPLE_NANO_CLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define AERON_EXAMPLE_HAS_TSC 1
+#else
+#define AERON_EXAMPLE_HAS_TSC 0
+#endif
+
+namespace aeron {
+namespace example {
+
+/**
+ * Clock 설정 (INI [clock] 섹션에서 로드)
+ */
+struct NanoClockConfig {
+    std::string source = "auto";        // auto | tsc | realtime
+    int64_t calibration_interval_ms = 1000;
+};
+
+/**
+ * TSC → ns conversion snapshot (seqlock, written by the calibration thread)
+ */
+struct alignas(64) NanoClockCalibration {
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint64_t> base_tsc{0};
+    std::atomic<int64_t> base_ns{0};
+    std::atomic<uint64_t> mult{0};          // ns per tick << MULT_SHIFT
+    std::atomic<bool> tsc_enabled{false};
+};
+
+class NanoClock {
+public:
+    /**
+     * Current wall-clock time in nanoseconds since the epoch
+     */
+    static int64_t nanoTime() noexcept {
+#if AERON_EXAMPLE_HAS_TSC
+        if (calibration_.tsc_enabled.load(std::memory_order_relaxed)) {
+            uint32_t seq;
+            uint64_t base_tsc;
+            int64_t base_ns;
+            uint64_t mult;
+            do {
+                seq = calibration_.seq.load(std::memory_order_acquire);
+                base_tsc = calibration_.base_tsc.load(std::memory_order_relaxed);
+                base_ns = calibration_.base_ns.load(std::memory_order_relaxed);
+                mult = calibration_.mult.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while ((seq & 1) != 0 || seq != calibration_.seq.load(std::memory_order_relaxed));
+
+            const uint64_t delta = __rdtsc() - base_tsc;
+            return base_ns + static_cast<int64_t>(
+                (static_cast<unsigned __int128>(delta) * mult) >> MULT_SHIFT);
+        }
+#endif
+        return realtimeNanos();
+    }
+
+    /**
+     * CLOCK_REALTIME via vDSO (fallback and calibration reference)
+     */
+    static int64_t realtimeNanos() noexcept {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000LL + ts.tv_nsec;
+    }
+
+    /**
+     * Calibrate and start the background recalibration thread
+     *
+     * @return true if the TSC path is active, false if using the fallback
+     * @throws std::runtime_error source = "tsc" but TSC is not invariant
+     */
+    static bool start(const NanoClockConfig& config = NanoClockConfig());
+
+    /**
+     * Stop recalibration and switch back to the fallback
+     */
+    static void stop();
+
+    /**
+     * CPU advertises an invariant (constant rate, non-stop) TSC
+     */
+    static bool isTscInvariant();
+
+    /**
+     * "tsc" or "realtime"
+     */
+    static const char* source();
+
+    /**
+     * Estimated TSC frequency (0 when the TSC path is inactive)
+     */
+    static double tscGhz();
+
+    /**
+     * Last observed |nanoTime() - CLOCK_REALTIME| at recalibration
+     */
+    static int64_t lastDriftNs();
+
+    static void printStatistics();
+
+    // Fixed-point shift of ns-per-tick multiplier
+    static constexpr int MULT_SHIFT = 32;
+
+private:
+    static inline NanoClockCalibration calibration_;
+
+    friend class NanoClockCalibrator;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_NANO_CLOCK_H
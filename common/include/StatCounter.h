@@ -0,0 +1,36 @@
+/**
+ * StatCounter.h
+ *
+ * Single-writer statistics counters
+ *
+ * Design:
+ * - 통계 counter 는 writer 스레드가 1개 (hot path 소유 스레드)
+ * - bump() = relaxed load + store: lock prefix (fetch_add) 없이 갱신
+ * - 다른 스레드 (monitor, counters file) 는 relaxed load 로 근사값을 읽음
+ *
+ * Writer 가 둘 이상인 counter 에는 쓰지 말 것 (fetch_add 사용).
+ *
+ * Usage:
+ *   std::atomic<uint64_t> sent_{0};
+ *   bump(sent_);        // owner thread
+ *   bump(bytes_, n);
+ */
+
+#ifndef AERON_EXAMPLE_STAT_COUNTER_H
+#define AERON_EXAMPLE_STAT_COUNTER_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace aeron {
+namespace example {
+
+// Single-writer counter update (plain load + store, no lock prefix)
+inline void bump(std::atomic<uint64_t>& counter, uint64_t n = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_STAT_COUNTER_H
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <algorithm>
 #include <cstdlib>
+#include <set>
+#include <utility>
 
 namespace aeron {
 namespace example {
@@ -31,6 +33,71 @@ AeronSettings::AeronSettings() {
 
     idle_sleep_ms = AeronConfig::IDLE_SLEEP_MS;
     message_timeout_ns = AeronConfig::MESSAGE_TIMEOUT_NS;
+
+    receive_mode = AeronConfig::RECEIVE_MODE;
+    overflow_policy = AeronConfig::OVERFLOW_POLICY;
+
+    IdleStrategyConfig idle;
+    idle.sleep_ns = AeronConfig::IDLE_SLEEP_NS;
+    idle.backoff_max_spins = AeronConfig::IDLE_BACKOFF_MAX_SPINS;
+    idle.backoff_max_yields = AeronConfig::IDLE_BACKOFF_MAX_YIELDS;
+    idle.backoff_min_park_ns = AeronConfig::IDLE_BACKOFF_MIN_PARK_NS;
+    idle.backoff_max_park_ns = AeronConfig::IDLE_BACKOFF_MAX_PARK_NS;
+    idle.park_spin_ns = AeronConfig::IDLE_PARK_SPIN_NS;
+    idle.park_timeout_ns = AeronConfig::IDLE_PARK_TIMEOUT_NS;
+
+    subscriber_idle = idle;
+    subscriber_idle.name = AeronConfig::SUBSCRIBER_IDLE_STRATEGY;
+    worker_idle = idle;
+    worker_idle.name = AeronConfig::WORKER_IDLE_STRATEGY;
+    monitor_idle = idle;
+    monitor_idle.name = AeronConfig::MONITOR_IDLE_STRATEGY;
+    publisher_idle = idle;
+    publisher_idle.name = AeronConfig::PUBLISHER_IDLE_STRATEGY;
+
+    mlock_all = AeronConfig::MLOCK_ALL;
+    numa_first_touch = AeronConfig::NUMA_FIRST_TOUCH;
+
+    clock.source = AeronConfig::CLOCK_SOURCE;
+    clock.calibration_interval_ms = AeronConfig::CLOCK_CALIBRATION_INTERVAL_MS;
+
+    gap_fill.enabled = AeronConfig::GAP_FILL_ENABLED;
+    gap_fill.replay_channel = AeronConfig::GAP_FILL_REPLAY_CHANNEL;
+    gap_fill.replay_stream_id = AeronConfig::GAP_FILL_REPLAY_STREAM_ID;
+    gap_fill.max_replay_bytes = AeronConfig::GAP_FILL_MAX_REPLAY_BYTES;
+    gap_fill.timeout_ms = AeronConfig::GAP_FILL_TIMEOUT_MS;
+
+    workers.shards = AeronConfig::WORKER_SHARDS;
+    workers.key = AeronConfig::WORKER_SHARD_KEY;
+    workers.payload_offset = AeronConfig::WORKER_SHARD_PAYLOAD_OFFSET;
+    workers.payload_width = AeronConfig::WORKER_SHARD_PAYLOAD_WIDTH;
+
+    memory.pool_small = AeronConfig::POOL_SMALL;
+    memory.pool_medium = AeronConfig::POOL_MEDIUM;
+    memory.pool_large = AeronConfig::POOL_LARGE;
+    memory.pool_huge = AeronConfig::POOL_HUGE;
+    memory.message_queue = AeronConfig::MESSAGE_QUEUE_SIZE;
+    memory.view_queue = AeronConfig::VIEW_QUEUE_SIZE;
+    memory.stats_queue = AeronConfig::STATS_QUEUE_SIZE;
+    memory.ring_bytes = AeronConfig::RING_BYTES;
+    memory.hugepages = AeronConfig::HUGEPAGES;
+    memory.prefault = AeronConfig::MEMORY_PREFAULT;
+    memory.lock = AeronConfig::MEMORY_LOCK;
+
+    counters.enabled = AeronConfig::COUNTERS_ENABLED;
+    counters.file = AeronConfig::COUNTERS_FILE;
+    counters.max_counters = AeronConfig::COUNTERS_MAX;
+    counters.update_interval_ms = AeronConfig::COUNTERS_UPDATE_INTERVAL_MS;
+    counters.print_stats = AeronConfig::COUNTERS_PRINT_STATS;
+
+    validation.enabled = AeronConfig::VALIDATION_ENABLED;
+    validation.stage = AeronConfig::VALIDATION_STAGE;
+
+    publish.policy = AeronConfig::PUBLISH_POLICY;
+    publish.timeout_ms = AeronConfig::PUBLISH_TIMEOUT_MS;
+    publish.batch = AeronConfig::PUBLISH_BATCH;
+    publish.batch_bytes = AeronConfig::PUBLISH_BATCH_BYTES;
+    publish.batch_linger_us = AeronConfig::PUBLISH_BATCH_LINGER_US;
 }
 
 bool AeronSettings::validate(std::string& error_message) const {
@@ -76,6 +143,206 @@ bool AeronSettings::validate(std::string& error_message) const {
         return false;
     }
 
+    // 수신 모드 검증
+    if (receive_mode != "copy" && receive_mode != "in-place" && receive_mode != "ring") {
+        error_message = "receive_mode must be 'copy', 'in-place' or 'ring'";
+        return false;
+    }
+    if (overflow_policy != "drop" && overflow_policy != "backpressure") {
+        error_message = "overflow_policy must be 'drop' or 'backpressure'";
+        return false;
+    }
+
+    // Idle strategy 검증
+    auto validateIdle = [&](const IdleStrategyConfig& idle, const std::string& name) {
+        if (!IdleStrategy::isValidName(idle.name)) {
+            error_message = "idle." + name + " must be one of noop|spin|yield|backoff|sleeping|park";
+            return false;
+        }
+        if (idle.sleep_ns <= 0 || idle.backoff_min_park_ns <= 0 || idle.backoff_max_park_ns <= 0) {
+            error_message = "idle sleep/park times must be positive";
+            return false;
+        }
+        if (idle.backoff_max_spins < 0 || idle.backoff_max_yields < 0) {
+            error_message = "idle backoff spin/yield counts must not be negative";
+            return false;
+        }
+        if (idle.park_spin_ns < 0 || idle.park_timeout_ns <= 0) {
+            error_message = "idle.park_spin_ns must not be negative, idle.park_timeout_ns must be positive";
+            return false;
+        }
+        return true;
+    };
+
+    if (!validateIdle(subscriber_idle, "subscriber"))
+        return false;
+    if (!validateIdle(worker_idle, "worker"))
+        return false;
+    if (!validateIdle(monitor_idle, "monitor"))
+        return false;
+    if (!validateIdle(publisher_idle, "publisher"))
+        return false;
+
+    // Thread 배치 검증
+    auto validateThread = [&](const ThreadSettings& thread, const std::string& name) {
+        if (thread.cpu < -1 || thread.cpu >= CPU_SETSIZE) {
+            error_message = "threads." + name + "_cpu must be -1 or a valid CPU number";
+            return false;
+        }
+        if (thread.priority < 0 || thread.priority > 99) {
+            error_message = "threads." + name + "_priority must be 0 (normal) or 1-99 (SCHED_FIFO)";
+            return false;
+        }
+        return true;
+    };
+
+    if (!validateThread(subscriber_thread, "subscriber"))
+        return false;
+    if (!validateThread(worker_thread, "worker"))
+        return false;
+    if (!validateThread(monitor_thread, "monitor"))
+        return false;
+    if (!validateThread(checkpoint_thread, "checkpoint"))
+        return false;
+    if (!validateThread(gap_fill_thread, "gap_fill"))
+        return false;
+
+    // Clock 검증
+    if (clock.source != "auto" && clock.source != "tsc" && clock.source != "realtime") {
+        error_message = "clock.source must be 'auto', 'tsc' or 'realtime'";
+        return false;
+    }
+    if (clock.calibration_interval_ms <= 0) {
+        error_message = "clock.calibration_interval_ms must be positive";
+        return false;
+    }
+
+    // Gap fill 검증 (replay stream은 ReplayMerge와 겹치면 안 됨)
+    if (gap_fill.enabled) {
+        if (!validateChannel(gap_fill.replay_channel, "gap_fill.replay_channel"))
+            return false;
+        if (gap_fill.replay_stream_id <= 0) {
+            error_message = "gap_fill.replay_stream_id must be positive";
+            return false;
+        }
+        if (gap_fill.replay_channel == replay_channel && gap_fill.replay_stream_id == replay_stream_id) {
+            error_message = "gap_fill replay channel/stream_id must differ from [replay]";
+            return false;
+        }
+        if (gap_fill.max_replay_bytes <= 0 || gap_fill.timeout_ms <= 0) {
+            error_message = "gap_fill.max_replay_bytes and gap_fill.timeout_ms must be positive";
+            return false;
+        }
+    }
+
+    // Worker sharding 검증
+    if (workers.shards < 1 || workers.shards > 64) {
+        error_message = "workers.shards must be 1-64";
+        return false;
+    }
+    if (workers.key != "session" && workers.key != "publisher" && workers.key != "payload") {
+        error_message = "workers.shard_key must be 'session', 'publisher' or 'payload'";
+        return false;
+    }
+    if (workers.payload_offset < 0 || workers.payload_width < 1 || workers.payload_width > 8) {
+        error_message = "workers.payload_offset must be >= 0 and payload_width 1-8";
+        return false;
+    }
+    for (int cpu : workers.cpus) {
+        if (cpu < -1 || cpu >= CPU_SETSIZE) {
+            error_message = "workers.cpus entries must be -1 or a valid CPU number";
+            return false;
+        }
+    }
+
+    // Memory 검증 (queue / ring 은 mask 인덱싱 → 2의 거듭제곱)
+    auto isPowerOf2 = [](long long value) {
+        return value > 0 && (value & (value - 1)) == 0;
+    };
+    const long long pools[] = {memory.pool_small, memory.pool_medium,
+                               memory.pool_large, memory.pool_huge};
+    for (long long pool : pools) {
+        if (pool < 1 || pool > (1LL << 20)) {
+            error_message = "memory.pool_small/medium/large/huge must be 1-1048576";
+            return false;
+        }
+    }
+    if (!isPowerOf2(memory.message_queue) || memory.message_queue < 16 || memory.message_queue > (1LL << 20)) {
+        error_message = "memory.message_queue must be a power of 2 (16-1048576)";
+        return false;
+    }
+    if (!isPowerOf2(memory.view_queue) || memory.view_queue < 2) {
+        error_message = "memory.view_queue must be a power of 2 (>= 2)";
+        return false;
+    }
+    if (!isPowerOf2(memory.stats_queue) || memory.stats_queue < 2) {
+        error_message = "memory.stats_queue must be a power of 2 (>= 2)";
+        return false;
+    }
+    if (!isPowerOf2(memory.ring_bytes) || memory.ring_bytes < 4096) {
+        error_message = "memory.ring_bytes must be a power of 2 (>= 4096)";
+        return false;
+    }
+    if (memory.hugepages != "none" && memory.hugepages != "transparent" &&
+        memory.hugepages != "2mb" && memory.hugepages != "1gb") {
+        error_message = "memory.hugepages must be 'none', 'transparent', '2mb' or '1gb'";
+        return false;
+    }
+
+    // Counters 검증
+    if (counters.max_counters < 1 || counters.max_counters > 4096) {
+        error_message = "counters.max_counters must be 1-4096";
+        return false;
+    }
+    if (counters.update_interval_ms < 10 || counters.update_interval_ms > 10000) {
+        error_message = "counters.update_interval_ms must be 10-10000";
+        return false;
+    }
+
+    // Validation 검증
+    if (validation.stage != "worker" && validation.stage != "receiver") {
+        error_message = "validation.stage must be 'worker' or 'receiver'";
+        return false;
+    }
+
+    // Publish 정책 검증
+    if (publish.policy != "retry" && publish.policy != "bounded" && publish.policy != "drop") {
+        error_message = "publish.policy must be 'retry', 'bounded' or 'drop'";
+        return false;
+    }
+    if (publish.timeout_ms <= 0) {
+        error_message = "publish.timeout_ms must be positive";
+        return false;
+    }
+    if (publish.batch_bytes < 0 || publish.batch_bytes > 0xFFFFFFFFLL || publish.batch_linger_us < 0) {
+        error_message = "publish.batch_bytes must be 0-4294967295 and publish.batch_linger_us non-negative";
+        return false;
+    }
+
+    // Multi-stream 검증 (channel/stream_id 쌍은 중복 불가)
+    std::set<std::pair<std::string, int>> seen_streams;
+    for (const auto& stream : streams) {
+        const std::string prefix = "stream." + stream.name;
+        if (stream.name.empty()) {
+            error_message = "stream section name is empty (use [stream.<name>])";
+            return false;
+        }
+        if (!validateChannel(stream.channel, prefix + ".channel"))
+            return false;
+        if (stream.stream_id <= 0) {
+            error_message = prefix + ".stream_id must be positive";
+            return false;
+        }
+        if (stream.worker_cpu < -1 || stream.worker_cpu >= CPU_SETSIZE) {
+            error_message = prefix + ".worker_cpu must be -1 or a valid CPU number";
+            return false;
+        }
+        if (!seen_streams.insert({stream.channel, stream.stream_id}).second) {
+            error_message = prefix + " duplicates another channel/stream_id pair";
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -100,6 +367,101 @@ void AeronSettings::print() const {
     std::cout << "\n[timeouts]" << std::endl;
     std::cout << "  idle_sleep_ms = " << idle_sleep_ms << std::endl;
     std::cout << "  message_timeout_ns = " << message_timeout_ns << std::endl;
+    std::cout << "\n[subscriber]" << std::endl;
+    std::cout << "  receive_mode = " << receive_mode << std::endl;
+    std::cout << "  overflow_policy = " << overflow_policy << std::endl;
+    for (const auto& stream : streams) {
+        std::cout << "\n[stream." << stream.name << "]" << std::endl;
+        std::cout << "  channel = " << stream.channel << std::endl;
+        std::cout << "  stream_id = " << stream.stream_id << std::endl;
+        std::cout << "  queue = " << (stream.dedicated_queue ? "dedicated" : "shared") << std::endl;
+        if (stream.worker_cpu >= 0) {
+            std::cout << "  worker_cpu = " << stream.worker_cpu << std::endl;
+        }
+    }
+    std::cout << "\n[idle]" << std::endl;
+    std::cout << "  subscriber = " << subscriber_idle.name << std::endl;
+    std::cout << "  worker = " << worker_idle.name << std::endl;
+    std::cout << "  monitor = " << monitor_idle.name << std::endl;
+    std::cout << "  publisher = " << publisher_idle.name << std::endl;
+    std::cout << "  sleep_ns = " << subscriber_idle.sleep_ns << std::endl;
+    std::cout << "  backoff_max_spins = " << subscriber_idle.backoff_max_spins << std::endl;
+    std::cout << "  backoff_max_yields = " << subscriber_idle.backoff_max_yields << std::endl;
+    std::cout << "  backoff_min_park_ns = " << subscriber_idle.backoff_min_park_ns << std::endl;
+    std::cout << "  backoff_max_park_ns = " << subscriber_idle.backoff_max_park_ns << std::endl;
+    std::cout << "  park_spin_ns = " << subscriber_idle.park_spin_ns
+              << ", park_timeout_ns = " << subscriber_idle.park_timeout_ns << std::endl;
+    std::cout << "\n[threads]" << std::endl;
+    std::cout << "  subscriber_cpu = " << subscriber_thread.cpu
+              << ", subscriber_priority = " << subscriber_thread.priority << std::endl;
+    std::cout << "  worker_cpu = " << worker_thread.cpu
+              << ", worker_priority = " << worker_thread.priority << std::endl;
+    std::cout << "  monitor_cpu = " << monitor_thread.cpu
+              << ", monitor_priority = " << monitor_thread.priority << std::endl;
+    std::cout << "  checkpoint_cpu = " << checkpoint_thread.cpu
+              << ", checkpoint_priority = " << checkpoint_thread.priority << std::endl;
+    std::cout << "  gap_fill_cpu = " << gap_fill_thread.cpu
+              << ", gap_fill_priority = " << gap_fill_thread.priority << std::endl;
+    std::cout << "  mlockall = " << (mlock_all ? "true" : "false") << std::endl;
+    std::cout << "  numa_first_touch = " << (numa_first_touch ? "true" : "false") << std::endl;
+    std::cout << "\n[clock]" << std::endl;
+    std::cout << "  source = " << clock.source << std::endl;
+    std::cout << "  calibration_interval_ms = " << clock.calibration_interval_ms << std::endl;
+    std::cout << "\n[gap_fill]" << std::endl;
+    std::cout << "  enabled = " << (gap_fill.enabled ? "true" : "false") << std::endl;
+    std::cout << "  replay_channel = " << gap_fill.replay_channel << std::endl;
+    std::cout << "  replay_stream_id = " << gap_fill.replay_stream_id << std::endl;
+    std::cout << "  max_replay_bytes = " << gap_fill.max_replay_bytes << std::endl;
+    std::cout << "  timeout_ms = " << gap_fill.timeout_ms << std::endl;
+    std::cout << "\n[workers]" << std::endl;
+    std::cout << "  shards = " << workers.shards << std::endl;
+    std::cout << "  shard_key = " << workers.key << std::endl;
+    if (workers.key == "payload") {
+        std::cout << "  payload_offset = " << workers.payload_offset
+                  << ", payload_width = " << workers.payload_width << std::endl;
+    }
+    if (!workers.cpus.empty()) {
+        std::cout << "  cpus =";
+        for (int cpu : workers.cpus) {
+            std::cout << " " << cpu;
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "\n[memory]" << std::endl;
+    std::cout << "  pool_small = " << memory.pool_small
+              << ", pool_medium = " << memory.pool_medium
+              << ", pool_large = " << memory.pool_large
+              << ", pool_huge = " << memory.pool_huge << std::endl;
+    std::cout << "  message_queue = " << memory.message_queue
+              << ", view_queue = " << memory.view_queue
+              << ", stats_queue = " << memory.stats_queue << std::endl;
+    std::cout << "  ring_bytes = " << memory.ring_bytes << std::endl;
+    std::cout << "  hugepages = " << memory.hugepages << std::endl;
+    std::cout << "  prefault = " << (memory.prefault ? "true" : "false")
+              << ", lock = " << (memory.lock ? "true" : "false") << std::endl;
+    std::cout << "\n[counters]" << std::endl;
+    std::cout << "  enabled = " << (counters.enabled ? "true" : "false") << std::endl;
+    if (counters.enabled) {
+        std::cout << "  file = " << counters.path(aeron_dir) << std::endl;
+        std::cout << "  max_counters = " << counters.max_counters
+                  << ", update_interval_ms = " << counters.update_interval_ms << std::endl;
+    }
+    std::cout << "  print_stats = " << (counters.print_stats ? "true" : "false") << std::endl;
+    std::cout << "\n[validation]" << std::endl;
+    std::cout << "  enabled = " << (validation.enabled ? "true" : "false")
+              << ", stage = " << validation.stage << std::endl;
+    std::cout << "\n[publish]" << std::endl;
+    std::cout << "  policy = " << publish.policy;
+    if (publish.policy == "bounded") {
+        std::cout << ", timeout_ms = " << publish.timeout_ms;
+    }
+    std::cout << std::endl;
+    std::cout << "  batch = " << (publish.batch ? "true" : "false");
+    if (publish.batch) {
+        std::cout << ", batch_bytes = " << publish.batch_bytes
+                  << ", batch_linger_us = " << publish.batch_linger_us;
+    }
+    std::cout << std::endl;
     std::cout << "========================================" << std::endl;
 }
 
@@ -183,6 +545,260 @@ AeronSettings ConfigLoader::loadFromFile(const std::string& filepath) {
         }
     }
 
+    // [subscriber] 섹션
+    if (ini_data.count("subscriber")) {
+        const auto& section = ini_data["subscriber"];
+        if (section.count("receive_mode")) {
+            settings.receive_mode = section.at("receive_mode");
+        }
+        if (section.count("overflow_policy")) {
+            settings.overflow_policy = section.at("overflow_policy");
+        }
+    }
+
+    // [idle] 섹션 (sleep/backoff 파라미터는 세 루프 공통)
+    if (ini_data.count("idle")) {
+        const auto& section = ini_data["idle"];
+        IdleStrategyConfig* loops[] = {
+            &settings.subscriber_idle, &settings.worker_idle, &settings.monitor_idle,
+            &settings.publisher_idle
+        };
+        for (IdleStrategyConfig* idle : loops) {
+            if (section.count("sleep_ns")) {
+                idle->sleep_ns = parseLongLong(section.at("sleep_ns"), "idle.sleep_ns");
+            }
+            if (section.count("backoff_max_spins")) {
+                idle->backoff_max_spins = parseLongLong(section.at("backoff_max_spins"), "idle.backoff_max_spins");
+            }
+            if (section.count("backoff_max_yields")) {
+                idle->backoff_max_yields = parseLongLong(section.at("backoff_max_yields"), "idle.backoff_max_yields");
+            }
+            if (section.count("backoff_min_park_ns")) {
+                idle->backoff_min_park_ns = parseLongLong(section.at("backoff_min_park_ns"), "idle.backoff_min_park_ns");
+            }
+            if (section.count("backoff_max_park_ns")) {
+                idle->backoff_max_park_ns = parseLongLong(section.at("backoff_max_park_ns"), "idle.backoff_max_park_ns");
+            }
+            if (section.count("park_spin_ns")) {
+                idle->park_spin_ns = parseLongLong(section.at("park_spin_ns"), "idle.park_spin_ns");
+            }
+            if (section.count("park_timeout_ns")) {
+                idle->park_timeout_ns = parseLongLong(section.at("park_timeout_ns"), "idle.park_timeout_ns");
+            }
+        }
+        if (section.count("subscriber")) {
+            settings.subscriber_idle.name = section.at("subscriber");
+        }
+        if (section.count("worker")) {
+            settings.worker_idle.name = section.at("worker");
+        }
+        if (section.count("monitor")) {
+            settings.monitor_idle.name = section.at("monitor");
+        }
+        if (section.count("publisher")) {
+            settings.publisher_idle.name = section.at("publisher");
+        }
+    }
+
+    // [threads] 섹션
+    if (ini_data.count("threads")) {
+        const auto& section = ini_data["threads"];
+        struct { const char* name; ThreadSettings* thread; } threads[] = {
+            {"subscriber", &settings.subscriber_thread},
+            {"worker", &settings.worker_thread},
+            {"monitor", &settings.monitor_thread},
+            {"checkpoint", &settings.checkpoint_thread},
+            {"gap_fill", &settings.gap_fill_thread},
+        };
+        for (const auto& entry : threads) {
+            const std::string cpu_key = std::string(entry.name) + "_cpu";
+            const std::string priority_key = std::string(entry.name) + "_priority";
+            if (section.count(cpu_key)) {
+                entry.thread->cpu = parseInt(section.at(cpu_key), "threads." + cpu_key);
+            }
+            if (section.count(priority_key)) {
+                entry.thread->priority = parseInt(section.at(priority_key), "threads." + priority_key);
+            }
+        }
+        if (section.count("mlockall")) {
+            settings.mlock_all = parseBool(section.at("mlockall"), "threads.mlockall");
+        }
+        if (section.count("numa_first_touch")) {
+            settings.numa_first_touch = parseBool(section.at("numa_first_touch"), "threads.numa_first_touch");
+        }
+    }
+
+    // [clock] 섹션
+    if (ini_data.count("clock")) {
+        const auto& section = ini_data["clock"];
+        if (section.count("source")) {
+            settings.clock.source = section.at("source");
+        }
+        if (section.count("calibration_interval_ms")) {
+            settings.clock.calibration_interval_ms = parseLongLong(section.at("calibration_interval_ms"), "clock.calibration_interval_ms");
+        }
+    }
+
+    // [gap_fill] 섹션
+    if (ini_data.count("gap_fill")) {
+        const auto& section = ini_data["gap_fill"];
+        if (section.count("enabled")) {
+            settings.gap_fill.enabled = parseBool(section.at("enabled"), "gap_fill.enabled");
+        }
+        if (section.count("replay_channel")) {
+            settings.gap_fill.replay_channel = section.at("replay_channel");
+        }
+        if (section.count("replay_stream_id")) {
+            settings.gap_fill.replay_stream_id = parseInt(section.at("replay_stream_id"), "gap_fill.replay_stream_id");
+        }
+        if (section.count("max_replay_bytes")) {
+            settings.gap_fill.max_replay_bytes = parseLongLong(section.at("max_replay_bytes"), "gap_fill.max_replay_bytes");
+        }
+        if (section.count("timeout_ms")) {
+            settings.gap_fill.timeout_ms = parseLongLong(section.at("timeout_ms"), "gap_fill.timeout_ms");
+        }
+    }
+
+    // [workers] 섹션
+    if (ini_data.count("workers")) {
+        const auto& section = ini_data["workers"];
+        if (section.count("shards")) {
+            settings.workers.shards = parseInt(section.at("shards"), "workers.shards");
+        }
+        if (section.count("shard_key")) {
+            settings.workers.key = section.at("shard_key");
+        }
+        if (section.count("payload_offset")) {
+            settings.workers.payload_offset = parseInt(section.at("payload_offset"), "workers.payload_offset");
+        }
+        if (section.count("payload_width")) {
+            settings.workers.payload_width = parseInt(section.at("payload_width"), "workers.payload_width");
+        }
+        if (section.count("cpus")) {
+            // 쉼표 구분 목록 (shard 순서)
+            std::stringstream list(section.at("cpus"));
+            std::string item;
+            settings.workers.cpus.clear();
+            while (std::getline(list, item, ',')) {
+                item = trim(item);
+                if (!item.empty()) {
+                    settings.workers.cpus.push_back(parseInt(item, "workers.cpus"));
+                }
+            }
+        }
+    }
+
+    // [memory] 섹션
+    if (ini_data.count("memory")) {
+        const auto& section = ini_data["memory"];
+        struct { const char* key; long long* value; } sizes[] = {
+            {"pool_small", &settings.memory.pool_small},
+            {"pool_medium", &settings.memory.pool_medium},
+            {"pool_large", &settings.memory.pool_large},
+            {"pool_huge", &settings.memory.pool_huge},
+            {"message_queue", &settings.memory.message_queue},
+            {"view_queue", &settings.memory.view_queue},
+            {"stats_queue", &settings.memory.stats_queue},
+            {"ring_bytes", &settings.memory.ring_bytes},
+        };
+        for (const auto& size : sizes) {
+            if (section.count(size.key)) {
+                *size.value = parseLongLong(section.at(size.key), std::string("memory.") + size.key);
+            }
+        }
+        if (section.count("hugepages")) {
+            settings.memory.hugepages = section.at("hugepages");
+        }
+        if (section.count("prefault")) {
+            settings.memory.prefault = parseBool(section.at("prefault"), "memory.prefault");
+        }
+        if (section.count("lock")) {
+            settings.memory.lock = parseBool(section.at("lock"), "memory.lock");
+        }
+    }
+
+    // [counters] 섹션
+    if (ini_data.count("counters")) {
+        const auto& section = ini_data["counters"];
+        if (section.count("enabled")) {
+            settings.counters.enabled = parseBool(section.at("enabled"), "counters.enabled");
+        }
+        if (section.count("file")) {
+            settings.counters.file = section.at("file");
+        }
+        if (section.count("max_counters")) {
+            settings.counters.max_counters = parseLongLong(section.at("max_counters"),
+                                                           "counters.max_counters");
+        }
+        if (section.count("update_interval_ms")) {
+            settings.counters.update_interval_ms = parseLongLong(section.at("update_interval_ms"),
+                                                                 "counters.update_interval_ms");
+        }
+        if (section.count("print_stats")) {
+            settings.counters.print_stats = parseBool(section.at("print_stats"), "counters.print_stats");
+        }
+    }
+
+    // [validation] 섹션
+    if (ini_data.count("validation")) {
+        const auto& section = ini_data["validation"];
+        if (section.count("enabled")) {
+            settings.validation.enabled = parseBool(section.at("enabled"), "validation.enabled");
+        }
+        if (section.count("stage")) {
+            settings.validation.stage = section.at("stage");
+        }
+    }
+
+    // [publish] 섹션
+    if (ini_data.count("publish")) {
+        const auto& section = ini_data["publish"];
+        if (section.count("policy")) {
+            settings.publish.policy = section.at("policy");
+        }
+        if (section.count("timeout_ms")) {
+            settings.publish.timeout_ms = parseLongLong(section.at("timeout_ms"), "publish.timeout_ms");
+        }
+        if (section.count("batch")) {
+            settings.publish.batch = parseBool(section.at("batch"), "publish.batch");
+        }
+        if (section.count("batch_bytes")) {
+            settings.publish.batch_bytes = parseLongLong(section.at("batch_bytes"), "publish.batch_bytes");
+        }
+        if (section.count("batch_linger_us")) {
+            settings.publish.batch_linger_us =
+                parseLongLong(section.at("batch_linger_us"), "publish.batch_linger_us");
+        }
+    }
+
+    // [stream.<name>] 섹션들 (이름순, 없으면 [subscription] 단일 스트림)
+    for (const auto& entry : ini_data) {
+        const std::string& section_name = entry.first;
+        if (section_name.compare(0, 7, "stream.") != 0) {
+            continue;
+        }
+        const auto& section = entry.second;
+        StreamSettings stream;
+        stream.name = section_name.substr(7);
+        stream.channel = section.count("channel")
+            ? section.at("channel") : settings.subscription_channel;
+        if (!section.count("stream_id")) {
+            throw std::runtime_error("Missing '" + section_name + ".stream_id'");
+        }
+        stream.stream_id = parseInt(section.at("stream_id"), section_name + ".stream_id");
+        if (section.count("queue")) {
+            const std::string& queue = section.at("queue");
+            if (queue != "shared" && queue != "dedicated") {
+                throw std::runtime_error("'" + section_name + ".queue' must be 'shared' or 'dedicated'");
+            }
+            stream.dedicated_queue = (queue == "dedicated");
+        }
+        if (section.count("worker_cpu")) {
+            stream.worker_cpu = parseInt(section.at("worker_cpu"), section_name + ".worker_cpu");
+        }
+        settings.streams.push_back(stream);
+    }
+
     // 환경변수로 override
     overrideFromEnvironment(settings);
 
@@ -306,6 +922,18 @@ long long ConfigLoader::parseLongLong(const std::string& str, const std::string&
     }
 }
 
+bool ConfigLoader::parseBool(const std::string& str, const std::string& key) {
+    std::string lower = str;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    if (lower == "true" || lower == "yes" || lower == "on" || lower == "1") {
+        return true;
+    }
+    if (lower == "false" || lower == "no" || lower == "off" || lower == "0") {
+        return false;
+    }
+    throw std::runtime_error("Failed to parse bool for '" + key + "': " + str);
+}
+
 void ConfigLoader::generateTemplate(const std::string& filepath,
                                      const std::string& template_type) {
     std::ofstream file(filepath);
@@ -396,6 +1024,113 @@ void ConfigLoader::generateTemplate(const std::string& filepath,
     file << "[timeouts]\n";
     file << "idle_sleep_ms = 1\n";
     file << "message_timeout_ns = 10000000000\n";
+    file << "\n";
+    file << "[subscriber]\n";
+    file << "# copy = memcpy into buffer pool, in-place = read term buffer directly,\n";
+    file << "# ring = memcpy into one contiguous byte ring (variable-length records)\n";
+    file << "receive_mode = copy\n";
+    file << "# drop = count and drop when pool/queue is full (market data)\n";
+    file << "# backpressure = stop polling, publisher is flow-controlled (lossless)\n";
+    file << "overflow_policy = drop\n";
+    file << "\n";
+    file << "# Multi-stream: one [stream.<name>] section per channel/stream pair\n";
+    file << "# (replaces [subscription]; queue = shared | dedicated)\n";
+    file << "# [stream.trades]\n";
+    file << "# channel = aeron:udp?endpoint=localhost:40456\n";
+    file << "# stream_id = 10\n";
+    file << "# queue = dedicated\n";
+    file << "\n";
+    file << "[idle]\n";
+    file << "# noop | spin | yield | backoff | sleeping | park (latency vs. CPU trade-off)\n";
+    file << "# park (worker): spin park_spin_ns, then sleep on a futex the subscriber rings\n";
+    file << "subscriber = sleeping\n";
+    file << "worker = backoff\n";
+    file << "monitor = sleeping\n";
+    file << "# publisher: wait between publish retries ([publish] retry / bounded)\n";
+    file << "publisher = backoff\n";
+    file << "sleep_ns = 1000000\n";
+    file << "backoff_max_spins = 10\n";
+    file << "backoff_max_yields = 100\n";
+    file << "backoff_min_park_ns = 1000\n";
+    file << "backoff_max_park_ns = 10000\n";
+    file << "park_spin_ns = 20000\n";
+    file << "park_timeout_ns = 1000000\n";
+    file << "\n";
+    file << "[threads]\n";
+    file << "# <thread>_cpu: pin to CPU (-1 = no pinning)\n";
+    file << "# <thread>_priority: SCHED_FIFO 1-99 (0 = normal, needs CAP_SYS_NICE)\n";
+    file << "subscriber_cpu = -1\n";
+    file << "subscriber_priority = 0\n";
+    file << "worker_cpu = -1\n";
+    file << "worker_priority = 0\n";
+    file << "monitor_cpu = -1\n";
+    file << "checkpoint_cpu = -1\n";
+    file << "gap_fill_cpu = -1\n";
+    file << "mlockall = false\n";
+    file << "numa_first_touch = true\n";
+    file << "\n";
+    file << "[clock]\n";
+    file << "# auto = invariant TSC if available, else CLOCK_REALTIME (vDSO)\n";
+    file << "source = auto\n";
+    file << "calibration_interval_ms = 1000\n";
+    file << "\n";
+    file << "[gap_fill]\n";
+    file << "# Replay missing ranges from the Archive on a separate thread\n";
+    file << "# replay_channel: subscriber address reachable from the Archive\n";
+    file << "enabled = true\n";
+    file << "replay_channel = aeron:udp?endpoint=localhost:40458\n";
+    file << "replay_stream_id = 21\n";
+    file << "max_replay_bytes = 16777216\n";
+    file << "timeout_ms = 2000\n";
+    file << "\n";
+    file << "[workers]\n";
+    file << "# Shard the shared queue over N workers by key (per-key order kept)\n";
+    file << "# shard_key: session | publisher | payload (payload_offset/payload_width bytes)\n";
+    file << "shards = 1\n";
+    file << "shard_key = session\n";
+    file << "# cpus = 4,5,6,7\n";
+    file << "\n";
+    file << "[memory]\n";
+    file << "# Buffers per size class (256 B / 4 KB / 64 KB / 1 MB)\n";
+    file << "pool_small = 4096\n";
+    file << "pool_medium = 1024\n";
+    file << "pool_large = 64\n";
+    file << "pool_huge = 8\n";
+    file << "# Queue slots / ring bytes (powers of 2)\n";
+    file << "message_queue = 4096\n";
+    file << "view_queue = 4096\n";
+    file << "stats_queue = 16384\n";
+    file << "ring_bytes = 4194304\n";
+    file << "# none | transparent | 2mb | 1gb (2mb/1gb need reserved hugepages)\n";
+    file << "hugepages = none\n";
+    file << "prefault = true\n";
+    file << "lock = false\n";
+    file << "\n";
+    file << "[counters]\n";
+    file << "# Live counters for aeron_substat (default file: <aeron_dir>/subscriber.counters)\n";
+    file << "enabled = true\n";
+    file << "# file = /dev/shm/aeron/subscriber.counters\n";
+    file << "max_counters = 256\n";
+    file << "update_interval_ms = 100\n";
+    file << "# false: no periodic stats on stdout (use aeron_substat)\n";
+    file << "print_stats = true\n";
+    file << "\n";
+    file << "[validation]\n";
+    file << "# magic / version / length / type + checksum when the publisher flags one\n";
+    file << "enabled = true\n";
+    file << "# worker: batched on the worker thread | receiver: on the subscriber thread\n";
+    file << "stage = worker\n";
+    file << "\n";
+    file << "[publish]\n";
+    file << "# Publisher on BACK_PRESSURED / NOT_CONNECTED / ADMIN_ACTION:\n";
+    file << "# retry = until sent | bounded = retry up to timeout_ms, then drop | drop = at once\n";
+    file << "policy = bounded\n";
+    file << "timeout_ms = 1000\n";
+    file << "# Pack small messages into one MSG_BATCH frame (sent when full or after linger)\n";
+    file << "# batch_bytes = 0: publication maxPayloadLength (one MTU)\n";
+    file << "batch = false\n";
+    file << "batch_bytes = 0\n";
+    file << "batch_linger_us = 50\n";
 
     file.close();
     std::cout << "Template config file created: " << filepath << std::endl;
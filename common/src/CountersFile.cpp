@@ -0,0 +1,213 @@
+#include "CountersFile.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace aeron {
+namespace example {
+
+using namespace counters_layout;
+
+namespace {
+
+int64_t realtimeMs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
+std::runtime_error fileError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+}
+
+}  // namespace
+
+thread_local std::atomic<int64_t> Counter::scratch_{0};
+
+// ============================================================================
+// CountersFile (writer)
+// ============================================================================
+
+CountersFile::CountersFile(const std::string& path, size_t max_counters)
+    : path_(path)
+    , max_counters_(max_counters)
+    , length_(fileLength(max_counters)) {
+
+    if (max_counters == 0 || max_counters > MAX_COUNTERS) {
+        throw std::invalid_argument("Counters file needs 1-" + std::to_string(MAX_COUNTERS)
+                                    + " counters (got " + std::to_string(max_counters) + ")");
+    }
+
+    // 이전 실행의 파일은 reader 가 아직 매핑하고 있을 수 있음 → truncate 대신 새 inode
+    if (unlink(path.c_str()) != 0 && errno != ENOENT) {
+        throw fileError("Failed to remove old counters file", path);
+    }
+
+    const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        throw fileError("Failed to create counters file", path);
+    }
+    if (ftruncate(fd, static_cast<off_t>(length_)) != 0) {
+        const std::runtime_error error = fileError("Failed to size counters file", path);
+        close(fd);
+        throw error;
+    }
+
+    void* base = mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        throw fileError("Failed to map counters file", path);
+    }
+
+    // 새 파일은 0 으로 채워져 있음 (atomic 들의 초기값 0 그대로 사용)
+    base_ = static_cast<uint8_t*>(base);
+    header_ = reinterpret_cast<Header*>(base_);
+    metadata_ = reinterpret_cast<Metadata*>(base_ + HEADER_LENGTH);
+    values_ = reinterpret_cast<Value*>(base_ + HEADER_LENGTH + max_counters * METADATA_LENGTH);
+
+    header_->version = VERSION;
+    header_->max_counters = static_cast<uint32_t>(max_counters);
+    header_->pid = static_cast<int64_t>(getpid());
+    header_->start_time_ms = realtimeMs();
+    header_->heartbeat_ms.store(header_->start_time_ms, std::memory_order_relaxed);
+
+    // magic 은 마지막 (reader 는 magic 확인 후 나머지를 읽음)
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = MAGIC;
+
+    std::cout << "Counters file: " << path_ << " (" << max_counters_ << " counters, "
+              << (length_ >> 10) << " KB)" << std::endl;
+}
+
+CountersFile::~CountersFile() {
+    if (base_) {
+        munmap(base_, length_);
+    }
+}
+
+Counter CountersFile::allocate(const std::string& label, CounterType type) {
+    if (count_ >= max_counters_) {
+        std::cerr << "WARNING: Counters file full (" << max_counters_
+                  << "), '" << label << "' not published" << std::endl;
+        return Counter();
+    }
+
+    Metadata& metadata = metadata_[count_];
+    const size_t length = std::min(label.size(), MAX_LABEL_LENGTH);
+    std::memcpy(metadata.label, label.data(), length);
+    metadata.label_length = static_cast<uint32_t>(length);
+    metadata.type = static_cast<uint32_t>(type);
+
+    std::atomic<int64_t>* slot = &values_[count_].value;
+    slot->store(0, std::memory_order_relaxed);
+
+    // metadata 가 보인 뒤에 count 증가
+    count_++;
+    header_->counter_count.store(static_cast<uint32_t>(count_), std::memory_order_release);
+    return Counter(slot);
+}
+
+void CountersFile::heartbeat() noexcept {
+    header_->heartbeat_ms.store(realtimeMs(), std::memory_order_release);
+}
+
+// ============================================================================
+// CountersReader
+// ============================================================================
+
+CountersReader::CountersReader(const std::string& path)
+    : path_(path) {
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw fileError("Failed to open counters file", path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        const std::runtime_error error = fileError("Failed to stat counters file", path);
+        close(fd);
+        throw error;
+    }
+    if (static_cast<size_t>(st.st_size) < HEADER_LENGTH) {
+        close(fd);
+        throw std::runtime_error("Counters file " + path + " is too small (not initialized?)");
+    }
+
+    length_ = static_cast<size_t>(st.st_size);
+    inode_ = static_cast<uint64_t>(st.st_ino);
+    void* base = mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        throw fileError("Failed to map counters file", path);
+    }
+
+    base_ = static_cast<const uint8_t*>(base);
+    header_ = reinterpret_cast<const Header*>(base_);
+
+    if (header_->magic != MAGIC) {
+        munmap(const_cast<uint8_t*>(base_), length_);
+        throw std::runtime_error("Not a counters file (or still initializing): " + path);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (header_->version != VERSION) {
+        const uint32_t version = header_->version;
+        munmap(const_cast<uint8_t*>(base_), length_);
+        throw std::runtime_error("Counters file version " + std::to_string(version)
+                                 + " (expected " + std::to_string(VERSION) + "): " + path);
+    }
+    if (fileLength(header_->max_counters) > length_) {
+        munmap(const_cast<uint8_t*>(base_), length_);
+        throw std::runtime_error("Counters file is truncated: " + path);
+    }
+
+    metadata_ = reinterpret_cast<const Metadata*>(base_ + HEADER_LENGTH);
+    values_ = reinterpret_cast<const Value*>(
+        base_ + HEADER_LENGTH + header_->max_counters * METADATA_LENGTH);
+}
+
+CountersReader::~CountersReader() {
+    if (base_) {
+        munmap(const_cast<uint8_t*>(base_), length_);
+    }
+}
+
+size_t CountersReader::count() const noexcept {
+    const uint32_t count = header_->counter_count.load(std::memory_order_acquire);
+    return std::min<size_t>(count, header_->max_counters);
+}
+
+std::string CountersReader::label(size_t index) const {
+    const Metadata& metadata = metadata_[index];
+    return std::string(metadata.label, std::min<size_t>(metadata.label_length, MAX_LABEL_LENGTH));
+}
+
+CounterType CountersReader::type(size_t index) const noexcept {
+    return static_cast<CounterType>(metadata_[index].type);
+}
+
+int64_t CountersReader::value(size_t index) const noexcept {
+    return values_[index].value.load(std::memory_order_relaxed);
+}
+
+bool CountersReader::isWriterAlive() const noexcept {
+    const pid_t pid = static_cast<pid_t>(header_->pid);
+    return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+bool CountersReader::isReplaced() const noexcept {
+    struct stat st;
+    return stat(path_.c_str(), &st) != 0 || static_cast<uint64_t>(st.st_ino) != inode_;
+}
+
+} // namespace example
+} // namespace aeron
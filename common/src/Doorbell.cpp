@@ -0,0 +1,41 @@
+#include "Doorbell.h"
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace aeron {
+namespace example {
+
+namespace {
+
+uint32_t* futexWord(std::atomic<uint32_t>& state) {
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32-bit");
+    return reinterpret_cast<uint32_t*>(&state);
+}
+
+}  // namespace
+
+void Doorbell::wake() noexcept {
+    // 여러 producer 가 동시에 봐도 syscall 은 한 번
+    if (state_.exchange(AWAKE, std::memory_order_acq_rel) != PARKED) {
+        return;
+    }
+    wakeups_.fetch_add(1, std::memory_order_relaxed);
+    syscall(SYS_futex, futexWord(state_), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+bool Doorbell::wait(int64_t timeout_ns) noexcept {
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeout_ns / 1000000000LL);
+    timeout.tv_nsec = static_cast<long>(timeout_ns % 1000000000LL);
+
+    // state_ != PARKED (이미 ring 됨) → EAGAIN 으로 즉시 반환
+    const long rc = syscall(SYS_futex, futexWord(state_), FUTEX_WAIT_PRIVATE,
+                            PARKED, &timeout, nullptr, 0);
+    return !(rc != 0 && errno == ETIMEDOUT);
+}
+
+} // namespace example
+} // namespace aeron
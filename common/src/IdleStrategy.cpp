@@ -0,0 +1,159 @@
+#include "IdleStrategy.h"
+#include "NanoClock.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <sched.h>
+#include <time.h>
+#include <utility>
+
+namespace aeron {
+namespace example {
+
+// ============================================================================
+// IdleStrategy 공통
+// ============================================================================
+
+IdleStats IdleStrategy::stats() const {
+    IdleStats s;
+    s.idle_calls = idle_calls_.load(std::memory_order_relaxed);
+    s.busy_calls = busy_calls_.load(std::memory_order_relaxed);
+    s.spins = spins_.load(std::memory_order_relaxed);
+    s.yields = yields_.load(std::memory_order_relaxed);
+    s.parks = parks_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void IdleStrategy::printStatistics(const std::string& label) const {
+    IdleStats s = stats();
+    std::cout << "\n=== Idle Strategy (" << label << ": " << name() << ") ===" << std::endl;
+    std::cout << "Busy polls:   " << s.busy_calls << std::endl;
+    std::cout << "Idle polls:   " << s.idle_calls << std::endl;
+    std::cout << "Busy ratio:   " << std::fixed << std::setprecision(1)
+              << (s.busyRatio() * 100.0) << "%" << std::endl;
+    std::cout << "Spins:        " << s.spins << std::endl;
+    std::cout << "Yields:       " << s.yields << std::endl;
+    std::cout << "Parks:        " << s.parks << std::endl;
+}
+
+void IdleStrategy::parkNanos(int64_t ns) {
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000LL);
+    nanosleep(&ts, nullptr);
+}
+
+bool IdleStrategy::isValidName(const std::string& name) {
+    return name == "noop" || name == "spin" || name == "yield" ||
+           name == "backoff" || name == "sleeping" || name == "park";
+}
+
+std::unique_ptr<IdleStrategy> IdleStrategy::create(const IdleStrategyConfig& config) {
+    if (config.name == "noop") {
+        return std::make_unique<NoOpIdleStrategy>();
+    }
+    if (config.name == "spin") {
+        return std::make_unique<BusySpinIdleStrategy>();
+    }
+    if (config.name == "yield") {
+        return std::make_unique<YieldingIdleStrategy>();
+    }
+    if (config.name == "backoff") {
+        return std::make_unique<BackoffIdleStrategy>(
+            config.backoff_max_spins, config.backoff_max_yields,
+            config.backoff_min_park_ns, config.backoff_max_park_ns);
+    }
+    if (config.name == "sleeping") {
+        return std::make_unique<SleepingIdleStrategy>(config.sleep_ns);
+    }
+    if (config.name == "park") {
+        return std::make_unique<ParkingIdleStrategy>(config.park_spin_ns, config.park_timeout_ns);
+    }
+    throw std::runtime_error("Unknown idle strategy: " + config.name);
+}
+
+// ============================================================================
+// Strategies
+// ============================================================================
+
+void YieldingIdleStrategy::onIdle() {
+    bump(yields_);
+    sched_yield();
+}
+
+void SleepingIdleStrategy::onIdle() {
+    bump(parks_);
+    parkNanos(sleep_ns_);
+}
+
+BackoffIdleStrategy::BackoffIdleStrategy(int64_t max_spins, int64_t max_yields,
+                                         int64_t min_park_ns, int64_t max_park_ns)
+    : max_spins_(max_spins)
+    , max_yields_(max_yields)
+    , min_park_ns_(min_park_ns)
+    , max_park_ns_(std::max(min_park_ns, max_park_ns))
+    , spin_count_(0)
+    , yield_count_(0)
+    , park_ns_(min_park_ns) {
+}
+
+void BackoffIdleStrategy::onIdle() {
+    if (spin_count_ < max_spins_) {
+        spin_count_++;
+        bump(spins_);
+        cpuPause();
+    } else if (yield_count_ < max_yields_) {
+        yield_count_++;
+        bump(yields_);
+        sched_yield();
+    } else {
+        bump(parks_);
+        parkNanos(park_ns_);
+        park_ns_ = std::min(park_ns_ * 2, max_park_ns_);
+    }
+}
+
+void BackoffIdleStrategy::reset() {
+    spin_count_ = 0;
+    yield_count_ = 0;
+    park_ns_ = min_park_ns_;
+}
+
+ParkingIdleStrategy::ParkingIdleStrategy(int64_t spin_ns, int64_t park_timeout_ns)
+    : spin_ns_(spin_ns)
+    , park_timeout_ns_(park_timeout_ns) {
+}
+
+void ParkingIdleStrategy::attach(Doorbell* doorbell, std::function<bool()> has_work) {
+    doorbell_ = doorbell;
+    has_work_ = std::move(has_work);
+}
+
+void ParkingIdleStrategy::onIdle() {
+    // 1. Spin budget (트래픽이 막 끊긴 직후는 spin 으로 반응)
+    const int64_t now = NanoClock::nanoTime();
+    if (spin_start_ns_ == 0) {
+        spin_start_ns_ = now;
+    }
+    if (now - spin_start_ns_ < spin_ns_) {
+        bump(spins_);
+        cpuPause();
+        return;
+    }
+
+    // 2. Futex park (producer ring 또는 timeout 까지)
+    bump(parks_);
+    if (doorbell_) {
+        doorbell_->park(park_timeout_ns_, has_work_);
+    } else {
+        parkNanos(park_timeout_ns_);
+    }
+}
+
+void ParkingIdleStrategy::reset() {
+    spin_start_ns_ = 0;
+}
+
+} // namespace example
+} // namespace aeron
@@ -0,0 +1,185 @@
+#include "MemoryArena.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <sys/mman.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace aeron {
+namespace example {
+
+namespace {
+
+constexpr size_t SMALL_PAGE = 4096;
+constexpr size_t HUGE_PAGE_2MB = 2UL * 1024 * 1024;
+constexpr size_t HUGE_PAGE_1GB = 1024UL * 1024 * 1024;
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+// ============================================================================
+// MemoryConfig
+// ============================================================================
+
+HugePages MemoryConfig::parseHugePages(const std::string& name) {
+    if (name == "none") return HugePages::NONE;
+    if (name == "transparent") return HugePages::TRANSPARENT;
+    if (name == "2mb") return HugePages::HUGE_2MB;
+    if (name == "1gb") return HugePages::HUGE_1GB;
+    throw std::invalid_argument("Unknown hugepages: " + name
+                                + " (none | transparent | 2mb | 1gb)");
+}
+
+const char* MemoryConfig::hugePagesName(HugePages pages) {
+    switch (pages) {
+        case HugePages::TRANSPARENT: return "transparent";
+        case HugePages::HUGE_2MB:    return "2mb";
+        case HugePages::HUGE_1GB:    return "1gb";
+        default:                     return "none";
+    }
+}
+
+// ============================================================================
+// MemoryArena
+// ============================================================================
+
+MemoryArena::MemoryArena(const MemoryConfig& config)
+    : config_(config)
+    , page_size_(config.hugepages == HugePages::HUGE_1GB ? HUGE_PAGE_1GB
+                 : config.hugepages == HugePages::HUGE_2MB ? HUGE_PAGE_2MB
+                 : SMALL_PAGE) {
+}
+
+MemoryArena::~MemoryArena() {
+    for (const Chunk& chunk : chunks_) {
+        munmap(chunk.base, chunk.size);
+    }
+}
+
+void* MemoryArena::allocate(size_t bytes, size_t alignment) {
+    if (bytes == 0) {
+        bytes = 1;
+    }
+
+    // 마지막 chunk 에 들어가면 bump
+    if (!chunks_.empty()) {
+        Chunk& chunk = chunks_.back();
+        const size_t offset = roundUp(chunk.used, alignment);
+        if (offset + bytes <= chunk.size) {
+            chunk.used = offset + bytes;
+            used_bytes_ += bytes;
+            return chunk.base + offset;
+        }
+    }
+
+    chunks_.push_back(mapChunk(bytes));
+    Chunk& chunk = chunks_.back();
+    chunk.used = bytes;
+    used_bytes_ += bytes;
+    return chunk.base;
+}
+
+MemoryArena::Chunk MemoryArena::mapChunk(size_t min_bytes) {
+    const bool hugetlb = config_.hugepages == HugePages::HUGE_2MB
+                      || config_.hugepages == HugePages::HUGE_1GB;
+    void* base = MAP_FAILED;
+    size_t size = 0;
+
+    if (hugetlb) {
+        size = roundUp(min_bytes, page_size_);
+        const int page_shift = page_size_ == HUGE_PAGE_1GB ? 30 : 21;
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT),
+                    -1, 0);
+        if (base == MAP_FAILED) {
+            std::cerr << "WARNING: " << (size >> 20) << " MB hugetlb mapping ("
+                      << MemoryConfig::hugePagesName(config_.hugepages) << " pages) failed: "
+                      << std::strerror(errno)
+                      << " - falling back to transparent hugepages" << std::endl;
+            fallbacks_++;
+        }
+    }
+    const bool huge_mapped = base != MAP_FAILED;
+
+    if (!huge_mapped) {
+        // 2 MB 정렬 영역 (THP 가 가능한 한 전부 hugepage 로 채우도록)
+        size = roundUp(min_bytes, HUGE_PAGE_2MB);
+        const size_t padded = size + HUGE_PAGE_2MB;
+        void* raw = mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            std::cerr << "ERROR: mmap of " << padded << " bytes failed: "
+                      << std::strerror(errno) << std::endl;
+            throw std::bad_alloc();
+        }
+
+        const uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t aligned = roundUp(start, HUGE_PAGE_2MB);
+        if (aligned > start) {
+            munmap(raw, aligned - start);
+        }
+        const size_t tail = padded - (aligned - start) - size;
+        if (tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+        base = reinterpret_cast<void*>(aligned);
+
+        if (config_.hugepages != HugePages::NONE) {
+            madvise(base, size, MADV_HUGEPAGE);
+        }
+    }
+
+    uint8_t* bytes = static_cast<uint8_t*>(base);
+
+    if (config_.prefault) {
+        // 페이지마다 한 번 write → 지금 이 스레드의 NUMA 노드에 fault-in
+        const size_t stride = huge_mapped ? page_size_ : SMALL_PAGE;
+        for (size_t offset = 0; offset < size; offset += stride) {
+            bytes[offset] = 0;
+        }
+    }
+
+    if (config_.lock) {
+        if (mlock(base, size) == 0) {
+            locked_bytes_ += size;
+        } else {
+            std::cerr << "WARNING: mlock of " << (size >> 10) << " KB failed: "
+                      << std::strerror(errno) << " (RLIMIT_MEMLOCK / CAP_IPC_LOCK)" << std::endl;
+        }
+    }
+
+    mapped_bytes_ += size;
+    return Chunk{bytes, size, 0};
+}
+
+void MemoryArena::printStatistics() const {
+    std::cout << "\n=== Memory Arena Statistics ===" << std::endl;
+    std::cout << "Pages:         " << MemoryConfig::hugePagesName(config_.hugepages);
+    if (fallbacks_ > 0) {
+        std::cout << " (" << fallbacks_ << " chunks fell back to THP)";
+    }
+    std::cout << std::endl;
+    std::cout << "Chunks:        " << chunks_.size() << std::endl;
+    std::cout << "Mapped:        " << (mapped_bytes_ >> 10) << " KB" << std::endl;
+    std::cout << "Used:          " << (used_bytes_ >> 10) << " KB";
+    if (mapped_bytes_ > 0) {
+        std::cout << " (" << std::fixed << std::setprecision(1)
+                  << 100.0 * static_cast<double>(used_bytes_) / mapped_bytes_ << "%)";
+    }
+    std::cout << std::endl;
+    std::cout << "Pre-faulted:   " << (config_.prefault ? "yes" : "no") << std::endl;
+    std::cout << "Locked:        " << (locked_bytes_ >> 10) << " KB" << std::endl;
+    std::cout << "===============================\n" << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
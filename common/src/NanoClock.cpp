@@ -0,0 +1,252 @@
+#include "NanoClock.h"
+#include "ThreadUtil.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#if AERON_EXAMPLE_HAS_TSC
+#include <cpuid.h>
+#endif
+
+namespace aeron {
+namespace example {
+
+/**
+ * Background recalibration (single writer of NanoClock::calibration_)
+ */
+class NanoClockCalibrator {
+public:
+    struct Sample {
+        uint64_t tsc;
+        int64_t ns;
+    };
+
+    // CLOCK_REALTIME bracketed by two rdtsc; keep the tightest of a few tries
+    static Sample sample() {
+        Sample best{0, 0};
+#if AERON_EXAMPLE_HAS_TSC
+        uint64_t best_window = UINT64_MAX;
+        for (int i = 0; i < 5; i++) {
+            const uint64_t t0 = __rdtsc();
+            const int64_t ns = NanoClock::realtimeNanos();
+            const uint64_t t1 = __rdtsc();
+            if (t1 - t0 < best_window) {
+                best_window = t1 - t0;
+                best.tsc = t0 + (t1 - t0) / 2;
+                best.ns = ns;
+            }
+        }
+#endif
+        return best;
+    }
+
+    static uint64_t multiplier(const Sample& from, const Sample& to) {
+        if (to.tsc <= from.tsc || to.ns <= from.ns) {
+            return 0;
+        }
+        const unsigned __int128 dns = static_cast<unsigned __int128>(to.ns - from.ns);
+        return static_cast<uint64_t>((dns << NanoClock::MULT_SHIFT) / (to.tsc - from.tsc));
+    }
+
+    static void publish(const Sample& base, uint64_t mult) {
+        auto& c = NanoClock::calibration_;
+        const uint32_t seq = c.seq.load(std::memory_order_relaxed);
+        c.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        c.base_tsc.store(base.tsc, std::memory_order_relaxed);
+        c.base_ns.store(base.ns, std::memory_order_relaxed);
+        c.mult.store(mult, std::memory_order_relaxed);
+        c.seq.store(seq + 2, std::memory_order_release);
+    }
+
+    static int64_t predict(const Sample& at) {
+        auto& c = NanoClock::calibration_;
+        const uint64_t delta = at.tsc - c.base_tsc.load(std::memory_order_relaxed);
+        return c.base_ns.load(std::memory_order_relaxed) + static_cast<int64_t>(
+            (static_cast<unsigned __int128>(delta) * c.mult.load(std::memory_order_relaxed))
+                >> NanoClock::MULT_SHIFT);
+    }
+
+    // Rate correction = remaining offset / interval, capped (adjtime-style slew)
+    static uint64_t slew(uint64_t rate, int64_t offset_ns, int64_t interval_ns) {
+        const int64_t max_offset = interval_ns / 1'000'000 * MAX_SLEW_PPM;
+        if (offset_ns > max_offset) {
+            offset_ns = max_offset;
+        } else if (offset_ns < -max_offset) {
+            offset_ns = -max_offset;
+        }
+        const __int128 correction = static_cast<__int128>(rate) * offset_ns / interval_ns;
+        return static_cast<uint64_t>(static_cast<__int128>(rate) + correction);
+    }
+
+    static void run(int64_t interval_ms, Sample previous) {
+        ThreadUtil::setCurrentThreadName("aeron-clock");
+        const int64_t interval_ns = interval_ms * 1'000'000;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_) {
+            cv_.wait_for(lock, std::chrono::milliseconds(interval_ms));
+            if (!running_) {
+                break;
+            }
+
+            const Sample now = sample();
+            const int64_t drift = predict(now) - now.ns;
+            last_drift_ns_.store(std::llabs(drift), std::memory_order_relaxed);
+            if (std::llabs(drift) > max_drift_ns_.load(std::memory_order_relaxed)) {
+                max_drift_ns_.store(std::llabs(drift), std::memory_order_relaxed);
+            }
+
+            // Long baseline → precise rate; a wall-clock step (NTP step,
+            // settimeofday) would skew it, so keep the previous rate then
+            uint64_t rate = multiplier(previous, now);
+            if (rate == 0 || rate > rate_ + rate_ / 100 || rate + rate_ / 100 < rate_) {
+                rate = rate_;
+                rate_rejections_.fetch_add(1, std::memory_order_relaxed);
+            }
+            rate_ = rate;
+
+            // Continue from the current reading (no step, never backwards) and
+            // slew toward CLOCK_REALTIME over the next interval; a wall-clock
+            // step is absorbed at MAX_SLEW_PPM instead of passed through
+            publish(Sample{now.tsc, predict(now)}, slew(rate, -drift, interval_ns));
+            recalibrations_.fetch_add(1, std::memory_order_relaxed);
+            previous = now;
+        }
+    }
+
+    // Max rate adjustment while slewing (same bound as adjtime)
+    static constexpr int64_t MAX_SLEW_PPM = 500;
+
+    static inline uint64_t rate_ = 0;           // Unslewed ns per tick (calibration thread)
+
+    static inline std::mutex mutex_;
+    static inline std::condition_variable cv_;
+    static inline std::thread thread_;
+    static inline bool running_ = false;
+
+    static inline std::atomic<int64_t> last_drift_ns_{0};
+    static inline std::atomic<int64_t> max_drift_ns_{0};
+    static inline std::atomic<uint64_t> recalibrations_{0};
+    static inline std::atomic<uint64_t> rate_rejections_{0};
+};
+
+bool NanoClock::isTscInvariant() {
+#if AERON_EXAMPLE_HAS_TSC
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007) {
+        return false;
+    }
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool NanoClock::start(const NanoClockConfig& config) {
+    {
+        std::lock_guard<std::mutex> lock(NanoClockCalibrator::mutex_);
+        if (NanoClockCalibrator::running_) {
+            return calibration_.tsc_enabled.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (config.source == "realtime") {
+        std::cout << "NanoClock: CLOCK_REALTIME (configured)" << std::endl;
+        return false;
+    }
+
+    if (!isTscInvariant()) {
+        if (config.source == "tsc") {
+            throw std::runtime_error("NanoClock: clock.source = tsc but TSC is not invariant");
+        }
+        std::cout << "NanoClock: TSC not invariant - using CLOCK_REALTIME (vDSO)" << std::endl;
+        return false;
+    }
+
+    // Initial calibration over a short window (refined by the thread)
+    const NanoClockCalibrator::Sample first = NanoClockCalibrator::sample();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const NanoClockCalibrator::Sample second = NanoClockCalibrator::sample();
+
+    const uint64_t mult = NanoClockCalibrator::multiplier(first, second);
+    if (mult == 0) {
+        std::cerr << "NanoClock: calibration failed - using CLOCK_REALTIME" << std::endl;
+        return false;
+    }
+
+    NanoClockCalibrator::rate_ = mult;
+    NanoClockCalibrator::publish(second, mult);
+    calibration_.tsc_enabled.store(true, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(NanoClockCalibrator::mutex_);
+        NanoClockCalibrator::running_ = true;
+    }
+    NanoClockCalibrator::thread_ = std::thread(
+        NanoClockCalibrator::run, config.calibration_interval_ms, second);
+
+    std::cout << "NanoClock: TSC " << std::fixed << std::setprecision(3) << tscGhz()
+              << " GHz, recalibrated every " << config.calibration_interval_ms << " ms"
+              << std::endl;
+    return true;
+}
+
+void NanoClock::stop() {
+    {
+        std::lock_guard<std::mutex> lock(NanoClockCalibrator::mutex_);
+        if (!NanoClockCalibrator::running_) {
+            return;
+        }
+        NanoClockCalibrator::running_ = false;
+    }
+    NanoClockCalibrator::cv_.notify_all();
+    if (NanoClockCalibrator::thread_.joinable()) {
+        NanoClockCalibrator::thread_.join();
+    }
+    calibration_.tsc_enabled.store(false, std::memory_order_release);
+}
+
+const char* NanoClock::source() {
+    return calibration_.tsc_enabled.load(std::memory_order_relaxed) ? "tsc" : "realtime";
+}
+
+double NanoClock::tscGhz() {
+    if (!calibration_.tsc_enabled.load(std::memory_order_relaxed)) {
+        return 0.0;
+    }
+    const uint64_t mult = calibration_.mult.load(std::memory_order_relaxed);
+    return mult > 0 ? static_cast<double>(1ULL << MULT_SHIFT) / static_cast<double>(mult) : 0.0;
+}
+
+int64_t NanoClock::lastDriftNs() {
+    return NanoClockCalibrator::last_drift_ns_.load(std::memory_order_relaxed);
+}
+
+void NanoClock::printStatistics() {
+    std::cout << "\n=== NanoClock ===" << std::endl;
+    std::cout << "Source:          " << source() << std::endl;
+    if (calibration_.tsc_enabled.load(std::memory_order_relaxed)) {
+        std::cout << "TSC frequency:   " << std::fixed << std::setprecision(3)
+                  << tscGhz() << " GHz" << std::endl;
+    }
+    std::cout << "Recalibrations:  "
+              << NanoClockCalibrator::recalibrations_.load(std::memory_order_relaxed) << std::endl;
+    std::cout << "Last drift:      " << lastDriftNs() << " ns" << std::endl;
+    std::cout << "Max drift:       "
+              << NanoClockCalibrator::max_drift_ns_.load(std::memory_order_relaxed) << " ns" << std::endl;
+    std::cout << "Rate rejections: "
+              << NanoClockCalibrator::rate_rejections_.load(std::memory_order_relaxed)
+              << " (wall-clock steps)" << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
@@ -0,0 +1,162 @@
+#include "ThreadUtil.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <dirent.h>
+
+namespace aeron {
+namespace example {
+
+// ============================================================================
+// ThreadUtil
+// ============================================================================
+
+bool ThreadUtil::setCurrentThreadName(const std::string& name) {
+    // Linux 제한: 종료 문자 포함 16 bytes
+    const std::string truncated = name.substr(0, 15);
+    const int rc = pthread_setname_np(pthread_self(), truncated.c_str());
+    if (rc != 0) {
+        std::cerr << "WARNING: Failed to set thread name '" << truncated << "': "
+                  << std::strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ThreadUtil::pinCurrentThread(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        std::cerr << "WARNING: Invalid CPU " << cpu << std::endl;
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    const int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0) {
+        std::cerr << "WARNING: Failed to pin thread to CPU " << cpu << ": "
+                  << std::strerror(rc) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ThreadUtil::setCurrentThreadRealtime(int priority) {
+    const int min = sched_get_priority_min(SCHED_FIFO);
+    const int max = sched_get_priority_max(SCHED_FIFO);
+    if (priority < min || priority > max) {
+        std::cerr << "WARNING: SCHED_FIFO priority " << priority
+                  << " out of range [" << min << ", " << max << "]" << std::endl;
+        return false;
+    }
+
+    struct sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    param.sched_priority = priority;
+
+    const int rc = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (rc != 0) {
+        std::cerr << "WARNING: Failed to set SCHED_FIFO priority " << priority << ": "
+                  << std::strerror(rc) << " (CAP_SYS_NICE required)" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ThreadUtil::configureCurrentThread(const std::string& name, const ThreadSettings& settings) {
+    bool ok = setCurrentThreadName(name);
+
+    if (settings.cpu >= 0) {
+        ok = pinCurrentThread(settings.cpu) && ok;
+    }
+    if (settings.priority > 0) {
+        ok = setCurrentThreadRealtime(settings.priority) && ok;
+    }
+
+    if (settings.cpu >= 0 || settings.priority > 0) {
+        std::cout << "Thread '" << name << "': cpu "
+                  << (settings.cpu >= 0 ? std::to_string(settings.cpu) : std::string("any"));
+        if (settings.cpu >= 0) {
+            std::cout << " (node " << numaNodeOfCpu(settings.cpu) << ")";
+        }
+        std::cout << ", "
+                  << (settings.priority > 0
+                        ? "SCHED_FIFO " + std::to_string(settings.priority)
+                        : std::string("SCHED_OTHER"))
+                  << (ok ? "" : " [partially applied]") << std::endl;
+    }
+
+    return ok;
+}
+
+bool ThreadUtil::lockAllMemory() {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        std::cerr << "WARNING: mlockall failed: " << std::strerror(errno)
+                  << " (CAP_IPC_LOCK or RLIMIT_MEMLOCK required)" << std::endl;
+        return false;
+    }
+    std::cout << "Memory locked (mlockall MCL_CURRENT | MCL_FUTURE)" << std::endl;
+    return true;
+}
+
+int ThreadUtil::numaNodeOfCpu(int cpu) {
+    if (cpu < 0) {
+        return -1;
+    }
+
+    // /sys/devices/system/cpu/cpuN/nodeM 링크로 노드 확인
+    const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        return -1;
+    }
+
+    int node = -1;
+    while (struct dirent* entry = readdir(dir)) {
+        if (std::strncmp(entry->d_name, "node", 4) == 0 &&
+            entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+            node = std::atoi(entry->d_name + 4);
+            break;
+        }
+    }
+    closedir(dir);
+
+    // 단일 노드 시스템은 nodeM 링크가 없을 수 있음
+    return node;
+}
+
+int ThreadUtil::cpuCount() {
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+// ============================================================================
+// ScopedCpuBinding
+// ============================================================================
+
+ScopedCpuBinding::ScopedCpuBinding(int cpu) : bound_(false) {
+    CPU_ZERO(&saved_);
+    if (cpu < 0) {
+        return;
+    }
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(saved_), &saved_) != 0) {
+        return;
+    }
+    bound_ = ThreadUtil::pinCurrentThread(cpu);
+}
+
+ScopedCpuBinding::~ScopedCpuBinding() {
+    if (bound_) {
+        pthread_setaffinity_np(pthread_self(), sizeof(saved_), &saved_);
+    }
+}
+
+} // namespace example
+} // namespace aeron
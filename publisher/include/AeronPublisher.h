@@ -4,9 +4,16 @@
 #include <memory>
 #include <atomic>
 #include <string>
+#include <vector>
 #include "Aeron.h"
 #include "client/AeronArchive.h"
 #include "RecordingController.h"
+#include "Checksum.h"
+#include "IdleStrategy.h"
+#include "MessageBatch.h"
+#include "MessageBuffer.h"
+#include "PublishPolicy.h"
+#include "StatCounter.h"
 
 namespace aeron {
 namespace example {
@@ -19,6 +26,15 @@ struct PublisherConfig {
     std::string archive_control_response_channel;
     int message_interval_ms;
     bool auto_record;  // 자동으로 recording 시작
+    ChecksumType checksum;  // 메시지 checksum (CRC32C: SSE4.2)
+    uint16_t publisher_id;  // header publisher_id
+    bool use_claim;         // tryClaim 으로 term buffer 에 직접 작성 (false: offer 복사)
+    PublishPolicy publish_policy;     // back pressure / not connected 시 동작
+    int64_t publish_timeout_ms;       // bounded: 재시도 한도
+    IdleStrategyConfig retry_idle;    // 재시도 사이 대기
+    bool batch;                       // 작은 메시지를 MSG_BATCH envelope 로 묶어서 전송
+    uint32_t batch_bytes;             // envelope 한도 (0: maxPayloadLength, 초과 시 그 값)
+    int64_t batch_linger_us;          // 첫 메시지 후 최대 대기 (이후 flush)
 
     PublisherConfig()
         : aeron_dir("/dev/shm/aeron")
@@ -28,7 +44,34 @@ struct PublisherConfig {
         , archive_control_response_channel("aeron:udp?endpoint=localhost:0")
         , message_interval_ms(100)
         , auto_record(false)  // 기본값: 수동 recording
-    {}
+        , checksum(ChecksumType::CRC32C)
+        , publisher_id(1)
+        , use_claim(true)
+        , publish_policy(PublishPolicy::BOUNDED)
+        , publish_timeout_ms(1000)
+        , batch(false)
+        , batch_bytes(0)
+        , batch_linger_us(50)
+    {
+        retry_idle.name = "backoff";
+    }
+};
+
+/**
+ * 작성 중인 메시지 (AeronPublisher::claim → 채우기 → commit)
+ *
+ * - claimed = true : publication term buffer 안 (tryClaim, 복사 없음)
+ * - claimed = false: fallback buffer (maxPayloadLength 초과 → offer 로 복사)
+ * - batched = true : 모으는 중인 batch envelope 안 (config.batch)
+ *
+ * header / payload 는 commit() 또는 abort() 전까지만 유효
+ */
+struct MessageClaim {
+    MessageHeader* header = nullptr;
+    uint8_t* payload = nullptr;
+    uint32_t payload_length = 0;
+    bool claimed = false;
+    bool batched = false;
 };
 
 class AeronPublisher {
@@ -38,6 +81,102 @@ public:
     
     bool initialize();
     bool publish(const uint8_t* buffer, size_t length);
+
+    /**
+     * Claim-based publish (zero-copy)
+     *
+     * claim() 으로 header + payload_length 공간을 예약하고, 호출자가
+     * header 필드와 payload 를 직접 채운 뒤 commit() 한다.
+     * message_length / checksum 은 commit() 이 설정.
+     *
+     * - header + payload <= maxPayloadLength: tryClaim (term buffer 에 직접)
+     * - 더 크면: 내부 fallback buffer → commit() 에서 offer (fragment)
+     *
+     * 한 번에 하나의 claim 만 (publish 스레드 1개 전용)
+     *
+     * claim / offer 실패는 publish_policy 에 따라 재시도
+     *
+     * config.batch: envelope 에 들어가는 메시지는 batch 에 작성되고
+     * commit() 은 batch 가 가득 차거나 batch_linger_us 가 지나면 전송.
+     * 그 외에는 flushBatch() / flushBatchIfDue() 를 호출자가 부른다.
+     * commit() 이 true 여도 batch 가 나중에 drop 될 수 있으므로, batch 모드에서
+     * gap 없는 sequence 가 필요하면 enableSequencing() 을 쓴다.
+     *
+     * @return claim: false = 정책에 따라 drop (back pressure timeout 등)
+     *         commit (batch): batch 를 보냈다면 그 결과, 아니면 true
+     */
+    bool claim(uint32_t payload_length, MessageClaim& message);
+    bool commit(MessageClaim& message);
+    void abort(MessageClaim& message);
+
+    /**
+     * 이미 만들어진 메시지 발행 (payload 는 header 바로 뒤)
+     *
+     * message_length / checksum 을 설정한 뒤 offer (publish_policy 적용).
+     * StagedPublisher sender 가 staging ring 의 record 를 그대로 넘길 때 사용.
+     */
+    bool publishMessage(MessageHeader* header, uint32_t payload_length);
+
+    /**
+     * Publisher 가 sequence_number 를 전송 시점에 부여 (publish 스레드)
+     *
+     * 이후 commit() / publishMessage() 는 호출자가 쓴 sequence_number 를 덮어씀:
+     * tryClaim 은 commit 시, offer 는 전송 직전, batch 는 envelope 전송 직전
+     * inner 마다 (checksum 도 그때 계산). 정책이 drop 한 메시지 / envelope 는
+     * 번호를 쓰지 않으므로 batch 모드에서도 subscriber 에 gap 이 없음.
+     */
+    void enableSequencing(uint64_t first_sequence = 0) noexcept {
+        sequencing_ = true;
+        next_sequence_ = first_sequence;
+    }
+
+    // 다음에 부여할 sequence = 지금까지 전송에 성공한 메시지 수 (first 0 기준)
+    uint64_t nextSequence() const noexcept { return next_sequence_; }
+
+    // Batch 에 모여 아직 전송되지 않은 메시지 수
+    uint32_t pendingBatchMessages() const noexcept { return batch_.count(); }
+
+    /**
+     * 모은 batch 를 지금 전송 (비어 있으면 true)
+     *
+     * Inner 1개면 envelope 없이 보냄. 실패하면 batch 의 메시지 모두 drop.
+     */
+    bool flushBatch();
+
+    /**
+     * 첫 메시지 후 batch_linger_us 가 지났으면 flushBatch()
+     * (송신 loop 가 다음 메시지를 기다리는 동안 호출)
+     */
+    void flushBatchIfDue(int64_t now_ns) {
+        if (!batch_.empty() && now_ns - batch_started_ns_ >= batch_linger_ns_) {
+            flushBatch();
+        }
+    }
+
+    /**
+     * 외부 running flag (main 의 Ctrl+C flag 등, 수명이 publisher 보다 길어야 함)
+     *
+     * false 가 되면 publish_policy 의 재시도를 중단: 이후 메시지는 1번만
+     * 시도하고 실패하면 drop (retry 정책 + NOT_CONNECTED 에서도 종료 가능)
+     */
+    void setRunningFlag(const std::atomic<bool>* running) noexcept { external_running_ = running; }
+
+    const PublisherConfig& config() const noexcept { return config_; }
+
+    // Header 포함 최대 메시지 크기 (offer fragment 한도, 초기화 전: 0)
+    int32_t maxMessageLength() const;
+
+    // offer / tryClaim 결과별 건수
+    uint64_t offerOutcomes(OfferOutcome outcome) const noexcept {
+        return outcomes_[static_cast<size_t>(outcome)].load(std::memory_order_relaxed);
+    }
+    uint64_t droppedMessages() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+    const StallHistogram& backPressureStalls() const noexcept { return back_pressure_stalls_; }
+
+    /**
+     * 결과별 건수, 재시도 / drop, back-pressure stall histogram 출력
+     */
+    void printPublishStatistics() const;
     bool startRecording();
     bool stopRecording();
     bool isRecording() const;
@@ -45,6 +184,34 @@ public:
     void shutdown();
 
 private:
+    /**
+     * attempt() (offer / tryClaim 결과 반환) 를 publish_policy 에 따라 반복
+     *
+     * @return 성공 여부 (false: drop)
+     */
+    template <typename Attempt>
+    bool sendWithPolicy(Attempt&& attempt);
+
+    // Batch 에 넣을 수 있는 메시지 (config.batch, envelope 한도 이내)
+    bool batchable(size_t length) const noexcept {
+        return config_.batch && !batch_.tooLarge(length);
+    }
+
+    // Batch 에 inner 1개 확정 (가득 차거나 linger 초과면 flush)
+    bool commitToBatch(size_t length);
+
+    // message_length + checksum (flags 포함)
+    void finalize(MessageHeader* header, const uint8_t* payload, uint32_t payload_length) const;
+
+    // finalize() + enableSequencing() 이면 sequence_number = next_sequence_
+    void stamp(MessageHeader* header, const uint8_t* payload, uint32_t payload_length) const;
+
+    // Batch 에 넣을 메시지: enableSequencing() 이면 sequence / checksum 은 flushBatch() 에서
+    void prepareForBatch(MessageHeader* header, const uint8_t* payload, uint32_t payload_length) const;
+
+    // 결과 1건 기록 + 치명적 오류 로그
+    OfferOutcome recordResult(std::int64_t result);
+
     PublisherConfig config_;
 
     std::shared_ptr<aeron::Context> context_;
@@ -56,7 +223,33 @@ private:
     std::unique_ptr<RecordingController> recording_controller_;
 
     std::atomic<bool> running_;
+    const std::atomic<bool>* external_running_ = nullptr;   // setRunningFlag()
     int64_t message_count_;
+
+    // Claim 경로 (publish 스레드 전용)
+    aeron::concurrent::logbuffer::BufferClaim buffer_claim_;
+    std::vector<uint8_t> fallback_buffer_;   // maxPayloadLength 초과 메시지
+    int64_t claimed_count_;                  // tryClaim 으로 발행 (복사 없음)
+    int64_t offered_count_;                  // offer 로 발행 (복사 1회)
+
+    // Batch envelope (publish 스레드 전용)
+    MessageBatch batch_;
+    int64_t batch_started_ns_ = 0;           // 첫 inner 의 commit 시각
+    int64_t batch_linger_ns_ = 0;
+    int64_t batches_sent_ = 0;               // envelope frame 수
+    int64_t batched_messages_ = 0;           // envelope 으로 보낸 메시지 수
+
+    // enableSequencing() (publish 스레드 전용)
+    bool sequencing_ = false;
+    uint64_t next_sequence_ = 0;
+
+    // Retry policy / offer 결과 (publish 스레드 단독 writer)
+    std::unique_ptr<IdleStrategy> retry_idle_;
+    std::atomic<uint64_t> outcomes_[OFFER_OUTCOME_COUNT] = {};
+    std::atomic<uint64_t> retries_{0};       // 실패 후 재시도 횟수
+    std::atomic<uint64_t> dropped_{0};       // 정책에 따라 포기한 메시지
+    std::atomic<uint64_t> timed_out_{0};     // bounded timeout 으로 포기
+    StallHistogram back_pressure_stalls_;    // BACK_PRESSURED 포함 stall 시간
 };
 
 } // namespace example
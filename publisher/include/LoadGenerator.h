@@ -0,0 +1,137 @@
+/**
+ * LoadGenerator.h
+ *
+ * Open-loop load generator for capacity-testing the subscriber
+ *
+ * Why:
+ * - 기본 publish 루프는 sleep_for(ms) 로만 속도를 조절 → 최대 ~1000 msg/s,
+ *   payload 는 ~40 B 고정
+ * - 지연 측정은 "보내려던 시각" 기준이어야 함: publisher 가 막히는 동안
+ *   보내지 못한 메시지의 대기 시간이 빠지면 (coordinated omission)
+ *   부하가 클수록 지연이 실제보다 좋게 보인다
+ *
+ * Design:
+ * - Open loop: i 번째 메시지의 intended time 은 시작 시각과 rate / pattern
+ *   으로만 결정 (늦어져도 schedule 을 밀지 않고 즉시 따라잡음)
+ * - Pacing: NanoClock (rdtsc) 기준 spin + pause, 1 ms 이상 남으면 sleep
+ * - header.event_time_ns = intended time, publish_time_ns = 실제 전송 시각
+ *   → subscriber 는 recv - event_time 으로 보정된 지연을 계산
+ * - Burst pattern: burst 개씩 같은 intended time 에 전송 (평균 rate 유지),
+ *   on/off: on_ms 동안 rate 로 전송, off_ms 동안 휴지
+ * - Payload 크기 분포: fixed:N | uniform:MIN-MAX | file:PATH (경험적 분포,
+ *   줄마다 "size [weight]" → inverse-CDF table, 메시지당 lookup 1번)
+ * - AeronPublisher::claim / commit 사용 (back pressure 는 publish 정책에
+ *   따라 재시도 / drop, 어느 쪽이든 schedule 은 그대로)
+ *
+ * Usage:
+ *   LoadGeneratorConfig config;
+ *   config.rate = 1'000'000;
+ *   config.payload = PayloadDistribution::parse("uniform:32-512");
+ *   LoadGenerator generator(publisher, config);
+ *   generator.run(running);
+ *   generator.printStatistics();
+ */
+
+#ifndef AERON_EXAMPLE_LOAD_GENERATOR_H
+#define AERON_EXAMPLE_LOAD_GENERATOR_H
+
+#include "AeronPublisher.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Payload 크기 분포
+ */
+class PayloadDistribution {
+public:
+    // Empirical 분포의 inverse-CDF table 크기 (2^n)
+    static constexpr size_t TABLE_SIZE = 4096;
+
+    PayloadDistribution() = default;
+
+    /**
+     * "fixed:N" | "uniform:MIN-MAX" | "file:PATH"
+     *
+     * @throws std::invalid_argument 잘못된 형식 / 빈 파일
+     */
+    static PayloadDistribution parse(const std::string& spec);
+
+    /**
+     * 다음 payload 크기 (random: 호출자의 xorshift 상태)
+     */
+    uint32_t sample(uint64_t random) const noexcept {
+        if (!table_.empty()) {
+            return table_[random & (TABLE_SIZE - 1)];
+        }
+        const uint32_t span = max_ - min_;
+        return span == 0 ? min_ : min_ + static_cast<uint32_t>(random % (span + 1ULL));
+    }
+
+    uint32_t minSize() const noexcept { return min_; }
+    uint32_t maxSize() const noexcept { return max_; }
+    const std::string& describe() const noexcept { return spec_; }
+
+private:
+    std::string spec_ = "fixed:64";
+    uint32_t min_ = 64;
+    uint32_t max_ = 64;
+    std::vector<uint32_t> table_;   // Empirical only
+};
+
+struct LoadGeneratorConfig {
+    double rate = 100000;            // 평균 msg/s (0: 최대 속도)
+    uint32_t burst = 1;              // intended time 당 메시지 수
+    int64_t on_ms = 0;               // on/off pattern (0: 항상 on)
+    int64_t off_ms = 0;
+    double duration_s = 10;          // 0: count 또는 Ctrl+C 까지
+    uint64_t count = 0;              // 0: duration 까지
+    PayloadDistribution payload;
+    uint64_t seed = 1;               // payload 크기 random seed
+};
+
+class LoadGenerator {
+public:
+    struct Statistics {
+        uint64_t committed;          // claim / commit 까지 간 메시지 (lag 집계 대상)
+        uint64_t sent;               // 전송 성공 (publisher sequence, batch 는 envelope 전송 시)
+        uint64_t dropped;            // publish 정책이 포기 (batch 는 envelope 의 inner 모두)
+        uint64_t payload_bytes;      // 전송 성공한 메시지의 payload
+        uint64_t late;               // 다음 intended time 이후에 전송
+        int64_t max_lag_ns;          // 실제 전송 - intended (최대)
+        int64_t total_lag_ns;
+        int64_t elapsed_ns;
+    };
+
+    LoadGenerator(AeronPublisher& publisher, const LoadGeneratorConfig& config);
+
+    /**
+     * 호출 스레드에서 schedule 이 끝나거나 running == false 일 때까지 전송
+     *
+     * @return false: 설정 오류 (payload 가 publication 최대 크기 초과 등)
+     */
+    bool run(const std::atomic<bool>& running);
+
+    Statistics getStatistics() const noexcept { return stats_; }
+    void printStatistics() const;
+
+    /**
+     * i 번째 메시지의 intended time (시작 기준 offset, ns)
+     */
+    int64_t scheduleOffset(uint64_t index) const noexcept;
+
+private:
+    AeronPublisher& publisher_;
+    LoadGeneratorConfig config_;
+    double interval_ns_;             // 메시지 간격 (1e9 / rate)
+    Statistics stats_;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_LOAD_GENERATOR_H
@@ -0,0 +1,154 @@
+/**
+ * MessageBatch.h
+ *
+ * Publisher-side builder of one MSG_BATCH envelope (see MessageBuffer.h)
+ *
+ * Why:
+ * - Tick 크기 메시지 (payload 40 B) 는 MessageHeader 64 B + Aeron frame
+ *   header 32 B 를 메시지마다 붙이고 offer 도 메시지마다 1번
+ * - 여러 메시지를 MTU 1개에 담으면 frame / offer 비용이 n 분의 1
+ *
+ * Design:
+ * - Buffer 1개 (capacity = envelope 한도, maxPayloadLength 이하)
+ * - claim(length) → 다음 inner 위치 (8 B 정렬), commit(length) 로 확정
+ * - seal() 이 envelope header 를 첫 inner header 기준으로 작성
+ * - forEach() 로 전송 직전 inner 마다 sequence / checksum 설정 가능
+ * - Inner 가 1개면 envelope 없이 그 메시지만 보냄 (single())
+ *
+ * Thread Safety: publish 스레드 전용
+ *
+ * Usage:
+ *   batch.reset(publication->maxPayloadLength());
+ *   uint8_t* dst = batch.claim(length);   // nullptr: flush 후 다시
+ *   ... fill header + payload ...
+ *   batch.commit(length);
+ *   offer(batch.seal(now), batch.length());
+ *   batch.clear();
+ */
+
+#ifndef AERON_EXAMPLE_MESSAGE_BATCH_H
+#define AERON_EXAMPLE_MESSAGE_BATCH_H
+
+#include "MessageBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+class MessageBatch {
+public:
+    /**
+     * Envelope 한도 설정 (비어 있을 때만)
+     */
+    void reset(size_t capacity) {
+        buffer_.assign(capacity, 0);
+        clear();
+    }
+
+    void clear() noexcept {
+        length_ = sizeof(MessageHeader);
+        count_ = 0;
+    }
+
+    bool empty() const noexcept { return count_ == 0; }
+    uint32_t count() const noexcept { return count_; }
+    size_t capacity() const noexcept { return buffer_.size(); }
+
+    // Envelope bytes so far (header 포함)
+    size_t length() const noexcept { return length_; }
+
+    /**
+     * 빈 batch 에도 들어가지 않는 메시지 (envelope 없이 보내야 함)
+     */
+    bool tooLarge(size_t length) const noexcept {
+        return sizeof(MessageHeader) + length > buffer_.size();
+    }
+
+    /**
+     * 다음 inner 메시지 자리 (header + payload = length bytes)
+     *
+     * @return nullptr: 남은 공간 부족 (flush 후 다시)
+     */
+    uint8_t* claim(size_t length) noexcept {
+        const size_t offset = nextOffset();
+        if (offset + length > buffer_.size()) {
+            return nullptr;
+        }
+        return buffer_.data() + offset;
+    }
+
+    void commit(size_t length) noexcept {
+        length_ = nextOffset() + length;
+        count_++;
+    }
+
+    /**
+     * Inner 메시지마다 handler(MessageHeader*, uint8_t* payload, uint32_t payload_length)
+     * (message_length 는 commit 전에 설정되어 있어야 함)
+     */
+    template<typename Handler>
+    void forEach(Handler&& handler) {
+        size_t offset = sizeof(MessageHeader);
+        for (uint32_t i = 0; i < count_; i++) {
+            uint8_t* frame = buffer_.data() + offset;
+            MessageHeader* header = reinterpret_cast<MessageHeader*>(frame);
+            const uint32_t message_length = header->message_length;
+            handler(header, frame + sizeof(MessageHeader),
+                    static_cast<uint32_t>(message_length - sizeof(MessageHeader)));
+            offset = batchAlign(offset + message_length);
+        }
+    }
+
+    /**
+     * Envelope header 작성 (sequence / publisher / session: 첫 inner 기준)
+     *
+     * @return Envelope 시작 (length() bytes)
+     */
+    const uint8_t* seal(int64_t publish_time_ns) noexcept {
+        const MessageHeader* first = reinterpret_cast<const MessageHeader*>(
+            buffer_.data() + sizeof(MessageHeader));
+        MessageHeader* envelope = reinterpret_cast<MessageHeader*>(buffer_.data());
+
+        memset(envelope, 0, sizeof(MessageHeader));
+        envelope->setMagic();
+        envelope->version = 1;
+        envelope->message_type = MSG_BATCH;
+        envelope->sequence_number = first->sequence_number;
+        envelope->event_time_ns = first->event_time_ns;
+        envelope->publish_time_ns = static_cast<uint64_t>(publish_time_ns);
+        envelope->message_length = static_cast<uint32_t>(length_);
+        envelope->publisher_id = first->publisher_id;
+        envelope->priority = first->priority;
+        envelope->session_id = first->session_id;
+        envelope->reserved = count_;
+        return buffer_.data();
+    }
+
+    /**
+     * Inner 1개뿐인 batch: 그 메시지 자체 (envelope 불필요)
+     */
+    const uint8_t* single() const noexcept {
+        return buffer_.data() + sizeof(MessageHeader);
+    }
+
+    size_t singleLength() const noexcept {
+        return length_ - sizeof(MessageHeader);
+    }
+
+private:
+    size_t nextOffset() const noexcept {
+        return count_ == 0 ? sizeof(MessageHeader) : batchAlign(length_);
+    }
+
+    std::vector<uint8_t> buffer_;
+    size_t length_ = sizeof(MessageHeader);
+    uint32_t count_ = 0;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_MESSAGE_BATCH_H
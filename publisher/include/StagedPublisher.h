@@ -0,0 +1,138 @@
+/**
+ * StagedPublisher.h
+ *
+ * Multi-threaded publishing through one Publication
+ *
+ * Why:
+ * - AeronPublisher 는 publish 스레드 1개 전용 (BufferClaim, 통계, sequence)
+ * - 여러 스레드가 같은 stream 으로 보내려면 스레드마다 Publication 을
+ *   만들거나 lock 을 잡아야 했음 → 둘 다 sequence 가 스레드별로 갈라지거나
+ *   hot path 에 경합
+ *
+ * Design:
+ * - App 스레드: StagingRing (MPSC, CAS 1번) 에 메시지를 직접 작성 후 commit
+ * - Sender 스레드 1개: ring 을 drain_limit 개씩 읽어 AeronPublisher 로 발행
+ *   (ring 의 record 를 그대로 offer, publish_policy 적용; config.batch 면
+ *   envelope 에 모으고 ring 이 빌 때마다 전송)
+ * - publisher_id / publish_time_ns 는 sender 가 drain 시 설정, sequence_number 는
+ *   AeronPublisher 가 전송 시점에 부여 (enableSequencing) → stream 전체가 gap
+ *   없는 단일 sequence (정책이 drop 한 메시지 / envelope 는 sequence 를 소비하지 않음)
+ * - Ring 이 가득 차면 claim / submit 이 false (호출자가 재시도 / 버림 결정)
+ *
+ * Thread Safety:
+ * - claim / commit / abort / submit: any thread
+ * - start / stop: 소유 스레드
+ * - AeronPublisher 는 sender 스레드만 사용 (start 후 직접 publish 금지)
+ *
+ * Usage:
+ *   StagedPublisher staged(publisher, config);
+ *   staged.start();
+ *   // any thread
+ *   staged.submit(MSG_ORDER_NEW, payload, length);
+ *   staged.stop();   // 남은 메시지 발행 후 종료
+ */
+
+#ifndef AERON_EXAMPLE_STAGED_PUBLISHER_H
+#define AERON_EXAMPLE_STAGED_PUBLISHER_H
+
+#include "AeronPublisher.h"
+#include "IdleStrategy.h"
+#include "StagingRing.h"
+#include "StatCounter.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace aeron {
+namespace example {
+
+struct StagedPublisherConfig {
+    size_t ring_bytes = StagingRing::DEFAULT_CAPACITY;   // power of 2
+    size_t drain_limit = 64;                             // sender 1회 drain 최대 메시지
+    IdleStrategyConfig sender_idle;                      // ring 이 비었을 때
+
+    StagedPublisherConfig() {
+        sender_idle.name = "backoff";
+    }
+};
+
+class StagedPublisher {
+public:
+    struct Statistics {
+        uint64_t sent;           // Publication 으로 발행
+        uint64_t dropped;        // publish_policy 가 포기 (drop 된 envelope 의 inner 포함)
+        uint64_t batches;        // 1건 이상 drain 한 횟수
+        uint64_t ring_full;      // claim 실패 (ring 가득)
+        uint64_t oversize;       // claim 실패 (maxPayloadLength 초과)
+    };
+
+    /**
+     * publisher.enableSequencing() 을 호출함 (sequence 는 publisher 소유)
+     *
+     * @throws std::invalid_argument ring_bytes 가 2의 거듭제곱이 아님
+     */
+    StagedPublisher(AeronPublisher& publisher, const StagedPublisherConfig& config);
+    ~StagedPublisher();
+
+    // Non-copyable
+    StagedPublisher(const StagedPublisher&) = delete;
+    StagedPublisher& operator=(const StagedPublisher&) = delete;
+
+    void start();
+
+    /**
+     * Sender 종료 (ring 에 남은 메시지는 발행한 뒤)
+     */
+    void stop();
+
+    /**
+     * Ring 에 메시지 공간 예약 (any thread)
+     *
+     * header 는 0 + magic / version / priority 128 / session_id 1 로
+     * 초기화됨. 호출자는 message_type, event_time_ns 등과 payload 를 채운다.
+     *
+     * @return false: ring 가득 / payload 가 maxPayloadLength() 초과
+     */
+    bool claim(uint32_t payload_length, MessageClaim& message) noexcept;
+    void commit(MessageClaim& message) noexcept;
+    void abort(MessageClaim& message) noexcept;
+
+    /**
+     * claim + payload 복사 + commit (any thread)
+     */
+    bool submit(uint16_t message_type, const void* payload, uint32_t payload_length,
+                uint64_t event_time_ns = 0) noexcept;
+
+    size_t maxPayloadLength() const noexcept {
+        return ring_.maxMessageLength() - sizeof(MessageHeader);
+    }
+
+    Statistics getStatistics() const noexcept;
+    void printStatistics() const;
+
+private:
+    void senderLoop();
+
+    // Ring → Publication (sender thread)
+    size_t drain();
+
+    AeronPublisher& publisher_;
+    StagedPublisherConfig config_;
+    StagingRing ring_;
+    std::unique_ptr<IdleStrategy> idle_;
+
+    std::atomic<bool> running_{false};
+    std::thread sender_;
+
+    // Sender thread only
+    uint64_t handed_over_ = 0;               // publishMessage() 로 넘긴 메시지
+    std::atomic<uint64_t> sent_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> batches_{0};
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_STAGED_PUBLISHER_H
@@ -0,0 +1,280 @@
+/**
+ * StagingRing.h
+ *
+ * Many-to-one byte ring of variable-length records
+ * (publisher staging, in the style of Aeron's ManyToOneRingBuffer)
+ *
+ * Design:
+ * - Producers (any thread) reserve a record with one CAS on tail_, fill it
+ *   in place and commit it by storing the record length (release)
+ * - length == 0 means "not committed yet": the consumer stops at the first
+ *   uncommitted record, so records become visible in claim order even if
+ *   producers commit out of order
+ * - The consumer zeroes each record after handling it (every aligned slot
+ *   can later hold a record header) and publishes head_ once per drain
+ * - A record never wraps: the producer that crosses the end of the array
+ *   claims the rest as a PADDING record in the same CAS
+ * - head_cache_ is shared by producers (relaxed), head_ is only re-read
+ *   when the ring looks full
+ *
+ * Flow:
+ *   App threads                                Sender thread
+ *   claim(len) ──CAS tail_──> fill record      read(handler, limit)
+ *   commit()  ──length (release)──>              handler(record in ring)
+ *                                               zero record, head_ (release)
+ *
+ * Thread Safety:
+ * - claim / commit / abort: any number of threads
+ * - read: one consumer thread
+ * - Statistics: readable from any thread
+ *
+ * Usage:
+ *   StagingRing ring(1024 * 1024);
+ *   uint8_t* dst = ring.claim(length);
+ *   if (dst) { fill(dst); ring.commit(dst); }
+ *   ...
+ *   ring.read([](uint8_t* data, size_t length) { ... }, 64);
+ */
+
+#ifndef AERON_EXAMPLE_STAGING_RING_H
+#define AERON_EXAMPLE_STAGING_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace aeron {
+namespace example {
+
+class StagingRing {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;   // 1 MB
+
+    /**
+     * Per-record header (length is the commit flag)
+     */
+    struct RecordHeader {
+        std::atomic<int32_t> length;   // Header + data bytes (0: not committed)
+        uint32_t type;                 // RECORD_MESSAGE | RECORD_PADDING
+        uint64_t claimed_length;       // Set by claim(), published by commit()
+    };
+    static_assert(sizeof(RecordHeader) == 16, "RecordHeader must be 16 bytes");
+
+    static constexpr uint32_t RECORD_MESSAGE = 1;
+    static constexpr uint32_t RECORD_PADDING = 2;
+
+    static constexpr size_t HEADER_LENGTH = sizeof(RecordHeader);
+    static constexpr size_t RECORD_ALIGNMENT = 32;
+
+    /**
+     * @param capacity Bytes (power of 2, >= 4 KB)
+     * @throws std::invalid_argument bad capacity
+     */
+    explicit StagingRing(size_t capacity = DEFAULT_CAPACITY)
+        : capacity_(checkedCapacity(capacity))
+        , mask_(capacity_ - 1)
+        , max_message_length_(capacity_ / 8 - HEADER_LENGTH)
+        , buffer_(static_cast<uint8_t*>(::operator new(capacity_, std::align_val_t(64)))) {
+        // Every slot starts uncommitted (also pre-faults the ring)
+        std::memset(buffer_, 0, capacity_);
+    }
+
+    ~StagingRing() {
+        ::operator delete(buffer_, std::align_val_t(64));
+    }
+
+    // Non-copyable
+    StagingRing(const StagingRing&) = delete;
+    StagingRing& operator=(const StagingRing&) = delete;
+
+    /**
+     * Reserve a record for length bytes (any thread)
+     *
+     * @return Where to write the bytes (valid until commit / abort), or
+     *         nullptr if the ring is full or length > maxMessageLength()
+     */
+    uint8_t* claim(size_t length) noexcept {
+        if (length > max_message_length_) {
+            oversize_count_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        const size_t aligned_length = align(HEADER_LENGTH + length);
+        int64_t head = head_cache_.load(std::memory_order_relaxed);
+        int64_t tail = tail_.load(std::memory_order_acquire);
+        size_t padding;
+
+        do {
+            const size_t index = static_cast<size_t>(tail) & mask_;
+            const size_t to_end = capacity_ - index;
+            padding = aligned_length > to_end ? to_end : 0;
+            const size_t required = aligned_length + padding;
+
+            if (capacity_ - static_cast<size_t>(tail - head) < required) {
+                head = head_.load(std::memory_order_acquire);
+                if (capacity_ - static_cast<size_t>(tail - head) < required) {
+                    full_count_.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                head_cache_.store(head, std::memory_order_relaxed);
+            }
+        } while (!tail_.compare_exchange_weak(tail, tail + static_cast<int64_t>(aligned_length + padding),
+                                              std::memory_order_acq_rel, std::memory_order_acquire));
+
+        size_t index = static_cast<size_t>(tail) & mask_;
+        if (padding != 0) {
+            // Rest of the array, record starts at offset 0
+            RecordHeader* filler = headerAt(index);
+            filler->type = RECORD_PADDING;
+            filler->length.store(static_cast<int32_t>(padding), std::memory_order_release);
+            index = 0;
+            padding_records_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        RecordHeader* header = headerAt(index);
+        header->type = RECORD_MESSAGE;
+        header->claimed_length = HEADER_LENGTH + length;
+        return buffer_ + index + HEADER_LENGTH;
+    }
+
+    /**
+     * Make a claimed record visible to the consumer (claiming thread)
+     */
+    void commit(uint8_t* data) noexcept {
+        RecordHeader* header = headerOf(data);
+        header->length.store(static_cast<int32_t>(header->claimed_length), std::memory_order_release);
+    }
+
+    /**
+     * Give a claimed record back: the consumer skips it (claiming thread)
+     */
+    void abort(uint8_t* data) noexcept {
+        RecordHeader* header = headerOf(data);
+        header->type = RECORD_PADDING;
+        header->length.store(static_cast<int32_t>(align(header->claimed_length)), std::memory_order_release);
+    }
+
+    /**
+     * Consume up to limit committed records in claim order (consumer thread)
+     *
+     * handler(uint8_t* data, size_t length); data points into the ring and
+     * is only valid during the call (the handler may modify it).
+     *
+     * @return Number of message records consumed
+     */
+    template<typename Handler>
+    size_t read(Handler&& handler, size_t limit) {
+        int64_t head = head_.load(std::memory_order_relaxed);
+        const int64_t start = head;
+        size_t count = 0;
+
+        while (count < limit) {
+            RecordHeader* header = headerAt(static_cast<size_t>(head) & mask_);
+            const int32_t length = header->length.load(std::memory_order_acquire);
+            if (length == 0) {
+                break;   // Empty, or the next record is not committed yet
+            }
+
+            const size_t record_length = static_cast<size_t>(length);
+            size_t aligned_length = record_length;
+            if (header->type == RECORD_MESSAGE) {
+                handler(reinterpret_cast<uint8_t*>(header) + HEADER_LENGTH, record_length - HEADER_LENGTH);
+                aligned_length = align(record_length);
+                count++;
+            }
+
+            // Back to "uncommitted" for the next producer (length last)
+            std::memset(reinterpret_cast<uint8_t*>(header) + sizeof(header->length), 0,
+                        aligned_length - sizeof(header->length));
+            header->length.store(0, std::memory_order_relaxed);
+            head += static_cast<int64_t>(aligned_length);
+        }
+
+        if (head != start) {
+            head_.store(head, std::memory_order_release);
+            records_read_.store(records_read_.load(std::memory_order_relaxed) + count,
+                                std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /**
+     * Claimed, unconsumed bytes (any thread, approximate)
+     */
+    size_t usedBytes() const noexcept {
+        const int64_t head = head_.load(std::memory_order_acquire);
+        const int64_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? static_cast<size_t>(tail - head) : 0;
+    }
+
+    bool empty() const noexcept {
+        return usedBytes() == 0;
+    }
+
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * Largest record: 1/8 of the ring
+     */
+    size_t maxMessageLength() const noexcept {
+        return max_message_length_;
+    }
+
+    uint64_t recordsRead() const noexcept { return records_read_.load(std::memory_order_relaxed); }
+    uint64_t fullCount() const noexcept { return full_count_.load(std::memory_order_relaxed); }
+    uint64_t oversizeCount() const noexcept { return oversize_count_.load(std::memory_order_relaxed); }
+    uint64_t paddingRecords() const noexcept { return padding_records_.load(std::memory_order_relaxed); }
+
+private:
+    static size_t checkedCapacity(size_t capacity) {
+        if (capacity < 4096 || (capacity & (capacity - 1)) != 0) {
+            throw std::invalid_argument("Staging ring capacity must be a power of 2 (>= 4 KB): "
+                                        + std::to_string(capacity));
+        }
+        return capacity;
+    }
+
+    static constexpr size_t align(size_t length) noexcept {
+        return (length + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    }
+
+    RecordHeader* headerAt(size_t index) noexcept {
+        return reinterpret_cast<RecordHeader*>(buffer_ + index);
+    }
+
+    static RecordHeader* headerOf(uint8_t* data) noexcept {
+        return reinterpret_cast<RecordHeader*>(data - HEADER_LENGTH);
+    }
+
+    // Consumer position: written by the sender thread (own cache line)
+    alignas(64) std::atomic<int64_t> head_{0};
+    std::atomic<uint64_t> records_read_{0};
+
+    // Producer position: CAS by any producer (own cache line)
+    alignas(64) std::atomic<int64_t> tail_{0};
+
+    // Producers' shared copy of head_ (refreshed only when full)
+    alignas(64) std::atomic<int64_t> head_cache_{0};
+
+    // Producer statistics (multi-writer, failure paths only)
+    alignas(64) std::atomic<uint64_t> full_count_{0};
+    std::atomic<uint64_t> oversize_count_{0};
+    std::atomic<uint64_t> padding_records_{0};
+
+    // Ring memory (read-only after construction)
+    alignas(64) const size_t capacity_;
+    const size_t mask_;
+    const size_t max_message_length_;
+    uint8_t* const buffer_;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_STAGING_RING_H
@@ -1,6 +1,9 @@
 #include "AeronPublisher.h"
 #include "AeronConfig.h"
 #include "MessageBuffer.h"
+#include "NanoClock.h"
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <thread>
 #include <chrono>
@@ -13,7 +16,10 @@ namespace example {
 AeronPublisher::AeronPublisher(const PublisherConfig& config)
     : config_(config)
     , running_(false)
-    , message_count_(0) {
+    , message_count_(0)
+    , claimed_count_(0)
+    , offered_count_(0)
+    , retry_idle_(IdleStrategy::create(config.retry_idle)) {
 }
 
 AeronPublisher::~AeronPublisher() {
@@ -54,6 +60,17 @@ bool AeronPublisher::initialize() {
         std::cout << "Publication ready: " << config_.publication_channel
                   << ", streamId: " << config_.publication_stream_id << std::endl;
 
+        if (config_.batch) {
+            // Envelope 은 fragment 되지 않도록 MTU 1개 이내
+            const size_t limit = static_cast<size_t>(publication_->maxPayloadLength());
+            const size_t capacity = config_.batch_bytes > 0
+                ? std::min(static_cast<size_t>(config_.batch_bytes), limit) : limit;
+            batch_.reset(capacity);
+            batch_linger_ns_ = config_.batch_linger_us * 1000;
+            std::cout << "  Batch: envelope " << capacity << " B, linger "
+                      << config_.batch_linger_us << " us" << std::endl;
+        }
+
         // Archive Context 설정
         archive_context_ = std::make_shared<aeron::archive::client::Context>();
         archive_context_->aeron(aeron_);
@@ -96,10 +113,61 @@ bool AeronPublisher::initialize() {
     }
 }
 
+template <typename Attempt>
+bool AeronPublisher::sendWithPolicy(Attempt&& attempt) {
+    int64_t stall_start = 0;
+    bool back_pressured = false;
+    bool sent = false;
+
+    while (true) {
+        const OfferOutcome outcome = recordResult(attempt());
+        if (outcome == OfferOutcome::SUCCESS) {
+            sent = true;
+            break;
+        }
+        if (!isRetryable(outcome) || !running_ ||
+            (external_running_ && !external_running_->load(std::memory_order_relaxed))) {
+            break;
+        }
+        // drop: ADMIN_ACTION 만 즉시 재시도 (log rotation 등 일시적)
+        if (config_.publish_policy == PublishPolicy::DROP && outcome != OfferOutcome::ADMIN_ACTION) {
+            break;
+        }
+        back_pressured = back_pressured || outcome == OfferOutcome::BACK_PRESSURED;
+
+        const int64_t now = NanoClock::nanoTime();
+        if (stall_start == 0) {
+            stall_start = now;
+        } else if (config_.publish_policy == PublishPolicy::BOUNDED &&
+                   now - stall_start >= config_.publish_timeout_ms * 1'000'000) {
+            bump(timed_out_);
+            break;
+        }
+        bump(retries_);
+        retry_idle_->idle(0);
+    }
+
+    if (stall_start != 0) {
+        retry_idle_->reset();
+        if (back_pressured) {
+            back_pressure_stalls_.record(NanoClock::nanoTime() - stall_start);
+        }
+    }
+    if (!sent) {
+        bump(dropped_);
+    }
+    return sent;
+}
+
 bool AeronPublisher::publish(const uint8_t* buffer, size_t length) {
     if (!running_ || !publication_) {
         return false;
     }
+
+    // 순서 유지: 모아 둔 batch 가 먼저
+    if (!batch_.empty()) {
+        flushBatch();
+    }
     
     // AtomicBuffer로 래핑
     aeron::concurrent::AtomicBuffer atomic_buffer(
@@ -107,34 +175,270 @@ bool AeronPublisher::publish(const uint8_t* buffer, size_t length) {
         length
     );
     
-    std::int64_t result = publication_->offer(atomic_buffer, 0, length);
-    
-    if (result > 0) {
-        // 성공 - result는 새로운 stream position
+    // offer: term buffer 로 복사 (maxPayloadLength 초과 시 fragment)
+    const bool sent = sendWithPolicy([&]() {
+        return publication_->offer(atomic_buffer, 0, static_cast<util::index_t>(length));
+    });
+    if (sent) {
         message_count_++;
+        offered_count_++;
         return true;
     }
-    
-    // 에러 처리 (음수 값)
-    if (result == aeron::BACK_PRESSURED) {
-        // Back pressure - 일시적, 재시도 가능
+    return false;
+}
+
+bool AeronPublisher::claim(uint32_t payload_length, MessageClaim& message) {
+    if (!running_ || !publication_) {
         return false;
-    } else if (result == aeron::NOT_CONNECTED) {
-        // Publication이 subscriber에 연결되지 않음
+    }
+
+    const size_t length = sizeof(MessageHeader) + payload_length;
+    uint8_t* frame;
+    message.batched = false;
+
+    if (!batchable(length) && !batch_.empty()) {
+        // 순서 유지: batch 에 못 넣는 메시지 전에 batch 전송
+        flushBatch();
+    }
+
+    if (batchable(length)) {
+        // Envelope 에 직접 작성 (남은 공간이 부족하면 먼저 전송)
+        frame = batch_.claim(length);
+        if (!frame) {
+            flushBatch();
+            frame = batch_.claim(length);
+        }
+        message.claimed = false;
+        message.batched = true;
+    } else if (config_.use_claim && length <= static_cast<size_t>(publication_->maxPayloadLength())) {
+        // term buffer 에 직접 예약 (commit / abort 전까지 다른 publish 불가)
+        const bool claimed = sendWithPolicy([&]() {
+            return publication_->tryClaim(static_cast<util::index_t>(length), buffer_claim_);
+        });
+        if (!claimed) {
+            return false;
+        }
+        frame = buffer_claim_.buffer().buffer() + buffer_claim_.offset();
+        message.claimed = true;
+    } else {
+        // tryClaim 은 MTU 1개 (fragment 불가) → fallback buffer + offer
+        if (fallback_buffer_.size() < length) {
+            fallback_buffer_.resize(length);
+        }
+        frame = fallback_buffer_.data();
+        message.claimed = false;
+    }
+
+    message.header = reinterpret_cast<MessageHeader*>(frame);
+    message.payload = frame + sizeof(MessageHeader);
+    message.payload_length = payload_length;
+    return true;
+}
+
+bool AeronPublisher::commit(MessageClaim& message) {
+    if (message.batched) {
+        prepareForBatch(message.header, message.payload, message.payload_length);
+    } else {
+        stamp(message.header, message.payload, message.payload_length);
+    }
+
+    message.header = nullptr;
+    message.payload = nullptr;
+
+    if (message.batched) {
+        return commitToBatch(sizeof(MessageHeader) + message.payload_length);
+    }
+    if (!message.claimed) {
+        if (!publish(fallback_buffer_.data(), sizeof(MessageHeader) + message.payload_length)) {
+            return false;
+        }
+        next_sequence_ += sequencing_ ? 1 : 0;
+        return true;
+    }
+
+    buffer_claim_.commit();
+    message_count_++;
+    claimed_count_++;
+    next_sequence_ += sequencing_ ? 1 : 0;
+    return true;
+}
+
+bool AeronPublisher::publishMessage(MessageHeader* header, uint32_t payload_length) {
+    uint8_t* frame = reinterpret_cast<uint8_t*>(header);
+    const size_t length = sizeof(MessageHeader) + payload_length;
+
+    if (!running_ || !publication_ || !batchable(length)) {
+        // 순서 유지: 모아 둔 batch 가 먼저 (그 뒤의 sequence 로 stamp)
+        if (!batch_.empty()) {
+            flushBatch();
+        }
+        stamp(header, frame + sizeof(MessageHeader), payload_length);
+        if (!publish(frame, length)) {
+            return false;
+        }
+        next_sequence_ += sequencing_ ? 1 : 0;
+        return true;
+    }
+
+    prepareForBatch(header, frame + sizeof(MessageHeader), payload_length);
+
+    // 공간 부족: 먼저 전송 (실패하면 그 batch 만 drop - dropped_ 에 집계,
+    // enableSequencing() 이면 번호를 쓰지 않으므로 gap 없음)
+    uint8_t* dst = batch_.claim(length);
+    if (!dst) {
+        flushBatch();
+        dst = batch_.claim(length);
+    }
+    memcpy(dst, frame, length);
+    return commitToBatch(length);
+}
+
+bool AeronPublisher::commitToBatch(size_t length) {
+    const int64_t now = NanoClock::nanoTime();
+    if (batch_.empty()) {
+        batch_started_ns_ = now;
+    }
+    batch_.commit(length);
+
+    // Header 만 있는 메시지도 더 못 넣거나 linger 초과 → 지금 전송
+    if (!batch_.claim(sizeof(MessageHeader)) || now - batch_started_ns_ >= batch_linger_ns_) {
+        return flushBatch();
+    }
+    return true;
+}
+
+bool AeronPublisher::flushBatch() {
+    if (batch_.empty()) {
+        return true;
+    }
+
+    const uint32_t count = batch_.count();
+    if (!running_ || !publication_) {
+        bump(dropped_, count);
+        batch_.clear();
         return false;
-    } else if (result == aeron::ADMIN_ACTION) {
-        // Admin action
+    }
+
+    // 전송 직전 sequence 부여 (실패하면 같은 번호를 다음 메시지가 사용)
+    if (sequencing_) {
+        uint64_t sequence = next_sequence_;
+        batch_.forEach([&](MessageHeader* header, const uint8_t* payload, uint32_t payload_length) {
+            header->sequence_number = sequence++;
+            setMessageChecksum(header, payload, payload_length, config_.checksum);
+        });
+    }
+
+    // Inner 1개: envelope 없이 그 메시지만 (subscriber 는 일반 메시지로 처리)
+    const bool single = count == 1;
+    const uint8_t* data = single ? batch_.single() : batch_.seal(NanoClock::nanoTime());
+    const size_t length = single ? batch_.singleLength() : batch_.length();
+
+    aeron::concurrent::AtomicBuffer atomic_buffer(const_cast<uint8_t*>(data), length);
+    const bool sent = sendWithPolicy([&]() {
+        return publication_->offer(atomic_buffer, 0, static_cast<util::index_t>(length));
+    });
+    batch_.clear();
+
+    if (!sent) {
+        // sendWithPolicy 는 frame 1개로 집계 → 나머지 inner 메시지
+        bump(dropped_, count - 1);
         return false;
-    } else if (result == aeron::MAX_POSITION_EXCEEDED) {
+    }
+
+    message_count_ += count;
+    next_sequence_ += sequencing_ ? count : 0;
+    if (single) {
+        offered_count_++;
+    } else {
+        batches_sent_++;
+        batched_messages_ += count;
+    }
+    return true;
+}
+
+void AeronPublisher::finalize(MessageHeader* header, const uint8_t* payload, uint32_t payload_length) const {
+    header->message_length = static_cast<uint32_t>(sizeof(MessageHeader) + payload_length);
+
+    // Checksum flags + value (CRC32C: receiver sees FLAG_CHECKSUM_CRC32C)
+    setMessageChecksum(header, payload, payload_length, config_.checksum);
+}
+
+void AeronPublisher::stamp(MessageHeader* header, const uint8_t* payload, uint32_t payload_length) const {
+    if (sequencing_) {
+        header->sequence_number = next_sequence_;
+    }
+    finalize(header, payload, payload_length);
+}
+
+void AeronPublisher::prepareForBatch(MessageHeader* header, const uint8_t* payload,
+                                     uint32_t payload_length) const {
+    if (sequencing_) {
+        // forEach() 가 inner 경계를 찾는 데 필요
+        header->message_length = static_cast<uint32_t>(sizeof(MessageHeader) + payload_length);
+        return;
+    }
+    finalize(header, payload, payload_length);
+}
+
+void AeronPublisher::abort(MessageClaim& message) {
+    // Claim 한 공간은 padding 으로 채워짐 (subscriber 에게 전달 안 됨)
+    // batch: commit 전이므로 자리만 버림
+    if (message.claimed && message.header) {
+        buffer_claim_.abort();
+    }
+    message.header = nullptr;
+    message.payload = nullptr;
+}
+
+int32_t AeronPublisher::maxMessageLength() const {
+    return publication_ ? publication_->maxMessageLength() : 0;
+}
+
+OfferOutcome AeronPublisher::recordResult(std::int64_t result) {
+    // result > 0: 새로운 stream position
+    const OfferOutcome outcome = classifyOfferResult(result);
+    std::atomic<uint64_t>& count = outcomes_[static_cast<size_t>(outcome)];
+    bump(count);
+
+    if (outcome == OfferOutcome::MAX_POSITION_EXCEEDED) {
         // 최대 position 초과
         std::cerr << "Max position exceeded" << std::endl;
-        return false;
-    } else {
-        // 기타 에러
-        if (message_count_ % 1000 == 0) {
+    } else if (outcome == OfferOutcome::CLOSED || outcome == OfferOutcome::ERROR) {
+        // 기타 에러 (처음 1번 + 1000번마다)
+        if (count.load(std::memory_order_relaxed) % 1000 == 1) {
             std::cerr << "Offer failed with result: " << result << std::endl;
         }
-        return false;
+    }
+    return outcome;
+}
+
+void AeronPublisher::printPublishStatistics() const {
+    std::cout << "Publish policy: " << publishPolicyName(config_.publish_policy);
+    if (config_.publish_policy == PublishPolicy::BOUNDED) {
+        std::cout << " (timeout " << config_.publish_timeout_ms << " ms)";
+    }
+    std::cout << ", retry idle: " << retry_idle_->name() << std::endl;
+
+    for (size_t i = 0; i < OFFER_OUTCOME_COUNT; i++) {
+        const uint64_t n = outcomes_[i].load(std::memory_order_relaxed);
+        if (n > 0 || i == 0) {
+            std::cout << "  " << std::left << std::setw(24) << offerOutcomeName(static_cast<OfferOutcome>(i))
+                      << std::right << n << std::endl;
+        }
+    }
+    std::cout << "  Retries:                " << retries_.load(std::memory_order_relaxed) << std::endl;
+    std::cout << "  Dropped:                " << dropped_.load(std::memory_order_relaxed)
+              << " (timed out: " << timed_out_.load(std::memory_order_relaxed) << ")" << std::endl;
+
+    const StallHistogram& stalls = back_pressure_stalls_;
+    if (stalls.count() > 0) {
+        std::cout << std::fixed << std::setprecision(1)
+                  << "  Back-pressure stalls:   " << stalls.count()
+                  << " (total " << stalls.totalNs() / 1e6 << " ms, p50 <= "
+                  << stalls.percentileNs(50) / 1e3 << " us, p99 <= "
+                  << stalls.percentileNs(99) / 1e3 << " us, max "
+                  << stalls.maxNs() / 1e3 << " us)" << std::endl;
+        stalls.print("    ");
     }
 }
 
@@ -164,59 +468,51 @@ void AeronPublisher::run() {
 
     // 메시지 발행 스레드
     std::thread publish_thread([this]() {
-        uint64_t sequence_number = 0;
-        uint16_t publisher_id = 1;  // Publisher ID (can be configured)
+        // sequence_number 는 commit / batch 전송 시 부여 (drop 된 메시지는 번호 미사용)
+        enableSequencing();
+        const uint16_t publisher_id = config_.publisher_id;
 
         while (running_) {
-            // Create message buffer
-            uint8_t buffer[sizeof(MessageHeader) + 256];  // Header + small payload
-            MessageHeader* header = reinterpret_cast<MessageHeader*>(buffer);
-
-            // Get timestamps
-            int64_t event_time = getCurrentTimeNanos();
-            int64_t publish_time = getCurrentTimeNanos();
-
-            // Initialize header
-            memset(header, 0, sizeof(MessageHeader));
-            header->setMagic();
-            header->version = 1;
-            header->message_type = MSG_TEST;  // Test message type
-            header->sequence_number = sequence_number++;
-            header->event_time_ns = event_time;
-            header->publish_time_ns = publish_time;
-            header->recv_time_ns = 0;  // Will be filled by subscriber
-            header->publisher_id = publisher_id;
-            header->priority = 128;  // Normal priority
-            header->flags = FLAG_NONE;
-            header->session_id = 1;
-            header->checksum = 0;  // Not using checksum for now
-            header->reserved = 0;
-
-            // Create payload (simple test data)
-            char* payload = reinterpret_cast<char*>(buffer + sizeof(MessageHeader));
-            int payload_length = snprintf(payload, 256,
+            // Payload (simple test data)
+            char text[64];
+            int payload_length = snprintf(text, sizeof(text),
                 "Test message %llu from Publisher",
-                (unsigned long long)sequence_number - 1);
-
-            // Set total message length
-            header->message_length = sizeof(MessageHeader) + payload_length;
-
-            // Calculate and set CRC32 checksum
-            header->flags |= FLAG_CHECKSUM_ENABLED;
-            header->checksum = calculateMessageCRC32(
-                header,
-                reinterpret_cast<const uint8_t*>(payload),
-                payload_length
-            );
-
-            // Publish the message
-            if (publish(buffer, header->message_length)) {
-                if (message_count_ % 1000 == 0) {
-                    std::cout << "Published " << message_count_ << " messages. "
-                              << "Recording: " << (isRecording() ? "ON" : "OFF") << std::endl;
+                (unsigned long long)next_sequence_);
+
+            // Header + payload 를 term buffer 에 직접 작성 (tryClaim)
+            MessageClaim message;
+            if (claim(static_cast<uint32_t>(payload_length), message)) {
+                // Get timestamps
+                int64_t event_time = getCurrentTimeNanos();
+                int64_t publish_time = getCurrentTimeNanos();
+
+                // Initialize header (sequence / message_length / checksum: commit())
+                MessageHeader* header = message.header;
+                memset(header, 0, sizeof(MessageHeader));
+                header->setMagic();
+                header->version = 1;
+                header->message_type = MSG_TEST;  // Test message type
+                header->event_time_ns = event_time;
+                header->publish_time_ns = publish_time;
+                header->recv_time_ns = 0;  // Will be filled by subscriber
+                header->publisher_id = publisher_id;
+                header->priority = 128;  // Normal priority
+                header->flags = FLAG_NONE;
+                header->session_id = 1;
+
+                memcpy(message.payload, text, payload_length);
+
+                // Publish the message
+                if (commit(message)) {
+                    if (message_count_ % 1000 == 0) {
+                        std::cout << "Published " << message_count_ << " messages. "
+                                  << "Recording: " << (isRecording() ? "ON" : "OFF") << std::endl;
+                    }
                 }
             }
 
+            // Interval 이 linger 보다 길다: 기다리지 않고 batch 전송
+            flushBatch();
             std::this_thread::sleep_for(std::chrono::milliseconds(config_.message_interval_ms));
         }
     });
@@ -243,7 +539,9 @@ void AeronPublisher::run() {
 
 void AeronPublisher::shutdown() {
     std::cout << "Shutting down Publisher..." << std::endl;
-    
+
+    // 모아 둔 batch (publication 이 아직 유효할 때)
+    flushBatch();
     running_ = false;
     
     if (recording_controller_ && recording_controller_->isRecording()) {
@@ -255,7 +553,14 @@ void AeronPublisher::shutdown() {
     archive_.reset();
     aeron_.reset();
     
-    std::cout << "Publisher shutdown complete. Total messages: " << message_count_ << std::endl;
+    std::cout << "Publisher shutdown complete. Total messages: " << message_count_
+              << " (claimed: " << claimed_count_ << ", offered: " << offered_count_ << ")" << std::endl;
+    if (batches_sent_ > 0) {
+        std::cout << "Batched: " << batched_messages_ << " messages in " << batches_sent_
+                  << " envelopes (avg " << std::fixed << std::setprecision(1)
+                  << static_cast<double>(batched_messages_) / batches_sent_ << " per frame)" << std::endl;
+    }
+    printPublishStatistics();
 }
 
 } // namespace example
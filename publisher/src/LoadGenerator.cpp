@@ -0,0 +1,317 @@
+#include "LoadGenerator.h"
+#include "IdleStrategy.h"
+#include "NanoClock.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace aeron {
+namespace example {
+
+namespace {
+
+// 남은 시간이 이보다 길면 sleep (짧으면 spin)
+constexpr int64_t SLEEP_THRESHOLD_NS = 1'000'000;
+constexpr int64_t SLEEP_MARGIN_NS = 500'000;
+
+constexpr int64_t REPORT_INTERVAL_NS = 1'000'000'000;
+
+uint32_t parseSize(const std::string& text, const std::string& spec) {
+    try {
+        size_t used = 0;
+        const unsigned long value = std::stoul(text, &used);
+        if (used == text.size() && value <= std::numeric_limits<uint32_t>::max()) {
+            return static_cast<uint32_t>(value);
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::invalid_argument("Invalid payload size '" + text + "' in '" + spec + "'");
+}
+
+// xorshift64 (payload 크기 선택용, 품질보다 속도)
+uint64_t nextRandom(uint64_t& state) noexcept {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+} // namespace
+
+PayloadDistribution PayloadDistribution::parse(const std::string& spec) {
+    const size_t colon = spec.find(':');
+    if (colon == std::string::npos) {
+        throw std::invalid_argument("Invalid payload distribution '" + spec +
+                                    "' (expected fixed:N, uniform:MIN-MAX or file:PATH)");
+    }
+    const std::string kind = spec.substr(0, colon);
+    const std::string value = spec.substr(colon + 1);
+
+    PayloadDistribution distribution;
+    distribution.spec_ = spec;
+
+    if (kind == "fixed") {
+        distribution.min_ = distribution.max_ = parseSize(value, spec);
+    } else if (kind == "uniform") {
+        const size_t dash = value.find('-');
+        if (dash == std::string::npos) {
+            throw std::invalid_argument("Invalid uniform distribution '" + spec + "' (expected uniform:MIN-MAX)");
+        }
+        distribution.min_ = parseSize(value.substr(0, dash), spec);
+        distribution.max_ = parseSize(value.substr(dash + 1), spec);
+        if (distribution.min_ > distribution.max_) {
+            throw std::invalid_argument("Invalid uniform distribution '" + spec + "' (MIN > MAX)");
+        }
+    } else if (kind == "file") {
+        std::ifstream file(value);
+        if (!file) {
+            throw std::invalid_argument("Cannot open payload size file: " + value);
+        }
+
+        // 줄마다 "size [weight]" (# 주석, 빈 줄 무시)
+        std::vector<std::pair<uint32_t, double>> entries;
+        double total_weight = 0.0;
+        std::string line;
+        while (std::getline(file, line)) {
+            const size_t hash = line.find('#');
+            if (hash != std::string::npos) {
+                line.erase(hash);
+            }
+            std::istringstream fields(line);
+            std::string size_text;
+            if (!(fields >> size_text)) {
+                continue;
+            }
+            double weight = 1.0;
+            std::string weight_text;
+            if (fields >> weight_text) {
+                try {
+                    weight = std::stod(weight_text);
+                } catch (const std::exception&) {
+                    weight = -1.0;
+                }
+                if (!(weight >= 0.0)) {
+                    throw std::invalid_argument("Invalid weight '" + weight_text + "' in " + value);
+                }
+            }
+            entries.emplace_back(parseSize(size_text, spec), weight);
+            total_weight += weight;
+        }
+        if (entries.empty() || total_weight <= 0.0) {
+            throw std::invalid_argument("Payload size file has no sizes: " + value);
+        }
+
+        // Inverse CDF: table[k] = 누적 weight 가 (k + 0.5) / TABLE_SIZE 를 넘는 첫 size
+        distribution.table_.resize(TABLE_SIZE);
+        distribution.min_ = std::numeric_limits<uint32_t>::max();
+        distribution.max_ = 0;
+        size_t entry = 0;
+        double cumulative = entries[0].second;
+        for (size_t k = 0; k < TABLE_SIZE; k++) {
+            const double target = (static_cast<double>(k) + 0.5) / TABLE_SIZE * total_weight;
+            while (cumulative < target && entry + 1 < entries.size()) {
+                cumulative += entries[++entry].second;
+            }
+            const uint32_t size = entries[entry].first;
+            distribution.table_[k] = size;
+            distribution.min_ = std::min(distribution.min_, size);
+            distribution.max_ = std::max(distribution.max_, size);
+        }
+    } else {
+        throw std::invalid_argument("Unknown payload distribution '" + kind +
+                                    "' (expected fixed, uniform or file)");
+    }
+
+    return distribution;
+}
+
+LoadGenerator::LoadGenerator(AeronPublisher& publisher, const LoadGeneratorConfig& config)
+    : publisher_(publisher)
+    , config_(config)
+    , interval_ns_(config.rate > 0 ? 1e9 / config.rate : 0.0)
+    , stats_() {
+    if (config_.burst == 0) {
+        config_.burst = 1;
+    }
+}
+
+int64_t LoadGenerator::scheduleOffset(uint64_t index) const noexcept {
+    // Burst 단위로 같은 intended time (burst 간격 = burst × interval)
+    const uint64_t first_of_burst = index - index % config_.burst;
+    int64_t offset = static_cast<int64_t>(static_cast<double>(first_of_burst) * interval_ns_);
+
+    // On/off: on 구간의 누적 시간 → 실제 시간 (off 구간 건너뜀)
+    if (config_.on_ms > 0 && config_.off_ms > 0) {
+        const int64_t on_ns = config_.on_ms * 1'000'000;
+        const int64_t period_ns = on_ns + config_.off_ms * 1'000'000;
+        offset = (offset / on_ns) * period_ns + offset % on_ns;
+    }
+    return offset;
+}
+
+bool LoadGenerator::run(const std::atomic<bool>& running) {
+    const int32_t max_message = publisher_.maxMessageLength();
+    if (max_message > 0 &&
+        sizeof(MessageHeader) + config_.payload.maxSize() > static_cast<size_t>(max_message)) {
+        std::cerr << "Payload " << config_.payload.maxSize() << " B exceeds publication max message length ("
+                  << max_message << " B incl. " << sizeof(MessageHeader) << " B header)" << std::endl;
+        return false;
+    }
+
+    stats_ = Statistics();
+    uint64_t random = config_.seed != 0 ? config_.seed : 1;
+    const uint16_t publisher_id = publisher_.config().publisher_id;
+
+    // burst 간격을 넘겨 전송되면 late (rate 0: 제한 없음, late 없음)
+    const int64_t late_threshold_ns = static_cast<int64_t>(interval_ns_ * config_.burst);
+
+    const int64_t start = NanoClock::nanoTime();
+    const int64_t end = config_.duration_s > 0
+        ? start + static_cast<int64_t>(config_.duration_s * 1e9)
+        : std::numeric_limits<int64_t>::max();
+    int64_t next_report = start + REPORT_INTERVAL_NS;
+    uint64_t last_report_sent = 0;
+
+    // index = schedule 위치. sequence 는 publisher 가 전송 시점에 부여:
+    // 정책이 drop 한 메시지 (batch envelope 포함) 는 번호를 쓰지 않음.
+    // sent / dropped 도 publisher 기준 (batch 모드의 commit 은 아직 전송 전)
+    publisher_.enableSequencing();
+    const uint64_t dropped_before = publisher_.droppedMessages();
+
+    // payload_bytes: publisher 호출 1번은 batch 전체 또는 메시지 1개를 보내거나
+    // drop 함 → batch 가 비었을 때 sequence 가 늘었으면 그동안 commit 한 payload 전송
+    uint64_t unsettled_bytes = 0;
+    uint64_t settled_sequence = 0;
+    auto settle = [&]() {
+        if (publisher_.pendingBatchMessages() != 0) {
+            return;
+        }
+        const uint64_t sequence = publisher_.nextSequence();
+        if (sequence != settled_sequence) {
+            stats_.payload_bytes += unsettled_bytes;
+        }
+        unsettled_bytes = 0;
+        settled_sequence = sequence;
+    };
+
+    for (uint64_t index = 0; running.load(std::memory_order_relaxed); index++) {
+        if (config_.count > 0 && index >= config_.count) {
+            break;
+        }
+        const int64_t intended = start + scheduleOffset(index);
+        if (intended >= end) {
+            break;
+        }
+
+        // Pacing: intended time 까지 대기 (이미 지났으면 바로 전송)
+        int64_t now = NanoClock::nanoTime();
+        while (now < intended && running.load(std::memory_order_relaxed)) {
+            if (intended - now > SLEEP_THRESHOLD_NS) {
+                publisher_.flushBatch();   // sleep 동안 batch 를 붙잡지 않음
+                settle();
+                std::this_thread::sleep_for(std::chrono::nanoseconds(intended - now - SLEEP_MARGIN_NS));
+            } else {
+                publisher_.flushBatchIfDue(now);
+                settle();
+                IdleStrategy::cpuPause();
+            }
+            now = NanoClock::nanoTime();
+        }
+
+        const uint32_t payload_length = config_.payload.sample(nextRandom(random));
+
+        // Back pressure: AeronPublisher 의 publish 정책 (retry / bounded / drop)
+        MessageClaim message;
+        const bool claimed = publisher_.claim(payload_length, message);
+        settle();   // claim 이 앞선 batch 를 전송했을 수 있음
+        if (!claimed) {
+            continue;
+        }
+
+        MessageHeader* header = message.header;
+        memset(header, 0, sizeof(MessageHeader));
+        header->setMagic();
+        header->version = 1;
+        header->message_type = MSG_TEST;
+        header->event_time_ns = static_cast<uint64_t>(intended);   // Intended send time
+        header->publisher_id = publisher_id;
+        header->priority = 128;
+        header->flags = FLAG_NONE;
+        header->session_id = 1;
+        memset(message.payload, static_cast<int>(index & 0xFF), payload_length);
+
+        const int64_t sent_at = NanoClock::nanoTime();
+        header->publish_time_ns = static_cast<uint64_t>(sent_at);
+
+        stats_.committed++;
+        unsettled_bytes += payload_length;
+        publisher_.commit(message);
+        settle();
+
+        const int64_t lag = sent_at - intended;
+        stats_.total_lag_ns += lag;
+        if (lag > stats_.max_lag_ns) {
+            stats_.max_lag_ns = lag;
+        }
+        if (late_threshold_ns > 0 && lag > late_threshold_ns) {
+            stats_.late++;
+        }
+
+        if (sent_at >= next_report) {
+            const uint64_t sent = publisher_.nextSequence();
+            std::cout << "Load: " << sent << " sent ("
+                      << (sent - last_report_sent) << " msg/s), max lag "
+                      << stats_.max_lag_ns / 1000 << " μs, dropped "
+                      << publisher_.droppedMessages() - dropped_before << std::endl;
+            last_report_sent = sent;
+            next_report += REPORT_INTERVAL_NS;
+        }
+    }
+
+    publisher_.flushBatch();
+    settle();
+    stats_.elapsed_ns = NanoClock::nanoTime() - start;
+    stats_.sent = publisher_.nextSequence();
+    stats_.dropped = publisher_.droppedMessages() - dropped_before;
+    return true;
+}
+
+void LoadGenerator::printStatistics() const {
+    const double seconds = static_cast<double>(stats_.elapsed_ns) / 1e9;
+    const uint64_t attempts = stats_.committed;
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Load Generator" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Target:        " << config_.rate << " msg/s, burst " << config_.burst;
+    if (config_.on_ms > 0 && config_.off_ms > 0) {
+        std::cout << ", on/off " << config_.on_ms << "/" << config_.off_ms << " ms";
+    }
+    std::cout << ", payload " << config_.payload.describe() << std::endl;
+    std::cout << "Sent:          " << stats_.sent << " of " << stats_.committed << " committed in "
+              << seconds << " s" << std::endl;
+    if (seconds > 0) {
+        std::cout << "Achieved:      " << static_cast<double>(stats_.sent) / seconds << " msg/s, "
+                  << static_cast<double>(stats_.payload_bytes) / seconds / 1e6 << " MB/s payload" << std::endl;
+    }
+    std::cout << "Dropped:       " << stats_.dropped << " (publish policy gave up)" << std::endl;
+    if (attempts > 0) {
+        std::cout << std::setprecision(2)
+                  << "Send lag:      avg " << static_cast<double>(stats_.total_lag_ns) / attempts / 1000.0
+                  << " μs, max " << static_cast<double>(stats_.max_lag_ns) / 1000.0
+                  << " μs (intended → actual)" << std::endl;
+        std::cout << "Late:          " << stats_.late << " (sent after the next scheduled burst)" << std::endl;
+    }
+    std::cout << "========================================" << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
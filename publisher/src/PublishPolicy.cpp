@@ -0,0 +1,136 @@
+#include "PublishPolicy.h"
+#include "Aeron.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace aeron {
+namespace example {
+
+namespace {
+
+// 1234 ns → "1.2 us"
+std::string formatNanos(int64_t ns) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (ns < 1000) {
+        out << ns << " ns";
+    } else if (ns < 1'000'000) {
+        out << ns / 1e3 << " us";
+    } else if (ns < 1'000'000'000) {
+        out << ns / 1e6 << " ms";
+    } else {
+        out << ns / 1e9 << " s";
+    }
+    return out.str();
+}
+
+} // namespace
+
+const char* publishPolicyName(PublishPolicy policy) noexcept {
+    switch (policy) {
+        case PublishPolicy::RETRY:   return "retry";
+        case PublishPolicy::BOUNDED: return "bounded";
+        case PublishPolicy::DROP:    return "drop";
+    }
+    return "unknown";
+}
+
+PublishPolicy parsePublishPolicy(const std::string& name) {
+    if (name == "retry") {
+        return PublishPolicy::RETRY;
+    }
+    if (name == "bounded") {
+        return PublishPolicy::BOUNDED;
+    }
+    if (name == "drop") {
+        return PublishPolicy::DROP;
+    }
+    throw std::invalid_argument("Unknown publish policy '" + name + "' (expected retry, bounded or drop)");
+}
+
+OfferOutcome classifyOfferResult(std::int64_t result) noexcept {
+    if (result > 0) {
+        return OfferOutcome::SUCCESS;
+    }
+    if (result == aeron::BACK_PRESSURED) {
+        return OfferOutcome::BACK_PRESSURED;
+    }
+    if (result == aeron::NOT_CONNECTED) {
+        return OfferOutcome::NOT_CONNECTED;
+    }
+    if (result == aeron::ADMIN_ACTION) {
+        return OfferOutcome::ADMIN_ACTION;
+    }
+    if (result == aeron::PUBLICATION_CLOSED) {
+        return OfferOutcome::CLOSED;
+    }
+    if (result == aeron::MAX_POSITION_EXCEEDED) {
+        return OfferOutcome::MAX_POSITION_EXCEEDED;
+    }
+    return OfferOutcome::ERROR;
+}
+
+const char* offerOutcomeName(OfferOutcome outcome) noexcept {
+    switch (outcome) {
+        case OfferOutcome::SUCCESS:               return "success";
+        case OfferOutcome::BACK_PRESSURED:        return "back pressured";
+        case OfferOutcome::NOT_CONNECTED:         return "not connected";
+        case OfferOutcome::ADMIN_ACTION:          return "admin action";
+        case OfferOutcome::CLOSED:                return "closed";
+        case OfferOutcome::MAX_POSITION_EXCEEDED: return "max position exceeded";
+        case OfferOutcome::ERROR:                 return "error";
+        case OfferOutcome::COUNT:                 break;
+    }
+    return "unknown";
+}
+
+void StallHistogram::record(int64_t ns) noexcept {
+    if (ns < 1) {
+        ns = 1;
+    }
+    size_t bucket = static_cast<size_t>(63 - __builtin_clzll(static_cast<uint64_t>(ns)));
+    if (bucket >= BUCKETS) {
+        bucket = BUCKETS - 1;
+    }
+    bump(buckets_[bucket]);
+    bump(count_);
+    total_ns_.store(total_ns_.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+    if (ns > max_ns_.load(std::memory_order_relaxed)) {
+        max_ns_.store(ns, std::memory_order_relaxed);
+    }
+}
+
+int64_t StallHistogram::percentileNs(double percentile) const noexcept {
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+    const double target = percentile / 100.0 * static_cast<double>(total);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; i++) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (static_cast<double>(seen) >= target && seen > 0) {
+            return std::min(static_cast<int64_t>(1) << (i + 1), maxNs());
+        }
+    }
+    return maxNs();
+}
+
+void StallHistogram::print(const char* prefix) const {
+    for (size_t i = 0; i < BUCKETS; i++) {
+        const uint64_t n = buckets_[i].load(std::memory_order_relaxed);
+        if (n == 0) {
+            continue;
+        }
+        std::cout << prefix << std::left << std::setw(22)
+                  << (formatNanos(static_cast<int64_t>(1) << i) + " - " +
+                      formatNanos(static_cast<int64_t>(1) << (i + 1)))
+                  << std::right << n << std::endl;
+    }
+}
+
+} // namespace example
+} // namespace aeron
@@ -0,0 +1,165 @@
+#include "StagedPublisher.h"
+#include "NanoClock.h"
+#include "ThreadUtil.h"
+#include <cstring>
+#include <iostream>
+
+namespace aeron {
+namespace example {
+
+StagedPublisher::StagedPublisher(AeronPublisher& publisher, const StagedPublisherConfig& config)
+    : publisher_(publisher)
+    , config_(config)
+    , ring_(config.ring_bytes)
+    , idle_(IdleStrategy::create(config.sender_idle)) {
+    if (config_.drain_limit == 0) {
+        config_.drain_limit = 1;
+    }
+    // Sequence 는 실제 전송 시점에 (batch envelope 가 drop 되어도 gap 없음)
+    publisher_.enableSequencing();
+}
+
+StagedPublisher::~StagedPublisher() {
+    stop();
+}
+
+void StagedPublisher::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    sender_ = std::thread(&StagedPublisher::senderLoop, this);
+    std::cout << "StagedPublisher started: ring " << (ring_.capacity() / 1024) << " KB, "
+              << "drain " << config_.drain_limit << ", idle " << idle_->name() << std::endl;
+}
+
+void StagedPublisher::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (sender_.joinable()) {
+        sender_.join();
+    }
+}
+
+bool StagedPublisher::claim(uint32_t payload_length, MessageClaim& message) noexcept {
+    uint8_t* frame = ring_.claim(sizeof(MessageHeader) + payload_length);
+    if (!frame) {
+        return false;
+    }
+
+    MessageHeader* header = reinterpret_cast<MessageHeader*>(frame);
+    memset(header, 0, sizeof(MessageHeader));
+    header->setMagic();
+    header->version = 1;
+    header->priority = 128;
+    header->session_id = 1;
+
+    message.header = header;
+    message.payload = frame + sizeof(MessageHeader);
+    message.payload_length = payload_length;
+    message.claimed = false;
+    return true;
+}
+
+void StagedPublisher::commit(MessageClaim& message) noexcept {
+    ring_.commit(reinterpret_cast<uint8_t*>(message.header));
+    message.header = nullptr;
+    message.payload = nullptr;
+}
+
+void StagedPublisher::abort(MessageClaim& message) noexcept {
+    if (message.header) {
+        ring_.abort(reinterpret_cast<uint8_t*>(message.header));
+    }
+    message.header = nullptr;
+    message.payload = nullptr;
+}
+
+bool StagedPublisher::submit(uint16_t message_type, const void* payload, uint32_t payload_length,
+                             uint64_t event_time_ns) noexcept {
+    MessageClaim message;
+    if (!claim(payload_length, message)) {
+        return false;
+    }
+    message.header->message_type = message_type;
+    message.header->event_time_ns = event_time_ns;
+    if (payload_length > 0) {
+        memcpy(message.payload, payload, payload_length);
+    }
+    commit(message);
+    return true;
+}
+
+void StagedPublisher::senderLoop() {
+    ThreadUtil::setCurrentThreadName("aeron-sender");
+
+    while (running_.load(std::memory_order_acquire)) {
+        idle_->idle(static_cast<int>(drain()));
+    }
+
+    // 종료 전 남은 메시지 (producer 는 이미 멈춘 상태여야 함)
+    while (drain() > 0) {
+    }
+}
+
+size_t StagedPublisher::drain() {
+    const uint16_t publisher_id = publisher_.config().publisher_id;
+
+    const size_t count = ring_.read([&](uint8_t* data, size_t length) {
+        MessageHeader* header = reinterpret_cast<MessageHeader*>(data);
+        const uint32_t payload_length = static_cast<uint32_t>(length - sizeof(MessageHeader));
+
+        // Drain 순서 = stream 순서, sequence_number 는 publisher 가 전송 시 부여
+        header->publisher_id = publisher_id;
+        header->publish_time_ns = static_cast<uint64_t>(NanoClock::nanoTime());
+        publisher_.publishMessage(header, payload_length);
+    }, config_.drain_limit);
+
+    if (count > 0) {
+        bump(batches_);
+        handed_over_ += count;
+    }
+    // Ring 을 다 비웠으면 모은 batch envelope 전송 (linger 까지 기다리지 않음)
+    if (count < config_.drain_limit) {
+        publisher_.flushBatch();
+    }
+
+    // publishMessage() 의 true 는 "batch 에 들어감" 일 수 있으므로 결과는
+    // publisher 기준: sent = 전송된 sequence 수, batch 에 남은 메시지는 미정
+    const uint64_t sent = publisher_.nextSequence();
+    sent_.store(sent, std::memory_order_relaxed);
+    dropped_.store(handed_over_ - sent - publisher_.pendingBatchMessages(), std::memory_order_relaxed);
+    return count;
+}
+
+StagedPublisher::Statistics StagedPublisher::getStatistics() const noexcept {
+    Statistics stats;
+    stats.sent = sent_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.batches = batches_.load(std::memory_order_relaxed);
+    stats.ring_full = ring_.fullCount();
+    stats.oversize = ring_.oversizeCount();
+    return stats;
+}
+
+void StagedPublisher::printStatistics() const {
+    const Statistics stats = getStatistics();
+
+    std::cout << "\n=== Staged Publisher Statistics ===" << std::endl;
+    std::cout << "Sent:              " << stats.sent << std::endl;
+    std::cout << "Dropped (policy):  " << stats.dropped << std::endl;
+    std::cout << "Batches:           " << stats.batches;
+    if (stats.batches > 0) {
+        std::cout << " (avg " << static_cast<double>(stats.sent + stats.dropped) / stats.batches
+                  << " msgs)";
+    }
+    std::cout << std::endl;
+    std::cout << "Ring full:         " << stats.ring_full << std::endl;
+    std::cout << "Oversize:          " << stats.oversize << std::endl;
+    std::cout << "Padding records:   " << ring_.paddingRecords() << std::endl;
+    idle_->printStatistics("Sender idle");
+    std::cout << "===================================\n" << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
@@ -1,9 +1,18 @@
 #include "AeronPublisher.h"
 #include "ConfigLoader.h"
+#include "LoadGenerator.h"
+#include "NanoClock.h"
+#include "StagedPublisher.h"
+#include "ThreadUtil.h"
+#include <chrono>
 #include <iostream>
 #include <csignal>
 #include <getopt.h>
 #include <cstdlib>
+#include <cstdio>
+#include <cinttypes>
+#include <thread>
+#include <vector>
 
 static std::atomic<bool> running(true);
 
@@ -23,6 +32,21 @@ void printUsage(const char* program_name) {
               << "  --archive-response <channel> Archive response channel (override config)\n"
               << "  --interval <ms>              Message interval in ms (default: 100)\n"
               << "  --auto-record                Automatically start recording on startup\n"
+              << "  --checksum <type>            Message checksum: crc32c|crc32|none (default: crc32c)\n"
+              << "  --no-claim                   Publish with offer (copy) instead of tryClaim\n"
+              << "  --publish-policy <policy>    On back pressure: retry|bounded|drop (override config)\n"
+              << "  --publish-timeout <ms>       bounded: give up after ms (override config)\n"
+              << "  --batch                      Pack small messages into one frame (MSG_BATCH envelope)\n"
+              << "  --batch-bytes <n>            Envelope budget in bytes (default: publication MTU)\n"
+              << "  --batch-linger <us>          Send a partial envelope after us (override config)\n"
+              << "  --producers <n>              Publish from n threads through one sender (staging ring)\n"
+              << "  --publisher-id <id>          publisher_id in every header (default: 1)\n"
+              << "  --load-rate <msg/s>          Load generator mode: open-loop at this rate (0: max)\n"
+              << "  --load-duration <s>          Load duration in seconds (default: 10, 0: until Ctrl+C)\n"
+              << "  --load-count <n>             Stop after n messages (default: duration only)\n"
+              << "  --load-burst <n>             Messages per scheduled send (default: 1)\n"
+              << "  --load-on-off <on>:<off>     Send for on ms, pause for off ms, repeat\n"
+              << "  --load-payload <spec>        fixed:N | uniform:MIN-MAX | file:PATH (default: fixed:64)\n"
               << "  --print-config               Print current configuration and exit\n"
               << "  -h, --help                   Show this help message\n"
               << "\nExamples:\n"
@@ -33,6 +57,17 @@ void printUsage(const char* program_name) {
               << "  " << program_name << " --config config/aeron-distributed.ini \\\n"
               << "    --pub-channel aeron:udp?endpoint=224.0.1.2:40456\n"
               << "\n"
+              << "  # Capacity test: 1M msg/s for 30 s, 32-512 B payloads\n"
+              << "  " << program_name << " --config config/aeron-local.ini \\\n"
+              << "    --load-rate 1000000 --load-duration 30 --load-payload uniform:32-512\n"
+              << "\n"
+              << "  # Tick-sized messages, many per frame\n"
+              << "  " << program_name << " --config config/aeron-local.ini \\\n"
+              << "    --load-rate 2000000 --load-payload fixed:40 --batch\n"
+              << "\n"
+              << "  # 4 application threads sharing one publication\n"
+              << "  " << program_name << " --config config/aeron-local.ini --producers 4 --interval 1\n"
+              << "\n"
               << "  # Use default (AeronConfig.h) without config file\n"
               << "  " << program_name << "\n"
               << std::endl;
@@ -54,6 +89,17 @@ int main(int argc, char** argv) {
     std::string override_archive_response;
     int override_interval = -1;
     bool auto_record = false;
+    std::string checksum;
+    bool no_claim = false;
+    std::string override_publish_policy;
+    long long override_publish_timeout = -1;
+    bool batch = false;
+    long long override_batch_bytes = -1;
+    long long override_batch_linger = -1;
+    int producers = 0;
+    int override_publisher_id = -1;
+    bool load_mode = false;
+    aeron::example::LoadGeneratorConfig load_config;
 
     // 커맨드라인 옵션 정의
     static struct option long_options[] = {
@@ -65,6 +111,21 @@ int main(int argc, char** argv) {
         {"archive-response", required_argument, 0, 'p'},
         {"interval",         required_argument, 0, 'i'},
         {"auto-record",      no_argument,       0, 'A'},
+        {"checksum",         required_argument, 0, 'k'},
+        {"no-claim",         no_argument,       0, 'n'},
+        {"publish-policy",   required_argument, 0, 'R'},
+        {"publish-timeout",  required_argument, 0, 'T'},
+        {"batch",            no_argument,       0, 'b'},
+        {"batch-bytes",      required_argument, 0, 'S'},
+        {"batch-linger",     required_argument, 0, 'G'},
+        {"producers",        required_argument, 0, 'N'},
+        {"publisher-id",     required_argument, 0, 'I'},
+        {"load-rate",        required_argument, 0, 'L'},
+        {"load-duration",    required_argument, 0, 'D'},
+        {"load-count",       required_argument, 0, 'C'},
+        {"load-burst",       required_argument, 0, 'B'},
+        {"load-on-off",      required_argument, 0, 'O'},
+        {"load-payload",     required_argument, 0, 'Y'},
         {"print-config",     no_argument,       0, 'P'},
         {"help",             no_argument,       0, 'h'},
         {0, 0, 0, 0}
@@ -99,6 +160,61 @@ int main(int argc, char** argv) {
             case 'A':
                 auto_record = true;
                 break;
+            case 'k':
+                checksum = optarg;
+                break;
+            case 'n':
+                no_claim = true;
+                break;
+            case 'R':
+                override_publish_policy = optarg;
+                break;
+            case 'T':
+                override_publish_timeout = std::atoll(optarg);
+                break;
+            case 'b':
+                batch = true;
+                break;
+            case 'S':
+                override_batch_bytes = std::atoll(optarg);
+                break;
+            case 'G':
+                override_batch_linger = std::atoll(optarg);
+                break;
+            case 'N':
+                producers = std::atoi(optarg);
+                break;
+            case 'I':
+                override_publisher_id = std::atoi(optarg);
+                break;
+            case 'L':
+                load_mode = true;
+                load_config.rate = std::atof(optarg);
+                break;
+            case 'D':
+                load_config.duration_s = std::atof(optarg);
+                break;
+            case 'C':
+                load_config.count = std::strtoull(optarg, nullptr, 10);
+                break;
+            case 'B':
+                load_config.burst = static_cast<uint32_t>(std::atoi(optarg));
+                break;
+            case 'O':
+                if (std::sscanf(optarg, "%" SCNd64 ":%" SCNd64, &load_config.on_ms, &load_config.off_ms) != 2 ||
+                    load_config.on_ms <= 0 || load_config.off_ms <= 0) {
+                    std::cerr << "Invalid --load-on-off '" << optarg << "' (expected <on_ms>:<off_ms>)" << std::endl;
+                    return 1;
+                }
+                break;
+            case 'Y':
+                try {
+                    load_config.payload = aeron::example::PayloadDistribution::parse(optarg);
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                    return 1;
+                }
+                break;
             case 'P':
                 print_config_only = true;
                 break;
@@ -150,6 +266,35 @@ int main(int argc, char** argv) {
         std::cout << "Override: archive_response = " << override_archive_response << std::endl;
     }
 
+    if (!override_publish_policy.empty()) {
+        aeron_settings.publish.policy = override_publish_policy;
+        std::cout << "Override: publish.policy = " << override_publish_policy << std::endl;
+    }
+    if (override_publish_timeout != -1) {
+        aeron_settings.publish.timeout_ms = override_publish_timeout;
+        std::cout << "Override: publish.timeout_ms = " << override_publish_timeout << std::endl;
+    }
+    if (batch) {
+        aeron_settings.publish.batch = true;
+        std::cout << "Override: publish.batch = true" << std::endl;
+    }
+    if (override_batch_bytes != -1) {
+        aeron_settings.publish.batch_bytes = override_batch_bytes;
+        std::cout << "Override: publish.batch_bytes = " << override_batch_bytes << std::endl;
+    }
+    if (override_batch_linger != -1) {
+        aeron_settings.publish.batch_linger_us = override_batch_linger;
+        std::cout << "Override: publish.batch_linger_us = " << override_batch_linger << std::endl;
+    }
+    if (!override_publish_policy.empty() || override_publish_timeout != -1 || batch ||
+        override_batch_bytes != -1 || override_batch_linger != -1) {
+        std::string error_message;
+        if (!aeron_settings.validate(error_message)) {
+            std::cerr << "Invalid publish settings: " << error_message << std::endl;
+            return 1;
+        }
+    }
+
     // 4. Config 출력 모드
     if (print_config_only) {
         aeron_settings.print();
@@ -164,20 +309,121 @@ int main(int argc, char** argv) {
     pub_config.archive_control_request_channel = aeron_settings.archive_control_request_channel;
     pub_config.archive_control_response_channel = aeron_settings.archive_control_response_channel;
     pub_config.auto_record = auto_record;
+    pub_config.use_claim = !no_claim;
+    pub_config.publish_policy = aeron::example::parsePublishPolicy(aeron_settings.publish.policy);
+    pub_config.publish_timeout_ms = aeron_settings.publish.timeout_ms;
+    pub_config.retry_idle = aeron_settings.publisher_idle;
+    pub_config.batch = aeron_settings.publish.batch;
+    pub_config.batch_bytes = static_cast<uint32_t>(aeron_settings.publish.batch_bytes);
+    pub_config.batch_linger_us = aeron_settings.publish.batch_linger_us;
 
+    if (override_publisher_id != -1) {
+        if (override_publisher_id < 0 || override_publisher_id > 0xFFFF) {
+            std::cerr << "Invalid --publisher-id " << override_publisher_id << " (0-65535)" << std::endl;
+            return 1;
+        }
+        pub_config.publisher_id = static_cast<uint16_t>(override_publisher_id);
+    }
     if (override_interval != -1) {
         pub_config.message_interval_ms = override_interval;
     }
+    if (!checksum.empty()) {
+        try {
+            pub_config.checksum = aeron::example::parseChecksumType(checksum);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+    if (pub_config.checksum == aeron::example::ChecksumType::CRC32C) {
+        std::cout << "Checksum: crc32c (" << aeron::example::checksum::crc32cImplementation()
+                  << ")" << std::endl;
+    } else {
+        std::cout << "Checksum: " << aeron::example::checksumTypeName(pub_config.checksum) << std::endl;
+    }
+
+    std::cout << "Publish: " << (pub_config.use_claim ? "tryClaim (zero-copy, offer above MTU)" : "offer")
+              << ", policy " << aeron::example::publishPolicyName(pub_config.publish_policy);
+    if (pub_config.publish_policy == aeron::example::PublishPolicy::BOUNDED) {
+        std::cout << " (" << pub_config.publish_timeout_ms << " ms)";
+    }
+    if (pub_config.batch) {
+        std::cout << ", batch (linger " << pub_config.batch_linger_us << " us)";
+    }
+    std::cout << std::endl;
+
+    if (load_mode && (load_config.rate < 0 || load_config.burst == 0)) {
+        std::cerr << "Invalid load generator settings (rate >= 0, burst >= 1)" << std::endl;
+        return 1;
+    }
+    if (producers < 0 || (producers > 0 && load_mode)) {
+        std::cerr << "Invalid --producers (n >= 1, not combined with --load-rate)" << std::endl;
+        return 1;
+    }
 
     // 6. Publisher 실행
     aeron::example::AeronPublisher publisher(pub_config);
+    publisher.setRunningFlag(&running);   // Ctrl+C 가 back pressure 재시도도 끝냄
 
     if (!publisher.initialize()) {
         std::cerr << "Failed to initialize publisher" << std::endl;
         return 1;
     }
 
-    publisher.run();
+    if (producers > 0) {
+        // 7a. N 개 app 스레드 → staging ring → sender 스레드 1개 (Ctrl+C 로 중단)
+        aeron::example::NanoClock::start();
+        aeron::example::StagedPublisher staged(publisher, aeron::example::StagedPublisherConfig());
+        staged.start();
+
+        const int interval_ms = pub_config.message_interval_ms;
+        std::vector<std::thread> threads;
+        std::vector<uint64_t> submitted(producers, 0);
+        for (int i = 0; i < producers; i++) {
+            threads.emplace_back([&staged, &submitted, interval_ms, i]() {
+                aeron::example::ThreadUtil::setCurrentThreadName("producer-" + std::to_string(i));
+                uint64_t k = 0;
+                while (running) {
+                    char text[64];
+                    const int length = snprintf(text, sizeof(text),
+                        "Test message %llu from producer %d", (unsigned long long)k, i);
+                    if (staged.submit(aeron::example::MSG_TEST, text, static_cast<uint32_t>(length),
+                                      static_cast<uint64_t>(aeron::example::NanoClock::nanoTime()))) {
+                        k++;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+                }
+                submitted[i] = k;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        staged.stop();
+
+        for (int i = 0; i < producers; i++) {
+            std::cout << "Producer " << i << ": " << submitted[i] << " submitted" << std::endl;
+        }
+        staged.printStatistics();
+        aeron::example::NanoClock::stop();
+        return 0;
+    }
+
+    if (!load_mode) {
+        publisher.run();
+        return 0;
+    }
+
+    // 7. Load generator (main 스레드에서 open-loop 전송, Ctrl+C 로 중단)
+    aeron::example::NanoClock::start();
+    std::cout << "Load generator: " << load_config.rate << " msg/s, burst " << load_config.burst
+              << ", payload " << load_config.payload.describe()
+              << " (clock: " << aeron::example::NanoClock::source() << ")" << std::endl;
+
+    aeron::example::LoadGenerator generator(publisher, load_config);
+    const bool completed = generator.run(running);
+    generator.printStatistics();
 
-    return 0;
+    aeron::example::NanoClock::stop();
+    return completed ? 0 : 1;
 }
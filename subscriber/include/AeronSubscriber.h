@@ -5,16 +5,63 @@
 #include <atomic>
 #include <string>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 #include "Aeron.h"
 #include "client/AeronArchive.h"
 #include "client/ReplayMerge.h"
-#include "BufferPool.h"
+#include "SizeClassBufferPool.h"
 #include "MessageQueue.h"
+#include "MessageViewQueue.h"
+#include "ByteRingBuffer.h"
 #include "CheckpointManager.h"
+#include "GapFillAgent.h"
+#include "ShardRouter.h"
+#include "SequenceWindow.h"
+#include "IdleStrategy.h"
+#include "MessageValidator.h"
 
 namespace aeron {
 namespace example {
 
+/**
+ * Receive mode
+ *
+ * - COPY:     memcpy each fragment into a pooled MessageBuffer (default)
+ * - IN_PLACE: hand the worker a MessageView into the term buffer; the image
+ *             position only advances once the worker releases the fragment
+ * - RING:     memcpy each message into one contiguous byte ring (variable
+ *             length records, no pool / pointer queue; see ByteRingBuffer)
+ */
+enum class ReceiveMode {
+    COPY,
+    IN_PLACE,
+    RING
+};
+
+/**
+ * Downstream exhaustion policy (buffer pool / message queue)
+ *
+ * - DROP:         drop the message and count it (conflatable market data)
+ * - BACKPRESSURE: stop consuming the image (controlled poll ABORT); the
+ *                 fragment is re-delivered on the next poll and Aeron flow
+ *                 control pushes back to the publisher (order flow)
+ */
+enum class OverflowPolicy {
+    DROP,
+    BACKPRESSURE
+};
+
+/**
+ * One subscribed channel/stream pair ([stream.<name>] INI section)
+ */
+struct StreamConfig {
+    std::string name;                 // Label for logs / checkpoint file suffix
+    std::string channel;
+    int stream_id = 0;
+    bool dedicated_queue = false;     // true: own MessageBufferQueue (+ worker)
+};
+
 struct SubscriberConfig {
     std::string aeron_dir = "/home/hesed/shm/aeron-subscriber";
     std::string archive_control_channel = "";  // 비어있으면 AeronConfig 사용
@@ -27,7 +74,27 @@ struct SubscriberConfig {
     int64_t max_gap_tolerance = 5;             // 허용 가능한 최대 Gap 개수 (즉시 복구)
     int gap_recovery_timeout_ms = 1000;        // Gap 복구 타임아웃 (ms)
     bool duplicate_check_enabled = true;       // 중복 체크 활성화
-    int64_t duplicate_window_size = 1000;      // 중복 체크 윈도우 크기
+    int64_t duplicate_window_size = 1000;      // 중복 체크 윈도우 크기 (sequence 수, O(1) bitmap)
+
+    // Gap fill agent (archive replay of missing ranges, see enableGapFill)
+    GapFillConfig gap_fill;
+
+    // Multi-stream: polled in one duty cycle, each with own sequence/dedup/checkpoint
+    // 비어있으면 subscription_channel / subscription_stream_id 단일 스트림
+    std::vector<StreamConfig> streams;
+
+    // Receive mode (copy into pool / in-place term buffer views / byte ring)
+    ReceiveMode receive_mode = ReceiveMode::COPY;
+
+    // Pool / queue exhaustion: drop (기본) or lossless backpressure
+    OverflowPolicy overflow_policy = OverflowPolicy::DROP;
+
+    // Idle strategy when a poll returns no fragments (기본: 1ms sleep)
+    IdleStrategyConfig idle_strategy;
+
+    // Validate each complete message on the receive thread, before
+    // sequence tracking ([validation] stage = receiver); invalid → dropped
+    bool validate_on_receive = false;
 
     SubscriberConfig() = default;
 };
@@ -43,8 +110,8 @@ public:
 
     bool initialize();
     bool startLive();
-    bool startReplayMerge(int64_t recordingId, int64_t startPosition);
-    bool startReplayMergeAuto(int64_t startPosition = 0);  // Auto-discover latest recording
+    bool startReplayMerge(int64_t recordingId, int64_t startPosition);  // First stream only
+    bool startReplayMergeAuto(int64_t startPosition = 0);  // Auto-discover latest recording per stream
     void run();
     void shutdown();
 
@@ -56,7 +123,8 @@ public:
      *
      * Zero-copy mode is now the default and only mode:
      * - Buffer pool and message queue are required
-     * - Aeron messages are copied to buffer pool
+     * - Aeron messages are copied to buffer pool (size class by length)
+     * - Fragmented messages are reassembled directly into one pool buffer
      * - Buffer pointers are enqueued to message queue
      * - Worker thread dequeues and processes messages
      *
@@ -65,6 +133,100 @@ public:
      */
     void initializeZeroCopy(MessageBufferPool* pool, MessageBufferQueue* queue);
 
+    /**
+     * Initialize in-place processing (ReceiveMode::IN_PLACE)
+     *
+     * - Unfragmented messages: the worker reads straight from the term buffer
+     * - Fragmented messages: reassembled into reassembly_pool (if given,
+     *   otherwise dropped); the worker returns the buffer to the pool
+     * - Uses controlledPeek, returns ABORT when the view queue is full
+     * - Image position advances only to the worker's released position
+     * - Single stream only (throws std::invalid_argument otherwise)
+     *
+     * @param queue View queue (external, not owned)
+     * @param reassembly_pool Pool for fragmented messages (external, optional)
+     */
+    void initializeInPlace(InPlaceMessageQueue* queue,
+                           MessageBufferPool* reassembly_pool = nullptr);
+
+    /**
+     * Initialize byte ring processing (ReceiveMode::RING)
+     *
+     * - Every message is copied into the ring as one contiguous record
+     *   (header + payload, no size classes, no per-message pointer)
+     * - Fragmented messages are reassembled in reassembly_pool (if given),
+     *   then copied into the ring and the buffer is returned at once
+     * - Single worker: dedicated stream queues / sharding are not used
+     *
+     * @param ring Byte ring (external, not owned)
+     * @param reassembly_pool Pool for fragmented messages and gap fill (optional)
+     */
+    void initializeRing(MessageRingBuffer* ring,
+                        MessageBufferPool* reassembly_pool = nullptr);
+
+    /**
+     * Route a stream to its own message queue (copy mode, before run())
+     *
+     * Streams without a dedicated queue use the queue given to
+     * initializeZeroCopy(). Each queue needs its own worker (SPSC).
+     *
+     * @param recovered_queue Gap fill output for this stream (optional,
+     *                        drained by the same worker)
+     */
+    void setStreamQueue(size_t stream_index, MessageBufferQueue* queue,
+                        MessageBufferQueue* recovered_queue = nullptr);
+
+    /**
+     * Shard streams without a dedicated queue over several worker queues
+     * (copy mode, before run(); see WorkerGroup)
+     *
+     * Replaces the initializeZeroCopy() queue: each message goes to the
+     * router's queue for its key, per-key order is kept.
+     */
+    void setShardRouter(ShardRouter* router);
+
+    /**
+     * Start the gap fill agent (after initialize() and initializeZeroCopy()
+     * / initializeInPlace() with a pool, after setStreamQueue())
+     *
+     * Gaps up to max_gap_tolerance are replayed from the Archive on the
+     * agent thread; the receive loop only enqueues a request.
+     *
+     * @param recovered_queue Recovered messages of streams without their
+     *                        own recovered queue (external, not owned)
+     * @param recovered_router Sharded alternative to recovered_queue
+     *                         (same keys → same shard as the live path)
+     * @return false if disabled or prerequisites are missing
+     */
+    bool enableGapFill(MessageBufferQueue* recovered_queue,
+                       ShardRouter* recovered_router = nullptr);
+
+    /**
+     * Gap fill agent (nullptr if not enabled)
+     */
+    const GapFillAgent* getGapFillAgent() const;
+
+    /**
+     * Number of configured streams (>= 1)
+     */
+    size_t streamCount() const;
+
+    /**
+     * Per-stream statistics
+     */
+    struct StreamStats {
+        std::string name;
+        std::string channel;
+        int stream_id;
+        bool active;                      // false after ReplayMerge failure
+        uint64_t messages_received;
+        uint64_t gaps_detected;
+        uint64_t duplicates_detected;
+        uint64_t queue_full_failures;
+    };
+
+    std::vector<StreamStats> getStreamStats() const;
+
     /**
      * Get statistics for zero-copy mode
      */
@@ -72,26 +234,50 @@ public:
         uint64_t messages_received;
         uint64_t buffer_allocation_failures;
         uint64_t queue_full_failures;
+        uint64_t inplace_aborts;          // Peek aborted: view queue full
+        uint64_t inplace_term_stalls;     // Peek skipped: worker a term behind
+        uint64_t reassembled_messages;    // Messages rebuilt from >1 fragment
+        uint64_t reassembly_drops;        // Incomplete / oversize / no pool
+        uint64_t batches_unpacked;        // MSG_BATCH envelopes split into messages
+        uint64_t batch_errors;            // Malformed / larger than the view queue (dropped whole)
+        uint64_t backpressure_aborts;     // Polls stopped for downstream capacity
+        uint64_t backpressure_episodes;   // Blocked periods (first abort → progress)
+        uint64_t backpressure_total_ns;   // Time spent blocked (ended episodes)
+        uint64_t backpressure_max_ns;     // Longest blocked period
     };
 
     ZeroCopyStats getZeroCopyStats() const;
 
+    /**
+     * Idle strategy statistics of the receive loop
+     */
+    IdleStats getIdleStats() const;
+
+    /**
+     * Receive-thread validator (nullptr unless validate_on_receive)
+     */
+    const MessageValidator* getValidator() const;
+
     /**
      * Enable checkpoint persistence
      *
      * This enables automatic checkpoint saving with minimal overhead:
      * - Main thread: ~10 ns per update (atomic stores only)
      * - Background thread: Flushes to disk every N seconds
+     * - One checkpoint per stream ("<file>.<stream name>" when multi-stream)
      *
      * @param file Checkpoint file path
      * @param flush_interval_sec Flush interval in seconds (default: 1)
+     * @param thread Flush thread CPU affinity / priority
      */
-    void enableCheckpoint(const std::string& file, int flush_interval_sec = 1);
+    void enableCheckpoint(const std::string& file, int flush_interval_sec = 1,
+                          const ThreadSettings& thread = ThreadSettings());
 
     /**
      * Get checkpoint manager (for loading on restart)
      */
-    CheckpointManager* getCheckpointManager() const;
+    CheckpointManager* getCheckpointManager() const;  // First stream
+    CheckpointManager* getCheckpointManager(size_t stream_index) const;
 
     // Recording discovery helpers
     int64_t findLatestRecording(const std::string& channel, int32_t streamId);
@@ -99,6 +285,9 @@ public:
     int64_t getRecordingStopPosition(int64_t recordingId);
 
 private:
+    // Fragments per poll() - also the hand-off batch size
+    static constexpr int POLL_FRAGMENT_LIMIT = 10;
+
     SubscriberConfig config_;
 
     std::shared_ptr<aeron::Context> context_;
@@ -107,50 +296,179 @@ private:
     std::shared_ptr<aeron::archive::client::Context> archive_context_;
     std::shared_ptr<aeron::archive::client::AeronArchive> archive_;
 
-    // ReplayMerge 관련 (Official Aeron ReplayMerge API)
-    std::shared_ptr<aeron::Subscription> subscription_;
-    std::unique_ptr<aeron::archive::client::ReplayMerge> replay_merge_;
+    /**
+     * Per-stream receive state
+     *
+     * Owned by the subscriber thread; only the statistics are read by
+     * other threads.
+     */
+    struct StreamState {
+        StreamConfig config;
+        uint16_t index = 0;
+
+        // ReplayMerge 관련 (Official Aeron ReplayMerge API)
+        std::shared_ptr<aeron::Subscription> subscription;
+        std::unique_ptr<aeron::archive::client::ReplayMerge> replay_merge;
+        std::atomic<bool> active{true};          // false after ReplayMerge failure
+
+        // Simple gap tracking (온프레미스 최적화)
+        int64_t expected_sequence = 0;           // 예상 다음 시퀀스 번호
+        int64_t last_position = 0;               // 마지막 수락 메시지의 끝 position (gap fill 시작점)
+
+        // Duplicate detection: 최근 duplicate_window_size 시퀀스 bitmap (O(1))
+        SequenceWindow duplicate_window;
+
+        // Fragment reassembly: in-progress buffer per publisher session
+        std::unordered_map<int32_t, MessageBuffer> reassembly;
+
+        // Dedicated queue (nullptr: shared message_queue_)
+        MessageBufferQueue* message_queue = nullptr;
+        MessageBufferQueue* recovered_queue = nullptr;  // Gap fill output (nullptr: shared)
+
+        // Checkpoint manager (optional)
+        std::unique_ptr<CheckpointManager> checkpoint;
+
+        // Statistics
+        std::atomic<uint64_t> messages_received{0};
+        std::atomic<uint64_t> gaps_detected{0};
+        std::atomic<uint64_t> duplicates_detected{0};
+        std::atomic<uint64_t> queue_full_failures{0};
+    };
+
+    std::vector<std::unique_ptr<StreamState>> streams_;
 
     std::atomic<bool> running_;
     int64_t message_count_;
 
+    // Receive loop idle strategy (config_.idle_strategy)
+    std::unique_ptr<IdleStrategy> idle_strategy_;
+
+    // Receive-thread validation (config_.validate_on_receive, else nullptr)
+    std::unique_ptr<MessageValidator> validator_;
+
     // Legacy callback (deprecated)
     MessageCallback message_callback_;
 
-    // Simple gap tracking (온프레미스 최적화)
+    // Legacy gap tracking
     int64_t gap_count_;
     int64_t last_message_number_;
-    int64_t expected_sequence_;          // 예상 다음 시퀀스 번호
-
-    // Simple duplicate detection (고정 크기 링 버퍼)
-    std::vector<int64_t> duplicate_buffer_;  // 고정 크기 중복 체크 버퍼
-    size_t duplicate_buffer_pos_;            // 현재 링 버퍼 위치
 
     // Zero-copy components (required)
     MessageBufferPool* buffer_pool_;     // External buffer pool (not owned)
     MessageBufferQueue* message_queue_;  // External message queue (not owned)
+    ShardRouter* shard_router_;          // Sharded worker queues (optional, not owned)
+
+    // In-place components (ReceiveMode::IN_PLACE)
+    InPlaceMessageQueue* view_queue_;        // External view queue (not owned)
+    std::shared_ptr<aeron::Image> inplace_image_;  // Image currently peeked
+    int64_t inplace_peek_position_;          // Next position to peek from
+    int64_t inplace_fragment_start_;         // Start of the fragment being peeked
+
+    // Byte ring components (ReceiveMode::RING)
+    MessageRingBuffer* ring_;                // External byte ring (not owned)
+
+    // Current poll batch, handed to the worker once per poll()
+    BufferId pending_buffers_[POLL_FRAGMENT_LIMIT];
+    MessageView pending_views_[POLL_FRAGMENT_LIMIT];
+    int64_t pending_sequences_[POLL_FRAGMENT_LIMIT];
+    int64_t pending_positions_[POLL_FRAGMENT_LIMIT];
+    bool pending_accepted_[POLL_FRAGMENT_LIMIT];
+    size_t pending_count_;
+
+    // Inner messages of one MSG_BATCH envelope (copy mode, before tracking)
+    std::vector<MessageBuffer> batch_buffers_;
+
+    // Lossless mode: queue slots left for this poll (read once per poll)
+    size_t queue_budget_;
+    int64_t backpressure_since_ns_;          // 0 = not blocked
 
     // Zero-copy statistics
     std::atomic<uint64_t> zc_messages_received_;
     std::atomic<uint64_t> zc_buffer_allocation_failures_;
     std::atomic<uint64_t> zc_queue_full_failures_;
-
-    // Gap recovery statistics
+    std::atomic<uint64_t> zc_inplace_aborts_;
+    std::atomic<uint64_t> zc_inplace_term_stalls_;
+    std::atomic<uint64_t> zc_reassembled_messages_;
+    std::atomic<uint64_t> zc_reassembly_drops_;
+    std::atomic<uint64_t> zc_batches_unpacked_;
+    std::atomic<uint64_t> zc_batch_errors_;
+    std::atomic<uint64_t> zc_backpressure_aborts_;
+    std::atomic<uint64_t> zc_backpressure_episodes_;
+    std::atomic<uint64_t> zc_backpressure_total_ns_;
+    std::atomic<uint64_t> zc_backpressure_max_ns_;
+
+    // Gap recovery statistics (recovered counts: gap_fill_ statistics)
     std::atomic<uint64_t> gaps_detected_;
-    std::atomic<uint64_t> gaps_recovered_;
     std::atomic<uint64_t> duplicates_detected_;
 
-    // Checkpoint manager (optional)
-    std::unique_ptr<CheckpointManager> checkpoint_;
-
-    void handleMessage(const uint8_t* buffer, size_t length, int64_t position);
-    void handleMessageFastPath(const uint8_t* buffer, size_t length, int64_t position);
+    // Archive replay of missing ranges (own thread + archive connection)
+    std::unique_ptr<GapFillAgent> gap_fill_;
+
+    // Stream setup
+    void initStreams();
+    bool addSubscription(StreamState& stream);
+    bool startReplayMerge(StreamState& stream, int64_t recordingId, int64_t startPosition);
+
+    // One stream's share of the duty cycle (copy mode)
+    int pollStream(StreamState& stream);
+
+    // Return false when the fragment was NOT consumed (backpressure: the
+    // caller aborts the controlled poll and retries it later)
+    bool handleMessage(StreamState& stream, const uint8_t* buffer, size_t length,
+                       int64_t position, uint8_t flags, int32_t session_id);
+    bool handleMessageFastPath(StreamState& stream, const uint8_t* buffer, size_t length,
+                               int64_t position, uint8_t flags, int32_t session_id);
+    bool handleMessageInPlace(StreamState& stream, const uint8_t* buffer, size_t length,
+                              int64_t position, uint8_t flags, int32_t session_id);
+    bool handleMessageRing(StreamState& stream, const uint8_t* buffer, size_t length,
+                           int64_t position, uint8_t flags, int32_t session_id);
+
+    // MSG_BATCH envelope (unfragmented): every inner message goes through
+    // validation / sequence tracking on its own. Same return contract.
+    bool handleBatchFastPath(StreamState& stream, const uint8_t* buffer, size_t length,
+                             int64_t position, int32_t session_id, int64_t recv_timestamp);
+    bool handleBatchRing(StreamState& stream, const uint8_t* buffer, size_t length,
+                         int64_t position, int32_t session_id, int64_t recv_timestamp);
+    bool handleBatchInPlace(StreamState& stream, const uint8_t* buffer, size_t length,
+                            int64_t position, int32_t session_id, int64_t recv_timestamp);
+
+    // BACKPRESSURE copy mode: room in the stream's queue(s) for `needed`
+    // more messages (re-reads the consumer position if the budget is short)
+    bool reserveQueueBudget(StreamState& stream, size_t needed);
+
+    // Append an accepted pool buffer to the poll batch (copy mode)
+    void appendPendingBuffer(StreamState& stream, const MessageBuffer& msg_buf, int64_t position);
+
+    // Copy one fragment into the session's pool buffer; returns the buffer
+    // once END_FRAG completes the message, an empty handle otherwise.
+    // out_of_buffers: set instead of dropping when BEGIN_FRAG finds the
+    // pool empty (backpressure mode, nothing consumed)
+    MessageBuffer reassembleFragment(StreamState& stream, const uint8_t* buffer,
+                                     size_t length, uint8_t flags, int32_t session_id,
+                                     bool* out_of_buffers = nullptr);
+
+    // Backpressure episode tracking (blocked: this poll aborted)
+    void noteBackpressure(bool blocked);
+    void releaseReassemblyBuffers();
+    int pollInPlace(int fragment_limit);
+    void flushPendingBuffers(StreamState& stream);
+    void flushPendingViews(StreamState& stream);
+    void flushPendingRecords(StreamState& stream);
+
+    // Receive-thread validation: false = invalid, drop (counted per reason)
+    bool passesValidation(const MessageView& view);
+
+    // Gap/duplicate tracking shared by both receive modes (false = duplicate)
+    // position: end of the message (gap fill range), session_id: its publisher
+    bool acceptSequence(StreamState& stream, int64_t message_number,
+                        int64_t position, int32_t session_id);
 
     // Simple gap recovery (온프레미스 최적화)
-    bool checkForGaps(int64_t message_number);
-    bool isDuplicate(int64_t message_number);
-    void addToDecluplicationBuffer(int64_t message_number);
-    bool triggerImmediateGapRecovery(int64_t gap_start, int64_t gap_end);
+    bool checkForGaps(StreamState& stream, int64_t message_number);
+    // Test-and-set in the stream's window (records new sequences)
+    bool isDuplicate(StreamState& stream, int64_t message_number);
+    bool triggerImmediateGapRecovery(StreamState& stream, int64_t gap_start, int64_t gap_end,
+                                     int64_t position, int32_t session_id);
 
     // Legacy functions (minimal implementation)
     void printGapStats();
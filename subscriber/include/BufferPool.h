@@ -5,75 +5,139 @@
  *
  * Design:
  * - Pre-allocated buffers (avoid malloc/free)
- * - Lock-free allocation/deallocation using atomic operations
- * - O(1) allocation and deallocation
- * - Thread-safe (lock-free)
- * - Cache-line aligned to prevent false sharing
+ * - Shared free list: Treiber stack of buffer indices, head = 32-bit ABA
+ *   tag + index in one 64-bit word (every push/pop bumps the tag, so a
+ *   stale head can never be swapped in)
+ * - Per-thread magazines: each thread keeps a small cache of indices and
+ *   moves a magazine of them to/from the shared stack in one CAS
+ *   (subscriber refills, workers flush - the shared cache line is touched
+ *   once per batch instead of once per buffer)
+ * - Thread-safe MPMC (any number of allocating / releasing threads)
+ * - Structure of arrays: 64 B headers, 16 B descriptors and the payload
+ *   slab (4 KB aligned, payload_size bytes per slot) are separate arrays
+ *   indexed by buffer index; allocate() hands out a MessageBuffer handle,
+ *   deallocate() takes the 32-bit BufferId
+ * - Pool size / payload size set at construction (INI [memory]); slab,
+ *   buffers and links come from a MemoryArena (hugepages) when given
+ * - Slab pre-faulted in the constructor or by the arena (NUMA first-touch
+ *   on the constructing thread's node, no page faults on the hot path)
+ *
+ * Magazines:
+ * - Size scales with the pool (pool_size / 64, max 32; 0 = direct to the
+ *   shared stack, e.g. the 8-buffer 1 MB class)
+ * - A thread parks at most 2 × magazine size free buffers; idle threads
+ *   return them with flushThreadCache()
+ * - First MAX_THREAD_CACHES threads get a magazine, later ones use the
+ *   shared stack directly
  *
  * Performance:
- * - Allocate: ~50-100ns
- * - Deallocate: ~50-100ns
- * - Memory: PoolSize × sizeof(MessageBuffer)
+ * - Allocate / deallocate (magazine hit): ~5-10ns, no shared writes
+ * - Refill / flush: one CAS per magazine of buffers
+ * - Memory: pool_size × (64 + 16 + payload_size + 4)
+ * - Free-list / in_use checks touch only descriptors and links (dense)
  */
 
 #ifndef AERON_EXAMPLE_BUFFER_POOL_H
 #define AERON_EXAMPLE_BUFFER_POOL_H
 
 #include "MessageBuffer.h"
+#include "MemoryArena.h"
 #include <atomic>
+#include <cstring>
 #include <new>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace aeron {
 namespace example {
 
+/**
+ * Per-thread magazine slot (process wide, assigned on first pool use)
+ */
+inline size_t bufferPoolThreadSlot() noexcept {
+    static std::atomic<size_t> next_slot{0};
+    thread_local const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
 /**
  * Lock-free Buffer Pool
  *
  * Implementation:
- * - Uses atomic counter for free list management
- * - CAS (Compare-And-Swap) for lock-free allocation
- * - Cache-line aligned members to prevent false sharing
+ * - Free list = index stack (next_ links), head tagged against ABA
+ * - Batch pop / push of a linked chain with a single CAS
+ * - Cache-line aligned head and per-thread magazines (no false sharing)
  *
  * Thread Safety:
  * - Allocate: Thread-safe (lock-free)
- * - Deallocate: Thread-safe (lock-free)
+ * - Deallocate: Thread-safe (lock-free), double free detected
  * - Multiple producers/consumers supported
+ *
+ * payload_size: payload slot per buffer (one of SIZE_CLASS_PAYLOAD)
  */
-template<size_t PoolSize>
 class BufferPool {
 public:
-    static_assert(PoolSize > 0, "PoolSize must be greater than 0");
-    static_assert(PoolSize <= 65536, "PoolSize too large (max 65536)");
+    static constexpr size_t MAX_POOL_SIZE = 1 << 20;   // < 2^BUFFER_ID_INDEX_BITS
+    static constexpr size_t SLAB_ALIGNMENT = 4096;
+
+    // Buffers moved per refill/flush: pool_size / 64, capped here
+    static constexpr size_t MAX_MAGAZINE_SIZE = 32;
+    static constexpr size_t MAX_THREAD_CACHES = 32;
 
     /**
      * Constructor
-     * Initializes all buffers and adds them to free list
+     * Allocates the payload slab, initializes all buffers and adds them to free list
+     *
+     * @param pool_size Buffers (1..MAX_POOL_SIZE)
+     * @param payload_size Payload slot per buffer (one of SIZE_CLASS_PAYLOAD)
+     * @param arena Backing memory (nullptr = heap)
+     * @throws std::invalid_argument bad pool or payload size
      */
-    BufferPool() {
-        // Initialize buffers in-place
-        for (size_t i = 0; i < PoolSize; i++) {
-            new (&buffers_[i]) MessageBuffer();
-            free_list_[i] = &buffers_[i];
+    explicit BufferPool(size_t pool_size, size_t payload_size = MAX_PAYLOAD_SIZE,
+                        MemoryArena* arena = nullptr)
+        : pool_size_(checkedPoolSize(pool_size))
+        , payload_size_(checkedPayloadSize(payload_size))
+        , size_class_(sizeClassFor(payload_size))
+        , magazine_size_(pool_size / 64 < MAX_MAGAZINE_SIZE ? pool_size / 64 : MAX_MAGAZINE_SIZE)
+        , arena_(arena)
+        , slab_(static_cast<uint8_t*>(arena
+              ? arena->allocate(pool_size_ * payload_size_, SLAB_ALIGNMENT)
+              : ::operator new(pool_size_ * payload_size_, std::align_val_t(SLAB_ALIGNMENT))))
+        , headers_(MemoryArena::newArray<MessageHeader>(arena, pool_size_))
+        , descriptors_(MemoryArena::newArray<BufferDescriptor>(arena, pool_size_))
+        , next_(MemoryArena::newArray<std::atomic<uint32_t>>(arena, pool_size_)) {
+        // Touch every slab page now (first-touch NUMA placement);
+        // arena memory is pre-faulted by the arena
+        if (!arena_) {
+            std::memset(slab_, 0, pool_size_ * payload_size_);
+        }
+
+        // Free list 0 → 1 → ... → pool_size-1
+        for (size_t i = 0; i < pool_size_; i++) {
+            next_[i].store(i + 1 < pool_size_ ? static_cast<uint32_t>(i + 2) : 0,
+                           std::memory_order_relaxed);
         }
 
-        free_count_.store(PoolSize, std::memory_order_release);
-        total_allocations_.store(0, std::memory_order_relaxed);
-        total_deallocations_.store(0, std::memory_order_relaxed);
-        allocation_failures_.store(0, std::memory_order_relaxed);
+        head_.store(1, std::memory_order_relaxed);   // tag 0, index 0
+        free_count_.store(static_cast<int64_t>(pool_size_), std::memory_order_release);
 
-        std::cout << "BufferPool initialized: " << PoolSize << " buffers, "
-                  << (PoolSize * sizeof(MessageBuffer) / 1024 / 1024) << " MB"
-                  << std::endl;
+        std::cout << "BufferPool initialized: " << pool_size_ << " buffers × "
+                  << payload_size_ << " B, "
+                  << (pool_size_ * (sizeof(MessageHeader) + sizeof(BufferDescriptor) + payload_size_) / 1024) << " KB"
+                  << ", magazine " << magazine_size_
+                  << (arena_ ? " (arena)" : "") << std::endl;
     }
 
     /**
      * Destructor
      */
     ~BufferPool() {
-        // Explicitly call destructors
-        for (size_t i = 0; i < PoolSize; i++) {
-            buffers_[i].~MessageBuffer();
+        MemoryArena::deleteArray(arena_, next_, pool_size_);
+        MemoryArena::deleteArray(arena_, descriptors_, pool_size_);
+        MemoryArena::deleteArray(arena_, headers_, pool_size_);
+        if (!arena_) {
+            ::operator delete(slab_, std::align_val_t(SLAB_ALIGNMENT));
         }
     }
 
@@ -84,96 +148,127 @@ public:
     /**
      * Allocate a buffer from the pool
      *
-     * Performance: ~50-100ns (CAS loop)
+     * Performance: ~5-10ns from the magazine, one CAS per refill
      *
-     * @return Pointer to allocated buffer, or nullptr if pool exhausted
+     * @return Handle of the allocated buffer, empty if pool exhausted
      */
-    MessageBuffer* allocate() noexcept {
-        size_t count = free_count_.load(std::memory_order_acquire);
-
-        while (count > 0) {
-            // Try to decrement free count
-            if (free_count_.compare_exchange_weak(
-                    count, count - 1,
-                    std::memory_order_release,
-                    std::memory_order_relaxed)) {
-
-                // Successfully decremented, get buffer from free list
-                MessageBuffer* buf = free_list_[count - 1];
+    MessageBuffer allocate() noexcept {
+        ThreadCache* cache = threadCache();
+        uint32_t index;
 
-                // Mark buffer as in use
-                buf->in_use.store(true, std::memory_order_release);
-
-                // Reset buffer state
-                buf->reset();
-
-                // Update statistics
-                total_allocations_.fetch_add(1, std::memory_order_relaxed);
-
-                return buf;
+        if (cache) {
+            if (cache->count == 0) {
+                cache->count = static_cast<uint32_t>(popBatch(cache->items, magazine_size_));
+            }
+            if (cache->count == 0) {
+                cache->failures.fetch_add(1, std::memory_order_relaxed);
+                return MessageBuffer();
+            }
+            index = cache->items[--cache->count];
+            cache->visible_count.store(cache->count, std::memory_order_relaxed);
+            cache->allocations.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            if (popBatch(&index, 1) == 0) {
+                shared_stats_.failures.fetch_add(1, std::memory_order_relaxed);
+                return MessageBuffer();
             }
-            // CAS failed, retry with updated count
+            shared_stats_.allocations.fetch_add(1, std::memory_order_relaxed);
         }
 
-        // Pool exhausted
-        allocation_failures_.fetch_add(1, std::memory_order_relaxed);
-        return nullptr;
+        // Mark buffer as in use
+        descriptors_[index].in_use.store(true, std::memory_order_relaxed);
+
+        // Reset buffer state
+        MessageBuffer buf = at(index);
+        buf.reset();
+
+        return buf;
     }
 
     /**
      * Deallocate a buffer back to the pool
      *
-     * Performance: ~50-100ns (CAS loop)
+     * Performance: ~5-10ns into the magazine, one CAS per flush
      *
-     * @param buf Buffer to return to pool
+     * @param id Buffer to return to pool
      */
-    void deallocate(MessageBuffer* buf) noexcept {
-        if (!buf) {
+    void deallocate(BufferId id) noexcept {
+        if (id == INVALID_BUFFER_ID) {
             return;
         }
 
         // Validate buffer belongs to this pool
-        if (!isValidBuffer(buf)) {
+        if (!isValidId(id)) {
             std::cerr << "ERROR: Attempting to deallocate buffer not from this pool"
                       << std::endl;
             return;
         }
 
-        // Mark buffer as not in use
-        buf->in_use.store(false, std::memory_order_release);
-
-        // Return to free list
-        size_t count = free_count_.load(std::memory_order_acquire);
-
-        while (count < PoolSize) {
-            // Try to increment free count
-            if (free_count_.compare_exchange_weak(
-                    count, count + 1,
-                    std::memory_order_release,
-                    std::memory_order_relaxed)) {
-
-                // Successfully incremented, add buffer to free list
-                free_list_[count] = buf;
+        // Mark buffer as not in use (a second release would corrupt the list)
+        const uint32_t index = bufferIdIndex(id);
+        if (!descriptors_[index].in_use.exchange(false, std::memory_order_relaxed)) {
+            std::cerr << "ERROR: BufferPool double free" << std::endl;
+            return;
+        }
 
-                // Update statistics
-                total_deallocations_.fetch_add(1, std::memory_order_relaxed);
+        ThreadCache* cache = threadCache();
 
-                return;
+        if (cache) {
+            if (cache->count == 2 * magazine_size_) {
+                // Full: hand the older half back in one CAS
+                pushBatch(cache->items, magazine_size_);
+                std::memmove(cache->items, cache->items + magazine_size_,
+                             magazine_size_ * sizeof(uint32_t));
+                cache->count = static_cast<uint32_t>(magazine_size_);
             }
-            // CAS failed, retry with updated count
+            cache->items[cache->count++] = index;
+            cache->visible_count.store(cache->count, std::memory_order_relaxed);
+            cache->deallocations.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            pushBatch(&index, 1);
+            shared_stats_.deallocations.fetch_add(1, std::memory_order_relaxed);
         }
+    }
+
+    /**
+     * Handle of a buffer allocated from this pool (id from MessageBuffer::id)
+     */
+    MessageBuffer resolve(BufferId id) const noexcept {
+        return at(bufferIdIndex(id));
+    }
 
-        // This should never happen (deallocating more than allocated)
-        std::cerr << "ERROR: BufferPool free list overflow" << std::endl;
+    /**
+     * Return the calling thread's magazine to the shared free list
+     * (idle worker, thread exit)
+     */
+    void flushThreadCache() noexcept {
+        ThreadCache* cache = threadCache();
+        if (cache && cache->count > 0) {
+            pushBatch(cache->items, cache->count);
+            cache->count = 0;
+            cache->visible_count.store(0, std::memory_order_relaxed);
+        }
     }
 
     /**
      * Get number of available buffers
      *
-     * @return Number of free buffers
+     * @return Free buffers (shared list + all magazines, approximate
+     *         while other threads are running)
      */
     size_t available() const noexcept {
-        return free_count_.load(std::memory_order_acquire);
+        // Shared count may lag a concurrent push/pop by one batch
+        int64_t free_buffers = free_count_.load(std::memory_order_acquire);
+        if (magazine_size_ > 0) {
+            for (const auto& cache : caches_) {
+                free_buffers += cache.visible_count.load(std::memory_order_relaxed);
+            }
+        }
+        if (free_buffers < 0) {
+            return 0;
+        }
+        return static_cast<size_t>(free_buffers) < pool_size_
+            ? static_cast<size_t>(free_buffers) : pool_size_;
     }
 
     /**
@@ -181,8 +276,22 @@ public:
      *
      * @return Total number of buffers in pool
      */
-    constexpr size_t capacity() const noexcept {
-        return PoolSize;
+    size_t capacity() const noexcept {
+        return pool_size_;
+    }
+
+    /**
+     * Get payload slot size of every buffer in this pool
+     */
+    size_t payloadSize() const noexcept {
+        return payload_size_;
+    }
+
+    /**
+     * Buffers moved per magazine refill / flush (0 = no magazines)
+     */
+    size_t magazineSize() const noexcept {
+        return magazine_size_;
     }
 
     /**
@@ -191,8 +300,8 @@ public:
      * @return Utilization ratio
      */
     double utilization() const noexcept {
-        size_t used = PoolSize - available();
-        return static_cast<double>(used) / PoolSize;
+        size_t used = pool_size_ - available();
+        return static_cast<double>(used) / pool_size_;
     }
 
     /**
@@ -205,15 +314,25 @@ public:
         size_t current_available;
         size_t current_in_use;
         double utilization;
+        size_t cached;                // Free buffers parked in magazines
     };
 
     Statistics getStatistics() const noexcept {
         Statistics stats;
-        stats.total_allocations = total_allocations_.load(std::memory_order_relaxed);
-        stats.total_deallocations = total_deallocations_.load(std::memory_order_relaxed);
-        stats.allocation_failures = allocation_failures_.load(std::memory_order_relaxed);
+        stats.total_allocations = shared_stats_.allocations.load(std::memory_order_relaxed);
+        stats.total_deallocations = shared_stats_.deallocations.load(std::memory_order_relaxed);
+        stats.allocation_failures = shared_stats_.failures.load(std::memory_order_relaxed);
+        stats.cached = 0;
+        if (magazine_size_ > 0) {
+            for (const auto& cache : caches_) {
+                stats.total_allocations += cache.allocations.load(std::memory_order_relaxed);
+                stats.total_deallocations += cache.deallocations.load(std::memory_order_relaxed);
+                stats.allocation_failures += cache.failures.load(std::memory_order_relaxed);
+                stats.cached += cache.visible_count.load(std::memory_order_relaxed);
+            }
+        }
         stats.current_available = available();
-        stats.current_in_use = PoolSize - stats.current_available;
+        stats.current_in_use = pool_size_ - stats.current_available;
         stats.utilization = utilization();
         return stats;
     }
@@ -225,8 +344,9 @@ public:
         auto stats = getStatistics();
 
         std::cout << "\n=== Buffer Pool Statistics ===" << std::endl;
-        std::cout << "Capacity:      " << PoolSize << " buffers" << std::endl;
-        std::cout << "Available:     " << stats.current_available << std::endl;
+        std::cout << "Capacity:      " << pool_size_ << " buffers × " << payload_size_ << " B" << std::endl;
+        std::cout << "Available:     " << stats.current_available
+                  << " (" << stats.cached << " in thread magazines)" << std::endl;
         std::cout << "In use:        " << stats.current_in_use << std::endl;
         std::cout << "Utilization:   " << (stats.utilization * 100.0) << "%" << std::endl;
         std::cout << "Allocations:   " << stats.total_allocations << std::endl;
@@ -242,36 +362,148 @@ public:
     }
 
 private:
+    static constexpr uint64_t INDEX_MASK = 0xFFFFFFFFULL;
+
+    // Owner-thread magazine (count/items written by the owner only)
+    struct alignas(64) ThreadCache {
+        uint32_t count = 0;
+        uint32_t items[2 * MAX_MAGAZINE_SIZE];
+        std::atomic<uint32_t> visible_count{0};      // count, for available()
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+        std::atomic<uint64_t> failures{0};
+    };
+
+    // Threads without a magazine (shared counters)
+    struct alignas(64) SharedStats {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+        std::atomic<uint64_t> failures{0};
+    };
+
+    ThreadCache* threadCache() noexcept {
+        if (magazine_size_ == 0) {
+            return nullptr;
+        }
+        const size_t slot = bufferPoolThreadSlot();
+        return slot < MAX_THREAD_CACHES ? &caches_[slot] : nullptr;
+    }
+
+    /**
+     * Pop up to max indices with one CAS
+     *
+     * The chain is read before the CAS; if any other thread pushed or
+     * popped meanwhile the tag differs and the walk is redone.
+     */
+    size_t popBatch(uint32_t* out, size_t max) noexcept {
+        uint64_t head = head_.load(std::memory_order_acquire);
+
+        for (;;) {
+            uint32_t node = static_cast<uint32_t>(head & INDEX_MASK);
+            if (node == 0) {
+                return 0;
+            }
+
+            size_t n = 0;
+            while (node != 0 && n < max) {
+                out[n++] = node - 1;
+                node = next_[node - 1].load(std::memory_order_relaxed);
+            }
+
+            const uint64_t new_head = (((head >> 32) + 1) << 32) | node;
+            if (head_.compare_exchange_weak(head, new_head,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                free_count_.fetch_sub(static_cast<int64_t>(n), std::memory_order_relaxed);
+                return n;
+            }
+            // Head moved (tag bumped), retry with the new head
+        }
+    }
+
+    /**
+     * Push a batch of indices with one CAS (linked locally first)
+     */
+    void pushBatch(const uint32_t* indices, size_t n) noexcept {
+        for (size_t i = 0; i + 1 < n; i++) {
+            next_[indices[i]].store(indices[i + 1] + 1, std::memory_order_relaxed);
+        }
+
+        const uint32_t first = indices[0] + 1;
+        const uint32_t last = indices[n - 1];
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t new_head;
+
+        do {
+            next_[last].store(static_cast<uint32_t>(head & INDEX_MASK), std::memory_order_relaxed);
+            new_head = (((head >> 32) + 1) << 32) | first;
+        } while (!head_.compare_exchange_weak(head, new_head,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+
+        free_count_.fetch_add(static_cast<int64_t>(n), std::memory_order_relaxed);
+    }
+
+    MessageBuffer at(uint32_t index) const noexcept {
+        MessageBuffer buf;
+        buf.header = &headers_[index];
+        buf.payload = slab_ + static_cast<size_t>(index) * payload_size_;
+        buf.descriptor = &descriptors_[index];
+        buf.payload_capacity = static_cast<uint32_t>(payload_size_);
+        buf.id = makeBufferId(size_class_, index);
+        return buf;
+    }
+
     /**
      * Validate that buffer belongs to this pool
      */
-    bool isValidBuffer(MessageBuffer* buf) const noexcept {
-        uintptr_t buf_addr = reinterpret_cast<uintptr_t>(buf);
-        uintptr_t pool_start = reinterpret_cast<uintptr_t>(&buffers_[0]);
-        uintptr_t pool_end = reinterpret_cast<uintptr_t>(&buffers_[PoolSize]);
+    bool isValidId(BufferId id) const noexcept {
+        return bufferIdClass(id) == size_class_ && bufferIdIndex(id) < pool_size_;
+    }
+
+    static size_t checkedPoolSize(size_t pool_size) {
+        if (pool_size == 0 || pool_size > MAX_POOL_SIZE) {
+            throw std::invalid_argument("BufferPool size must be 1.."
+                                        + std::to_string(MAX_POOL_SIZE) + ": "
+                                        + std::to_string(pool_size));
+        }
+        return pool_size;
+    }
 
-        return buf_addr >= pool_start && buf_addr < pool_end;
+    static size_t checkedPayloadSize(size_t payload_size) {
+        const uint8_t cls = sizeClassFor(payload_size);
+        if (cls >= SIZE_CLASS_COUNT || SIZE_CLASS_PAYLOAD[cls] != payload_size) {
+            throw std::invalid_argument("BufferPool payload size must be a size class: "
+                                        + std::to_string(payload_size));
+        }
+        return payload_size;
     }
 
-    // Buffer storage (cache-line aligned)
-    alignas(64) MessageBuffer buffers_[PoolSize];
+    // Geometry (read-only after construction)
+    const size_t pool_size_;
+    const size_t payload_size_;
+    const uint8_t size_class_;
+    const size_t magazine_size_;
+    MemoryArena* const arena_;
 
-    // Free list (array of pointers)
-    alignas(64) MessageBuffer* free_list_[PoolSize];
+    // Payload slab (pool_size × payload_size, 4 KB aligned)
+    uint8_t* const slab_;
 
-    // Atomic counters (cache-line aligned to prevent false sharing)
-    alignas(64) std::atomic<size_t> free_count_;
+    // Wire headers (one cache line each) and pool metadata (16 B each)
+    MessageHeader* const headers_;
+    BufferDescriptor* const descriptors_;
 
-    // Statistics (separate cache line)
-    alignas(64) std::atomic<uint64_t> total_allocations_;
-    std::atomic<uint64_t> total_deallocations_;
-    std::atomic<uint64_t> allocation_failures_;
-};
+    // Free list links: next_[i] = index + 1 of the next free buffer (0 = end)
+    std::atomic<uint32_t>* const next_;
 
-// Recommended pool sizes
-using MessageBufferPool = BufferPool<1024>;      // 1024 buffers (~4.2 MB)
-using LargeBufferPool = BufferPool<4096>;        // 4096 buffers (~16.8 MB)
-using SmallBufferPool = BufferPool<256>;         // 256 buffers (~1.05 MB)
+    // Shared stack head: [tag:32 | index + 1:32] (0 index = empty)
+    alignas(64) std::atomic<uint64_t> head_;
+    std::atomic<int64_t> free_count_;      // Buffers on the shared stack
+
+    // Per-thread magazines + fallback statistics (own cache lines)
+    ThreadCache caches_[MAX_THREAD_CACHES];
+    SharedStats shared_stats_;
+};
 
 } // namespace example
 } // namespace aeron
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include "ThreadUtil.h"
 
 namespace aeron {
 namespace example {
@@ -47,6 +48,7 @@ private:
     std::atomic<bool> running_{true};      // Background thread control
     std::thread flush_thread_;             // Background flush thread
     std::chrono::seconds flush_interval_;  // Flush interval (default: 1 sec)
+    ThreadSettings thread_settings_;       // Flush thread placement (keep off hot cores)
 
     // Statistics
     std::atomic<uint64_t> flush_count_{0};
@@ -58,8 +60,10 @@ public:
      *
      * @param file Checkpoint file path
      * @param flush_interval_sec Flush interval in seconds (default: 1)
+     * @param thread Flush thread CPU affinity / priority
      */
-    explicit CheckpointManager(const std::string& file, int flush_interval_sec = 1);
+    explicit CheckpointManager(const std::string& file, int flush_interval_sec = 1,
+                               const ThreadSettings& thread = ThreadSettings());
 
     /**
      * Destructor
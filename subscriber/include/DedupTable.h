@@ -0,0 +1,162 @@
+/**
+ * DedupTable.h
+ *
+ * Bounded duplicate detection per message source (worker side)
+ *
+ * Design:
+ * - Source = (stream_index, publisher_id, session_id) from the header;
+ *   a restarted publisher (new session) gets a fresh window
+ * - One SequenceWindow (sliding bitmap) per source: O(1) test-and-set,
+ *   out-of-order arrivals within the window are tracked exactly
+ * - Fixed number of source slots, all bitmaps allocated up front
+ *   (no allocation after construction, no clear() spike)
+ * - Table full → least recently used source is evicted
+ * - Sequence older than its source's window → reported as duplicate
+ *   (same session, already far behind: replay/live overlap)
+ *
+ * Performance:
+ * - Same source as previous message: ~3-5 ns (cached slot)
+ * - Source switch: linear scan of max_sources keys (16 by default)
+ * - Memory: max_sources × window / 8 bytes (16 × 1M = 2 MB)
+ *
+ * Thread Safety:
+ * - Single thread (one table per worker)
+ *
+ * Usage:
+ *   DedupTable dedup(1 << 20, 16);
+ *   if (dedup.checkAndInsert(stream, publisher, session, seq)) { drop }
+ */
+
+#ifndef AERON_EXAMPLE_DEDUP_TABLE_H
+#define AERON_EXAMPLE_DEDUP_TABLE_H
+
+#include "SequenceWindow.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+class DedupTable {
+public:
+    struct Statistics {
+        uint64_t sources;         // Sources currently tracked
+        uint64_t evictions;       // Sources evicted (table full)
+        uint64_t too_old;         // Sequences below their window
+        size_t memory_bytes;      // Bitmap memory (fixed)
+    };
+
+    /**
+     * @param window Sequences tracked per source
+     * @param max_sources Concurrent sources before LRU eviction
+     */
+    explicit DedupTable(size_t window, size_t max_sources = 16)
+        : slots_(max_sources > 0 ? max_sources : 1) {
+        for (auto& slot : slots_) {
+            slot.window.resize(window);
+        }
+    }
+
+    /**
+     * Record a sequence of a source
+     *
+     * @return true if duplicate (already seen, or older than the window)
+     */
+    bool checkAndInsert(uint16_t stream_index, uint16_t publisher_id,
+                        uint64_t session_id, int64_t sequence) noexcept {
+        Slot& slot = find(stream_index, publisher_id, session_id);
+        slot.last_used = ++tick_;
+
+        switch (slot.window.testAndSet(sequence)) {
+            case SequenceWindow::Result::NEW:
+                return false;
+            case SequenceWindow::Result::TOO_OLD:
+                too_old_++;
+                return true;
+            default:
+                return true;
+        }
+    }
+
+    void reset() {
+        for (auto& slot : slots_) {
+            slot.used = false;
+            slot.window.reset();
+        }
+        last_ = nullptr;
+    }
+
+    Statistics getStatistics() const {
+        Statistics stats;
+        stats.sources = 0;
+        for (const auto& slot : slots_) {
+            stats.sources += slot.used ? 1 : 0;
+        }
+        stats.evictions = evictions_;
+        stats.too_old = too_old_;
+        stats.memory_bytes = slots_.size() * slots_[0].window.capacity() / 8;
+        return stats;
+    }
+
+private:
+    struct Slot {
+        uint16_t stream_index = 0;
+        uint16_t publisher_id = 0;
+        uint64_t session_id = 0;
+        uint64_t last_used = 0;
+        bool used = false;
+        SequenceWindow window;
+
+        bool matches(uint16_t stream, uint16_t publisher, uint64_t session) const noexcept {
+            return used && stream_index == stream && publisher_id == publisher
+                && session_id == session;
+        }
+    };
+
+    Slot& find(uint16_t stream_index, uint16_t publisher_id, uint64_t session_id) noexcept {
+        // Consecutive messages are almost always from the same source
+        if (last_ && last_->matches(stream_index, publisher_id, session_id)) {
+            return *last_;
+        }
+
+        Slot* victim = &slots_[0];
+        for (auto& slot : slots_) {
+            if (slot.matches(stream_index, publisher_id, session_id)) {
+                last_ = &slot;
+                return slot;
+            }
+            // Free slot first, then least recently used
+            if (!victim->used) {
+                continue;
+            }
+            if (!slot.used || slot.last_used < victim->last_used) {
+                victim = &slot;
+            }
+        }
+
+        if (victim->used) {
+            evictions_++;
+        }
+        victim->stream_index = stream_index;
+        victim->publisher_id = publisher_id;
+        victim->session_id = session_id;
+        victim->used = true;
+        victim->window.reset();
+        last_ = victim;
+        return *victim;
+    }
+
+    std::vector<Slot> slots_;
+    Slot* last_ = nullptr;
+    uint64_t tick_ = 0;
+
+    // Statistics (single writer)
+    uint64_t evictions_ = 0;
+    uint64_t too_old_ = 0;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_DEDUP_TABLE_H
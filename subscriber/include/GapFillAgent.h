@@ -0,0 +1,192 @@
+/**
+ * GapFillAgent.h
+ *
+ * Asynchronous gap fill: replays missing ranges from the Archive
+ *
+ * Design:
+ * - Subscriber thread only enqueues a GapFillRequest (SPSC, ~50ns, never
+ *   blocks; full queue → request dropped and counted)
+ * - Agent thread ("aeron-gapfill") owns its own AeronArchive connection,
+ *   so no archive RPC ever runs on the receive thread
+ * - Range is known by position: [end of last accepted message, end of the
+ *   message after the gap] → bounded startReplay (length capped by
+ *   max_replay_bytes) on its own replay subscription (session-id filtered)
+ * - Replayed messages within [from_sequence, to_sequence] are copied into
+ *   the shared buffer pool, sorted by sequence and enqueued to the
+ *   stream's recovered queue, drained by the worker like live messages
+ * - One replay at a time; timeout_ms bounds each replay
+ *
+ * Recovered messages arrive after the live messages that followed the gap
+ * (sequence order within the gap). The worker's duplicate check drops
+ * messages that were only reordered, not lost.
+ *
+ * Usage:
+ *   GapFillAgent agent(aeron, config, pool);
+ *   agent.addStream("trades", channel, 10, &recovered_queue);
+ *   agent.start();
+ *   agent.requestGap(request);   // subscriber thread
+ *   agent.stop();
+ */
+
+#ifndef AERON_EXAMPLE_GAP_FILL_AGENT_H
+#define AERON_EXAMPLE_GAP_FILL_AGENT_H
+
+#include "Aeron.h"
+#include "client/AeronArchive.h"
+#include "AeronConfig.h"
+#include "SizeClassBufferPool.h"
+#include "MessageQueue.h"
+#include "ShardRouter.h"
+#include "SPSCQueue.h"
+#include "IdleStrategy.h"
+#include "ThreadUtil.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Gap fill 설정 (INI [gap_fill] 섹션에서 로드)
+ */
+struct GapFillConfig {
+    bool enabled = AeronConfig::GAP_FILL_ENABLED;
+    std::string archive_control_channel;     // 비어있으면 AeronConfig 사용
+    std::string replay_channel = AeronConfig::GAP_FILL_REPLAY_CHANNEL;
+    int replay_stream_id = AeronConfig::GAP_FILL_REPLAY_STREAM_ID;
+    int64_t max_replay_bytes = AeronConfig::GAP_FILL_MAX_REPLAY_BYTES;
+    int64_t timeout_ms = AeronConfig::GAP_FILL_TIMEOUT_MS;
+    ThreadSettings thread;
+};
+
+/**
+ * One missing range (subscriber thread → agent)
+ */
+struct GapFillRequest {
+    uint16_t stream_index = 0;
+    int32_t session_id = 0;         // Publisher session (selects the recording)
+    int64_t from_sequence = 0;      // First missing sequence
+    int64_t to_sequence = 0;        // Last missing sequence
+    int64_t from_position = 0;      // End of the last message before the gap
+    int64_t to_position = 0;        // End of the message after the gap
+};
+
+class GapFillAgent {
+public:
+    GapFillAgent(std::shared_ptr<aeron::Aeron> aeron,
+                 const GapFillConfig& config,
+                 MessageBufferPool& pool);
+    ~GapFillAgent();
+
+    // Non-copyable
+    GapFillAgent(const GapFillAgent&) = delete;
+    GapFillAgent& operator=(const GapFillAgent&) = delete;
+
+    /**
+     * Register a stream (call before start(), in stream index order)
+     *
+     * @param output Queue the recovered messages go to (drained by the
+     *               worker of that stream)
+     * @param router Sharded output instead of `output` (worker group)
+     */
+    void addStream(const std::string& name, const std::string& channel,
+                   int stream_id, MessageBufferQueue* output,
+                   ShardRouter* router = nullptr);
+
+    void start();
+    void stop();
+
+    /**
+     * Queue a missing range (subscriber thread only, non-blocking)
+     *
+     * @return false if the request queue is full (request dropped)
+     */
+    bool requestGap(const GapFillRequest& request) noexcept;
+
+    struct Statistics {
+        uint64_t requests;               // Accepted into the request queue
+        uint64_t requests_dropped;       // Request queue full
+        uint64_t requests_rejected;      // Unknown position / range too large
+        uint64_t replays;                // Replays started
+        uint64_t replay_failures;        // No recording / archive error
+        uint64_t replay_timeouts;        // Range not complete within timeout_ms
+        uint64_t messages_recovered;     // Enqueued to the worker
+        uint64_t messages_unrecovered;   // Missing after the replay
+        uint64_t output_drops;           // Recovered queue full / pool exhausted
+    };
+
+    Statistics getStatistics() const;
+    void printStatistics() const;
+
+private:
+    struct StreamTarget {
+        std::string name;
+        std::string channel;
+        int stream_id = 0;
+        MessageBufferQueue* output = nullptr;
+        ShardRouter* router = nullptr;
+
+        // Last recording lookup (per publisher session)
+        int32_t recording_session_id = 0;
+        int64_t recording_id = -1;
+    };
+
+    // Pending requests (SPSC: subscriber thread → agent)
+    static constexpr size_t REQUEST_QUEUE_SIZE = 1024;
+
+    void run();
+    bool connectArchive();
+    void fill(const GapFillRequest& request);
+    int64_t findRecording(StreamTarget& target, int32_t session_id);
+
+    // Replay fragment → pool buffer (reassembles fragmented messages,
+    // unpacks MSG_BATCH envelopes)
+    void onReplayFragment(const GapFillRequest& request, const uint8_t* buffer,
+                          size_t length, uint8_t flags);
+
+    // One complete message → pool buffer, if inside the gap
+    void recoverMessage(const GapFillRequest& request, const uint8_t* buffer, size_t length);
+    void releaseRecovered();
+
+    // Replay subscriptions whose registration timed out: resolved later and
+    // closed, so the client conductor does not keep them forever
+    void releaseAbandonedSubscriptions();
+
+    GapFillConfig config_;
+    std::shared_ptr<aeron::Aeron> aeron_;
+    std::shared_ptr<aeron::archive::client::Context> archive_context_;
+    std::shared_ptr<aeron::archive::client::AeronArchive> archive_;   // Agent thread only
+    MessageBufferPool& pool_;
+
+    std::vector<StreamTarget> streams_;
+    SPSCQueue<GapFillRequest> requests_{REQUEST_QUEUE_SIZE};
+
+    // Agent thread state
+    MessageBuffer in_progress_;                // Fragment reassembly
+    std::vector<BufferId> recovered_;          // Current replay's messages
+    std::unique_ptr<IdleStrategy> wait_idle_;  // Empty request queue
+    std::unique_ptr<IdleStrategy> poll_idle_;  // Replay image poll
+    std::vector<int64_t> abandoned_subscriptions_;   // Registration ids
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    // Statistics (requests_* written by the subscriber thread, rest by the agent)
+    std::atomic<uint64_t> requests_count_{0};
+    std::atomic<uint64_t> requests_dropped_{0};
+    std::atomic<uint64_t> requests_rejected_{0};
+    std::atomic<uint64_t> replays_{0};
+    std::atomic<uint64_t> replay_failures_{0};
+    std::atomic<uint64_t> replay_timeouts_{0};
+    std::atomic<uint64_t> messages_recovered_{0};
+    std::atomic<uint64_t> messages_unrecovered_{0};
+    std::atomic<uint64_t> output_drops_{0};
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_GAP_FILL_AGENT_H
@@ -5,8 +5,9 @@
  *
  * Design:
  * - Fixed 64-byte header (cache-line aligned)
- * - Variable payload (up to MAX_PAYLOAD_SIZE)
- * - Pool management metadata
+ * - Variable payload in a pool-owned slot (size class: 256 B ~ 1 MB)
+ * - Pool metadata in a separate 16-byte descriptor (structure of arrays)
+ * - Buffers identified by a 32-bit BufferId (queues carry ids, not pointers)
  * - Based on MESSAGE_STRUCTURE_DESIGN.md
  */
 
@@ -17,17 +18,60 @@
 #include <atomic>
 #include <cstring>
 #include <algorithm>  // for std::min
-#include <array>      // for std::array (CRC32 table)
-#include <utility>    // for std::index_sequence (CRC32 table generation)
+#include <cstddef>    // for offsetof
 #include <time.h>     // for clock_gettime, timespec
+#include "Checksum.h"
 
 namespace aeron {
 namespace example {
 
 // Configuration
-constexpr size_t MAX_PAYLOAD_SIZE = 4096;  // 4KB payload max
+constexpr size_t MAX_PAYLOAD_SIZE = 4096;  // 4KB payload (default size class)
+
+// Payload size classes (see SizeClassBufferPool)
+enum SizeClass : uint8_t {
+    SIZE_CLASS_SMALL = 0,    // 256 B   (ticks, heartbeats)
+    SIZE_CLASS_MEDIUM = 1,   // 4 KB    (orders)
+    SIZE_CLASS_LARGE = 2,    // 64 KB   (reassembled messages)
+    SIZE_CLASS_HUGE = 3,     // 1 MB    (snapshots, reference data)
+    SIZE_CLASS_COUNT = 4
+};
+
+constexpr size_t SIZE_CLASS_PAYLOAD[SIZE_CLASS_COUNT] = {
+    256, 4096, 64 * 1024, 1024 * 1024
+};
+
+constexpr size_t MAX_MESSAGE_PAYLOAD_SIZE = SIZE_CLASS_PAYLOAD[SIZE_CLASS_HUGE];  // 1MB
+
+// Smallest size class that fits payload_size (SIZE_CLASS_COUNT if none)
+constexpr uint8_t sizeClassFor(size_t payload_size) {
+    for (uint8_t c = 0; c < SIZE_CLASS_COUNT; ++c) {
+        if (payload_size <= SIZE_CLASS_PAYLOAD[c]) {
+            return c;
+        }
+    }
+    return SIZE_CLASS_COUNT;
+}
 constexpr uint32_t MESSAGE_MAGIC = 0x5345'4B52;  // "SEKR" in little-endian
 
+// Pooled buffer id: [size class:8 | index in class pool:24]
+using BufferId = uint32_t;
+constexpr BufferId INVALID_BUFFER_ID = 0xFFFF'FFFF;
+constexpr uint32_t BUFFER_ID_INDEX_BITS = 24;
+constexpr uint32_t BUFFER_ID_INDEX_MASK = (1u << BUFFER_ID_INDEX_BITS) - 1;
+
+constexpr BufferId makeBufferId(uint8_t size_class, uint32_t index) {
+    return (static_cast<uint32_t>(size_class) << BUFFER_ID_INDEX_BITS) | index;
+}
+
+constexpr uint8_t bufferIdClass(BufferId id) {
+    return static_cast<uint8_t>(id >> BUFFER_ID_INDEX_BITS);
+}
+
+constexpr uint32_t bufferIdIndex(BufferId id) {
+    return id & BUFFER_ID_INDEX_MASK;
+}
+
 // Message types (from MESSAGE_STRUCTURE_DESIGN.md)
 enum MessageType : uint16_t {
     MSG_ORDER_NEW = 1,
@@ -36,6 +80,7 @@ enum MessageType : uint16_t {
     MSG_ORDER_CANCEL = 4,
     MSG_QUOTE_UPDATE = 5,
     MSG_HEARTBEAT = 6,
+    MSG_BATCH = 7,     // Batch envelope (see forEachBatchMessage)
     MSG_TEST = 99  // For testing
 };
 
@@ -45,34 +90,18 @@ enum MessageFlags : uint8_t {
     FLAG_CHECKSUM_ENABLED = 0x01,
     FLAG_COMPRESSED = 0x02,
     FLAG_ENCRYPTED = 0x04,
-    FLAG_URGENT = 0x08
+    FLAG_URGENT = 0x08,
+    FLAG_CHECKSUM_CRC32C = 0x10   // checksum is CRC32C (else CRC32), with FLAG_CHECKSUM_ENABLED
 };
 
 /**
- * CRC32 calculation (IEEE 802.3 polynomial: 0x04C11DB7)
+ * Message checksum (header + payload, recv_time_ns / checksum counted as zero)
  *
- * Fast table-based implementation for message integrity verification
+ * - FLAG_CHECKSUM_ENABLED: CRC32 (IEEE 802.3), 기존 wire format
+ * - FLAG_CHECKSUM_ENABLED | FLAG_CHECKSUM_CRC32C: CRC32C (SSE4.2)
+ * - Receiver 는 flag 를 보고 polynomial 을 고름 (version 변경 없음)
+ * - See Checksum.h
  */
-namespace {
-    // CRC32 lookup table (generated once)
-    constexpr uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
-
-    constexpr uint32_t generateCRC32Entry(uint8_t index) {
-        uint32_t crc = index;
-        for (int i = 0; i < 8; ++i) {
-            crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLYNOMIAL : 0);
-        }
-        return crc;
-    }
-
-    // Compile-time CRC32 table generation
-    template<size_t... I>
-    constexpr auto makeCRC32Table(std::index_sequence<I...>) {
-        return std::array<uint32_t, 256>{generateCRC32Entry(I)...};
-    }
-
-    constexpr auto CRC32_TABLE = makeCRC32Table(std::make_index_sequence<256>{});
-}
 
 // Forward declaration
 struct MessageHeader;
@@ -81,23 +110,28 @@ struct MessageHeader;
  * Calculate CRC32 checksum for a data buffer
  */
 inline uint32_t calculateCRC32(const uint8_t* data, size_t length) {
-    uint32_t crc = 0xFFFFFFFF;
-
-    for (size_t i = 0; i < length; ++i) {
-        uint8_t index = (crc ^ data[i]) & 0xFF;
-        crc = (crc >> 8) ^ CRC32_TABLE[index];
-    }
-
-    return ~crc;
+    return checksum::crc32(0, data, length);
 }
 
+/**
+ * Calculate checksum for a message (header + payload) without copying the header
+ */
+inline uint32_t calculateMessageChecksum(ChecksumType type, const MessageHeader* header,
+                                         const uint8_t* payload, uint32_t payload_length);
+
 /**
  * Calculate CRC32 for MessageBuffer (header + payload)
  *
- * Note: Checksum field itself is excluded from calculation
+ * Note: Checksum field itself and recv_time_ns (filled by the subscriber)
+ * are counted as zero
  */
 inline uint32_t calculateMessageCRC32(const MessageHeader* header, const uint8_t* payload, uint32_t payload_length);
 
+/**
+ * Verify the checksum selected by the header flags (true if none is set)
+ */
+inline bool verifyMessageChecksum(const MessageHeader* header, const uint8_t* payload, uint32_t payload_length);
+
 /**
  * Message Header (64 bytes, cache-line aligned)
  *
@@ -127,7 +161,7 @@ struct MessageHeader {
 
     // Integrity + Reserved (8 bytes)
     uint32_t checksum;           // CRC32 checksum (if enabled)
-    uint32_t reserved;           // Reserved for future use
+    uint32_t reserved;           // MSG_BATCH: inner message count, else 0
 
     // Total: 64 bytes
 
@@ -147,6 +181,13 @@ struct MessageHeader {
         return (flags & FLAG_CHECKSUM_ENABLED) != 0;
     }
 
+    ChecksumType checksumType() const {
+        if (!hasChecksum()) {
+            return ChecksumType::NONE;
+        }
+        return (flags & FLAG_CHECKSUM_CRC32C) ? ChecksumType::CRC32C : ChecksumType::CRC32;
+    }
+
     // Calculate network latency (publish → receive)
     double networkLatencyUs() const {
         if (recv_time_ns == 0 || publish_time_ns == 0) {
@@ -168,42 +209,69 @@ struct MessageHeader {
 static_assert(sizeof(MessageHeader) == 64, "MessageHeader must be 64 bytes");
 
 /**
- * Complete Message Buffer
+ * Buffer descriptor (pool metadata, NOT in wire format)
+ *
+ * Dense array indexed by buffer id, 4 descriptors per cache line:
+ * pool scans / statistics never touch header or payload lines.
+ */
+struct BufferDescriptor {
+    int64_t worker_dequeue_time_ns{0};       // Worker dequeue timestamp
+    uint32_t payload_length{0};              // Actual payload size
+    uint16_t stream_index{0};                // Subscribed stream (multi-stream)
+    std::atomic<bool> in_use{false};         // Buffer allocation state
+    uint8_t reserved{0};
+};
+
+static_assert(sizeof(BufferDescriptor) == 16, "BufferDescriptor must be 16 bytes");
+
+/**
+ * Message Buffer (handle to one pooled buffer)
  *
- * Structure:
- * - Header: 64 bytes (wire format)
- * - Payload: up to 4096 bytes (wire format)
- * - Metadata: Pool management (NOT in wire format)
+ * The pool stores each field group in its own array (structure of arrays):
+ * - Header: 64 bytes (wire format), one cache line per buffer
+ * - Payload: slot of payload_capacity bytes in the pool's 4 KB-aligned slab
+ * - Descriptor: 16 bytes of pool metadata
  *
- * Total size: ~4.2KB per buffer
+ * The handle itself is 32 bytes and passed by value; queues carry only
+ * the BufferId (SizeClassBufferPool::resolve() turns it back into a handle).
+ * A default-constructed handle is empty (operator bool == false).
  */
 struct MessageBuffer {
-    // Wire format data
-    MessageHeader header;                    // 64 bytes
-    uint8_t payload[MAX_PAYLOAD_SIZE];       // 4096 bytes
+    MessageHeader* header{nullptr};          // Wire header (pool array)
+    uint8_t* payload{nullptr};               // Payload slot (pool slab)
+    BufferDescriptor* descriptor{nullptr};   // Pool metadata
+    uint32_t payload_capacity{0};            // Payload slot size
+    BufferId id{INVALID_BUFFER_ID};
+
+    explicit operator bool() const noexcept {
+        return header != nullptr;
+    }
 
-    // Pool management metadata (not part of wire format)
-    std::atomic<bool> in_use{false};         // Buffer allocation state
-    uint32_t actual_payload_length{0};       // Actual payload size
-    int64_t worker_dequeue_time_ns{0};       // Worker dequeue timestamp
-    uint32_t padding_[3];                    // Padding for alignment
+    // SizeClass of the owning pool
+    uint8_t sizeClass() const noexcept {
+        return bufferIdClass(id);
+    }
+
+    uint32_t payloadLength() const noexcept {
+        return descriptor->payload_length;
+    }
 
-    // Constructor
-    MessageBuffer() {
-        reset();
+    uint16_t streamIndex() const noexcept {
+        return descriptor->stream_index;
     }
 
     // Reset buffer to initial state
     void reset() {
-        memset(&header, 0, sizeof(header));
-        actual_payload_length = 0;
-        worker_dequeue_time_ns = 0;
+        memset(header, 0, sizeof(MessageHeader));
+        descriptor->payload_length = 0;
+        descriptor->stream_index = 0;
+        descriptor->worker_dequeue_time_ns = 0;
         // Don't reset in_use - managed by pool
     }
 
     // Get total wire format size
     size_t wireSize() const {
-        return sizeof(MessageHeader) + actual_payload_length;
+        return sizeof(MessageHeader) + descriptor->payload_length;
     }
 
     // Get payload pointer
@@ -216,51 +284,60 @@ struct MessageBuffer {
     }
 
     // Copy from Aeron buffer (called by subscriber thread)
-    void copyFromAeron(const uint8_t* aeron_buffer, size_t length) {
+    // Returns false if the payload did not fit the slot (truncated)
+    bool copyFromAeron(const uint8_t* aeron_buffer, size_t length) {
         // Copy header
         size_t header_size = std::min(length, sizeof(MessageHeader));
-        memcpy(&header, aeron_buffer, header_size);
+        memcpy(header, aeron_buffer, header_size);
 
         // Copy payload
         if (length > sizeof(MessageHeader)) {
             size_t payload_size = std::min(
                 length - sizeof(MessageHeader),
-                MAX_PAYLOAD_SIZE
+                static_cast<size_t>(payload_capacity)
             );
             memcpy(payload, aeron_buffer + sizeof(MessageHeader), payload_size);
-            actual_payload_length = static_cast<uint32_t>(payload_size);
-        } else {
-            actual_payload_length = 0;
+            descriptor->payload_length = static_cast<uint32_t>(payload_size);
+            return payload_size == length - sizeof(MessageHeader);
         }
+
+        descriptor->payload_length = 0;
+        return true;
+    }
+
+    // Append a continuation fragment (fragment reassembly)
+    // Returns false if the slot would overflow (nothing copied)
+    bool appendPayload(const uint8_t* data, size_t length) {
+        const uint32_t used = descriptor->payload_length;
+        if (length > payload_capacity - used) {
+            return false;
+        }
+        memcpy(payload + used, data, length);
+        descriptor->payload_length = used + static_cast<uint32_t>(length);
+        return true;
     }
 
     // Validate message integrity
     bool validate() const {
         // Check magic
-        if (!header.isValid()) {
+        if (!header->isValid()) {
             return false;
         }
 
         // Check version
-        if (header.version == 0 || header.version > 100) {
+        if (header->version == 0 || header->version > 100) {
             return false;
         }
 
         // Check message length
-        if (header.message_length > sizeof(MessageHeader) + MAX_PAYLOAD_SIZE) {
+        if (header->message_length > sizeof(MessageHeader) + payload_capacity) {
             return false;
         }
 
-        // Verify checksum if enabled
-        if (header.hasChecksum()) {
-            // Calculate expected CRC32
-            uint32_t expected_crc = calculateMessageCRC32(&header, payload, actual_payload_length);
-
-            // Compare with stored checksum
-            if (header.checksum != expected_crc) {
-                // Checksum mismatch - message corrupted
-                return false;
-            }
+        // Verify checksum if enabled (CRC32 or CRC32C, see flags)
+        if (!verifyMessageChecksum(header, payload, descriptor->payload_length)) {
+            // Checksum mismatch - message corrupted
+            return false;
         }
 
         return true;
@@ -268,16 +345,65 @@ struct MessageBuffer {
 
     // Calculate processing latency (receive → worker dequeue)
     double queuingLatencyUs() const {
-        if (worker_dequeue_time_ns == 0 || header.recv_time_ns == 0) {
+        const int64_t dequeue_time_ns = descriptor->worker_dequeue_time_ns;
+        if (dequeue_time_ns == 0 || header->recv_time_ns == 0) {
             return 0.0;
         }
-        return static_cast<double>(worker_dequeue_time_ns - header.recv_time_ns) / 1000.0;
+        return static_cast<double>(dequeue_time_ns - static_cast<int64_t>(header->recv_time_ns)) / 1000.0;
     }
 };
 
-// Calculate buffer size
+// Handle size (what a pointer-passing design would have moved per message)
 constexpr size_t MESSAGE_BUFFER_SIZE = sizeof(MessageBuffer);
 
+/**
+ * Message View (in-place receive mode)
+ *
+ * Lightweight reference to a message that lives somewhere else:
+ * - In-place mode: points straight into the Aeron term buffer (no copy)
+ * - In-place mode, fragmented message: points into the reassembled
+ *   owned_buffer (the only case where in-place mode copies)
+ * - Copy mode: points into a pooled MessageBuffer (see makeView())
+ *
+ * A term-buffer view is only valid until the worker releases its position
+ * back to the subscriber thread (see MessageViewQueue).
+ */
+struct MessageView {
+    const MessageHeader* header{nullptr};    // nullptr if fragment shorter than a header
+    const uint8_t* payload{nullptr};         // Payload start (after header)
+    uint32_t payload_length{0};              // Payload size
+    int64_t recv_time_ns{0};                 // Receiver timestamp (header is read-only)
+    int64_t position{0};                     // Image position after this fragment
+    bool discard{false};                     // Duplicate - release without processing
+    uint16_t stream_index{0};                // Subscribed stream (multi-stream)
+    BufferId owned_buffer{INVALID_BUFFER_ID};  // Reassembled copy (worker returns it to pool)
+
+    // Wrap a raw Aeron fragment without copying
+    static MessageView fromAeron(const uint8_t* aeron_buffer, size_t length,
+                                 int64_t recv_time_ns, int64_t position) {
+        MessageView view;
+        if (length >= sizeof(MessageHeader)) {
+            view.header = reinterpret_cast<const MessageHeader*>(aeron_buffer);
+            view.payload = aeron_buffer + sizeof(MessageHeader);
+            view.payload_length = static_cast<uint32_t>(length - sizeof(MessageHeader));
+        }
+        view.recv_time_ns = recv_time_ns;
+        view.position = position;
+        return view;
+    }
+};
+
+// View of a pooled buffer (copy mode)
+inline MessageView makeView(const MessageBuffer& buf) {
+    MessageView view;
+    view.header = buf.header;
+    view.payload = buf.payload;
+    view.payload_length = buf.descriptor->payload_length;
+    view.recv_time_ns = static_cast<int64_t>(buf.header->recv_time_ns);
+    view.stream_index = buf.descriptor->stream_index;
+    return view;
+}
+
 // Helper function to get current time in nanoseconds
 inline int64_t getCurrentTimeNanos() {
     struct timespec ts;
@@ -285,29 +411,121 @@ inline int64_t getCurrentTimeNanos() {
     return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000LL + ts.tv_nsec;
 }
 
+// Implementation of calculateMessageChecksum (declared earlier)
+inline uint32_t calculateMessageChecksum(ChecksumType type, const MessageHeader* header,
+                                         const uint8_t* payload, uint32_t payload_length) {
+    // Header 는 복사하지 않음: receiver 가 채우는 recv_time_ns 와 checksum
+    // 필드는 0 으로 간주하고 나머지 구간을 이어서 계산
+    static constexpr uint8_t ZEROS[sizeof(uint64_t)] = {};
+    constexpr size_t recv_time_offset = offsetof(MessageHeader, recv_time_ns);
+    constexpr size_t recv_time_end = recv_time_offset + sizeof(uint64_t);
+    constexpr size_t checksum_offset = offsetof(MessageHeader, checksum);
+    constexpr size_t checksum_end = checksum_offset + sizeof(uint32_t);
+
+    const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(header);
+    uint32_t crc = checksum::compute(type, 0, header_bytes, recv_time_offset);
+    crc = checksum::compute(type, crc, ZEROS, sizeof(uint64_t));
+    crc = checksum::compute(type, crc, header_bytes + recv_time_end, checksum_offset - recv_time_end);
+    crc = checksum::compute(type, crc, ZEROS, sizeof(uint32_t));
+    crc = checksum::compute(type, crc, header_bytes + checksum_end, sizeof(MessageHeader) - checksum_end);
+
+    // Continue with payload
+    return checksum::compute(type, crc, payload, payload_length);
+}
+
 // Implementation of calculateMessageCRC32 (declared earlier)
 inline uint32_t calculateMessageCRC32(const MessageHeader* header, const uint8_t* payload, uint32_t payload_length) {
-    // Create a temporary header copy with checksum = 0
-    MessageHeader temp_header;
-    memcpy(&temp_header, header, sizeof(MessageHeader));
-    temp_header.checksum = 0;
-
-    // Calculate CRC32 of header (with checksum = 0)
-    uint32_t crc = 0xFFFFFFFF;
-    const uint8_t* header_bytes = reinterpret_cast<const uint8_t*>(&temp_header);
-
-    for (size_t i = 0; i < sizeof(MessageHeader); ++i) {
-        uint8_t index = (crc ^ header_bytes[i]) & 0xFF;
-        crc = (crc >> 8) ^ CRC32_TABLE[index];
+    return calculateMessageChecksum(ChecksumType::CRC32, header, payload, payload_length);
+}
+
+// Publisher: set checksum flags + checksum (NONE clears both)
+inline void setMessageChecksum(MessageHeader* header, const uint8_t* payload, uint32_t payload_length,
+                               ChecksumType type) {
+    header->flags = static_cast<uint8_t>(header->flags & ~(FLAG_CHECKSUM_ENABLED | FLAG_CHECKSUM_CRC32C));
+    header->checksum = 0;
+    if (type == ChecksumType::NONE) {
+        return;
     }
 
-    // Continue with payload
-    for (size_t i = 0; i < payload_length; ++i) {
-        uint8_t index = (crc ^ payload[i]) & 0xFF;
-        crc = (crc >> 8) ^ CRC32_TABLE[index];
+    header->flags = static_cast<uint8_t>(header->flags | FLAG_CHECKSUM_ENABLED |
+                                         (type == ChecksumType::CRC32C ? FLAG_CHECKSUM_CRC32C : 0));
+    header->checksum = calculateMessageChecksum(type, header, payload, payload_length);
+}
+
+// Receiver: true if the message carries no checksum or it matches
+inline bool verifyMessageChecksum(const MessageHeader* header, const uint8_t* payload, uint32_t payload_length) {
+    const ChecksumType type = header->checksumType();
+    return type == ChecksumType::NONE ||
+           header->checksum == calculateMessageChecksum(type, header, payload, payload_length);
+}
+
+/**
+ * Batch envelope (MSG_BATCH)
+ *
+ * Several small messages in one Aeron frame (one frame header, one offer):
+ *
+ *   [MessageHeader  type = MSG_BATCH, message_length = envelope length,
+ *                   sequence_number = first inner sequence, reserved = count]
+ *   [inner 0: MessageHeader + payload] pad to 8 [inner 1] ... [inner n-1]
+ *
+ * - Inner message = a complete message (own sequence_number, checksum);
+ *   the receiver unpacks it and handles it exactly like an unbatched one
+ * - The envelope has no checksum and is never fragmented (publisher keeps
+ *   it within maxPayloadLength)
+ * - Inner headers start 8-byte aligned (in-place views read them directly)
+ */
+constexpr size_t BATCH_ALIGNMENT = 8;
+
+constexpr size_t batchAlign(size_t length) {
+    return (length + BATCH_ALIGNMENT - 1) & ~(BATCH_ALIGNMENT - 1);
+}
+
+inline bool isBatchEnvelope(const uint8_t* buffer, size_t length) {
+    return length >= sizeof(MessageHeader) &&
+           reinterpret_cast<const MessageHeader*>(buffer)->message_type == MSG_BATCH;
+}
+
+/**
+ * Inner message count of a well-formed envelope, 0 if malformed
+ * (bad magic / length, inner message past the end, count mismatch)
+ */
+inline uint32_t batchMessageCount(const uint8_t* buffer, size_t length) {
+    const auto* envelope = reinterpret_cast<const MessageHeader*>(buffer);
+    if (!isBatchEnvelope(buffer, length) || !envelope->isValid() ||
+        envelope->message_length != length) {
+        return 0;
+    }
+
+    uint32_t count = 0;
+    size_t offset = sizeof(MessageHeader);
+    while (offset < length) {
+        if (length - offset < sizeof(MessageHeader)) {
+            return 0;
+        }
+        const uint32_t message_length =
+            reinterpret_cast<const MessageHeader*>(buffer + offset)->message_length;
+        if (message_length < sizeof(MessageHeader) || message_length > length - offset) {
+            return 0;
+        }
+        count++;
+        offset += batchAlign(message_length);
     }
+    return count == envelope->reserved ? count : 0;
+}
 
-    return ~crc;
+/**
+ * handler(const uint8_t* message, size_t length) for each inner message
+ * (envelope must have passed batchMessageCount)
+ */
+template <typename Handler>
+inline void forEachBatchMessage(const uint8_t* buffer, size_t length, Handler&& handler) {
+    size_t offset = sizeof(MessageHeader);
+    while (offset < length) {
+        const uint32_t message_length =
+            reinterpret_cast<const MessageHeader*>(buffer + offset)->message_length;
+        handler(buffer + offset, static_cast<size_t>(message_length));
+        offset += batchAlign(message_length);
+    }
 }
 
 } // namespace example
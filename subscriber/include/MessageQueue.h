@@ -1,42 +1,57 @@
 /**
  * MessageQueue.h
  *
- * Zero-copy message queue using pointer passing
+ * Zero-copy message queue using buffer id passing
  *
  * Design:
  * - Lock-free SPSC (Single Producer Single Consumer)
- * - Passes MessageBuffer pointers (NOT data)
- * - Ring buffer with power-of-2 size
+ * - Passes 32-bit BufferIds (NOT data, NOT pointers): 16 slots per
+ *   cache line, the worker resolves ids through the pool
+ * - Ring buffer with power-of-2 size (set at construction, e.g. from INI)
+ * - Slot array optionally placed in a MemoryArena (hugepages)
  * - Cache-line aligned to prevent false sharing
+ * - Optional Doorbell: the producer wakes a parked consumer after each
+ *   publish (park idle strategy); without one, enqueue is unchanged
  *
  * Performance:
- * - Enqueue: ~50ns (pointer copy only)
- * - Dequeue: ~50ns (pointer copy only)
- * - Zero data copy (only pointer transfer)
- * - Memory: Size × sizeof(MessageBuffer*) = Size × 8 bytes
+ * - Enqueue: ~50ns (id copy only)
+ * - Dequeue: ~50ns (id copy only)
+ * - enqueueBatch/drainTo: one release store per batch (not per message)
+ * - Zero data copy (only id transfer)
+ * - Memory: size × sizeof(BufferId) = size × 4 bytes
  *
  * Usage:
- *   MessageQueue<4096> queue;  // 4K slots = 32KB memory
+ *   MessageQueue queue(4096, &arena);  // 4K slots = 16KB memory
  *
  *   // Producer (Subscriber thread)
- *   MessageBuffer* buf = pool.allocate();
+ *   MessageBuffer buf = pool.allocate(length);
  *   // ... fill buffer ...
- *   queue.enqueue(buf);
+ *   queue.enqueue(buf.id);
  *
  *   // Consumer (Worker thread)
- *   MessageBuffer* buf;
- *   if (queue.dequeue(buf)) {
+ *   BufferId id;
+ *   if (queue.dequeue(id)) {
+ *       MessageBuffer buf = pool.resolve(id);
  *       // ... process buffer ...
- *       pool.deallocate(buf);
+ *       pool.deallocate(id);
  *   }
+ *
+ *   // Batched (one poll() result / one burst at a time)
+ *   queue.enqueueBatch(ids, count);
+ *   queue.drainTo([&](BufferId id) { ... }, 64);
  */
 
 #ifndef AERON_EXAMPLE_MESSAGE_QUEUE_H
 #define AERON_EXAMPLE_MESSAGE_QUEUE_H
 
 #include "MessageBuffer.h"
+#include "MemoryArena.h"
+#include "Doorbell.h"
+#include "StatCounter.h"
 #include <atomic>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace aeron {
 namespace example {
@@ -49,35 +64,42 @@ namespace example {
  * - Power-of-2 size for fast modulo (bitwise AND)
  * - Lock-free using atomic operations
  * - Cache-line alignment to prevent false sharing
+ * - Producer caches head, consumer caches tail: the other core's cache
+ *   line is only read when the cached copy says full/empty
+ * - Statistics are single-writer counters (no locked fetch_add)
  *
  * Thread Safety:
  * - Single Producer Single Consumer (SPSC)
  * - One thread enqueues, one thread dequeues
  * - Lock-free and wait-free
  */
-template<size_t Size>
 class MessageQueue {
-    static_assert((Size & (Size - 1)) == 0, "Size must be power of 2");
-    static_assert(Size >= 16, "Size must be at least 16");
-    static_assert(Size <= 65536, "Size must be at most 65536");
-
 public:
+    static constexpr size_t DEFAULT_SIZE = 4096;
+    static constexpr size_t MIN_SIZE = 16;
+    static constexpr size_t MAX_SIZE = 1 << 20;
+
     /**
-     * Constructor
+     * Constructor (all slots start empty)
+     *
+     * @param size Slots (power of 2, MIN_SIZE..MAX_SIZE)
+     * @param arena Backing memory for the slots (nullptr = heap)
+     * @throws std::invalid_argument bad size
      */
-    MessageQueue() : head_(0), tail_(0) {
-        // Initialize all slots to nullptr
-        for (size_t i = 0; i < Size; i++) {
-            buffer_[i] = nullptr;
-        }
+    explicit MessageQueue(size_t size = DEFAULT_SIZE, MemoryArena* arena = nullptr)
+        : size_(checkedSize(size))
+        , mask_(size_ - 1)
+        , arena_(arena)
+        , buffer_(MemoryArena::newArray<BufferId>(arena, size_))
+        , head_(0), tail_cache_(0), tail_(0), head_cache_(0) {
 
         total_enqueued_.store(0, std::memory_order_relaxed);
         total_dequeued_.store(0, std::memory_order_relaxed);
         enqueue_failures_.store(0, std::memory_order_relaxed);
 
-        std::cout << "MessageQueue initialized: " << Size << " slots, "
-                  << (Size * sizeof(MessageBuffer*) / 1024) << " KB"
-                  << std::endl;
+        std::cout << "MessageQueue initialized: " << size_ << " slots, "
+                  << (size_ * sizeof(BufferId) / 1024) << " KB"
+                  << (arena_ ? " (arena)" : "") << std::endl;
     }
 
     /**
@@ -90,6 +112,7 @@ public:
             std::cerr << "WARNING: MessageQueue destroyed with "
                       << remaining << " messages still in queue" << std::endl;
         }
+        MemoryArena::deleteArray(arena_, buffer_, size_);
     }
 
     // Non-copyable
@@ -97,70 +120,166 @@ public:
     MessageQueue& operator=(const MessageQueue&) = delete;
 
     /**
-     * Enqueue a message buffer pointer
+     * Ring doorbell after every publish (consumer parks on it)
      *
-     * Performance: ~50ns (pointer copy + atomic store)
+     * Call before the producer starts. Cost per enqueue / batch: one
+     * fence + one load; futex_wake only while the consumer is parked.
+     */
+    void setDoorbell(Doorbell* doorbell) noexcept {
+        doorbell_ = doorbell;
+    }
+
+    /**
+     * Enqueue a message buffer id
+     *
+     * Performance: ~50ns (id copy + atomic store)
      *
-     * @param buf Message buffer pointer
+     * @param id Message buffer id
      * @return true if enqueued, false if queue is full
      */
-    bool enqueue(MessageBuffer* buf) noexcept {
-        if (!buf) {
+    bool enqueue(BufferId id) noexcept {
+        if (id == INVALID_BUFFER_ID) {
             return false;
         }
 
         const size_t current_tail = tail_.load(std::memory_order_relaxed);
-        const size_t next_tail = (current_tail + 1) & (Size - 1);
-
-        // Check if queue is full
-        if (next_tail == head_.load(std::memory_order_acquire)) {
-            enqueue_failures_.fetch_add(1, std::memory_order_relaxed);
-            return false;
+        const size_t next_tail = (current_tail + 1) & mask_;
+
+        // Check if queue is full (refresh cached head only when needed)
+        if (next_tail == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (next_tail == head_cache_) {
+                bump(enqueue_failures_, 1);
+                return false;
+            }
         }
 
-        // Store buffer pointer
-        buffer_[current_tail] = buf;
+        // Store buffer id
+        buffer_[current_tail] = id;
 
         // Update tail (release semantics to ensure visibility)
         tail_.store(next_tail, std::memory_order_release);
 
+        if (doorbell_) {
+            doorbell_->ring();
+        }
+
         // Update statistics
-        total_enqueued_.fetch_add(1, std::memory_order_relaxed);
+        bump(total_enqueued_, 1);
 
         return true;
     }
 
     /**
-     * Dequeue a message buffer pointer
+     * Enqueue a batch of buffer ids (producer)
+     *
+     * Publishes the tail once for the whole batch. If the queue cannot
+     * take everything, the leading part is enqueued and the rest is left
+     * to the caller.
+     *
+     * @param ids Buffer ids
+     * @param count Number of buffers
+     * @return Number of buffers enqueued (prefix of ids)
+     */
+    size_t enqueueBatch(const BufferId* ids, size_t count) noexcept {
+        if (count == 0) {
+            return 0;
+        }
+
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+
+        size_t free_slots = (head_cache_ - current_tail - 1) & mask_;
+        if (free_slots < count) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            free_slots = (head_cache_ - current_tail - 1) & mask_;
+        }
+
+        const size_t n = count < free_slots ? count : free_slots;
+        for (size_t i = 0; i < n; i++) {
+            buffer_[(current_tail + i) & mask_] = ids[i];
+        }
+
+        if (n > 0) {
+            tail_.store((current_tail + n) & mask_, std::memory_order_release);
+            if (doorbell_) {
+                doorbell_->ring();
+            }
+            bump(total_enqueued_, n);
+        }
+        if (n < count) {
+            bump(enqueue_failures_, count - n);
+        }
+
+        return n;
+    }
+
+    /**
+     * Dequeue a message buffer id
      *
-     * Performance: ~50ns (atomic load + pointer copy)
+     * Performance: ~50ns (atomic load + id copy)
      *
-     * @param buf Output parameter for buffer pointer
+     * @param id Output parameter for buffer id
      * @return true if dequeued, false if queue is empty
      */
-    bool dequeue(MessageBuffer*& buf) noexcept {
+    bool dequeue(BufferId& id) noexcept {
         const size_t current_head = head_.load(std::memory_order_relaxed);
 
-        // Check if queue is empty
-        if (current_head == tail_.load(std::memory_order_acquire)) {
-            return false;
+        // Check if queue is empty (refresh cached tail only when needed)
+        if (current_head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (current_head == tail_cache_) {
+                return false;
+            }
         }
 
-        // Get buffer pointer
-        buf = buffer_[current_head];
+        // Get buffer id
+        id = buffer_[current_head];
 
         // Clear slot (optional, for debugging)
-        buffer_[current_head] = nullptr;
+        buffer_[current_head] = INVALID_BUFFER_ID;
 
         // Update head (release semantics)
-        head_.store((current_head + 1) & (Size - 1), std::memory_order_release);
+        head_.store((current_head + 1) & mask_, std::memory_order_release);
 
         // Update statistics
-        total_dequeued_.fetch_add(1, std::memory_order_relaxed);
+        bump(total_dequeued_, 1);
 
         return true;
     }
 
+    /**
+     * Drain up to limit buffers into handler (consumer)
+     *
+     * The head is published once after the whole burst, so the producer
+     * sees the freed slots together.
+     *
+     * @param handler Called as handler(BufferId) for each buffer
+     * @param limit Maximum number of buffers to drain
+     * @return Number of buffers drained
+     */
+    template<typename Handler>
+    size_t drainTo(Handler&& handler, size_t limit) {
+        const size_t current_head = head_.load(std::memory_order_relaxed);
+
+        size_t available = (tail_cache_ - current_head) & mask_;
+        if (available < limit) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            available = (tail_cache_ - current_head) & mask_;
+        }
+
+        const size_t n = available < limit ? available : limit;
+        for (size_t i = 0; i < n; i++) {
+            handler(buffer_[(current_head + i) & mask_]);
+        }
+
+        if (n > 0) {
+            head_.store((current_head + n) & mask_, std::memory_order_release);
+            bump(total_dequeued_, n);
+        }
+
+        return n;
+    }
+
     /**
      * Get current queue size
      *
@@ -171,7 +290,7 @@ public:
     size_t size() const noexcept {
         const size_t h = head_.load(std::memory_order_acquire);
         const size_t t = tail_.load(std::memory_order_acquire);
-        return (t - h) & (Size - 1);
+        return (t - h) & mask_;
     }
 
     /**
@@ -184,6 +303,22 @@ public:
                tail_.load(std::memory_order_acquire);
     }
 
+    /**
+     * Free slots as seen by the producer (producer thread only)
+     *
+     * Uses the cached head; refreshes it only if the cache shows fewer
+     * than needed free slots (a stale cache would cause spurious aborts).
+     */
+    size_t freeSlots(size_t needed = 1) noexcept {
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+        size_t free_slots = (head_cache_ - current_tail - 1) & mask_;
+        if (free_slots < needed) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            free_slots = (head_cache_ - current_tail - 1) & mask_;
+        }
+        return free_slots;
+    }
+
     /**
      * Check if queue is full
      *
@@ -191,17 +326,17 @@ public:
      */
     bool full() const noexcept {
         const size_t current_tail = tail_.load(std::memory_order_acquire);
-        const size_t next_tail = (current_tail + 1) & (Size - 1);
+        const size_t next_tail = (current_tail + 1) & mask_;
         return next_tail == head_.load(std::memory_order_acquire);
     }
 
     /**
      * Get queue capacity
      *
-     * @return Maximum number of messages (Size - 1)
+     * @return Maximum number of messages (size - 1)
      */
-    constexpr size_t capacity() const noexcept {
-        return Size - 1;  // One slot is always unused
+    size_t capacity() const noexcept {
+        return size_ - 1;  // One slot is always unused
     }
 
     /**
@@ -270,26 +405,42 @@ public:
     void clear() noexcept {
         head_.store(0, std::memory_order_release);
         tail_.store(0, std::memory_order_release);
+        head_cache_ = 0;
+        tail_cache_ = 0;
     }
 
 private:
-    // Ring buffer (cache-line aligned)
-    alignas(64) MessageBuffer* buffer_[Size];
+    static size_t checkedSize(size_t size) {
+        if ((size & (size - 1)) != 0 || size < MIN_SIZE || size > MAX_SIZE) {
+            throw std::invalid_argument("MessageQueue size must be a power of 2 in ["
+                                        + std::to_string(MIN_SIZE) + ", "
+                                        + std::to_string(MAX_SIZE) + "]: "
+                                        + std::to_string(size));
+        }
+        return size;
+    }
 
-    // Head and tail pointers (separate cache lines to prevent false sharing)
-    alignas(64) std::atomic<size_t> head_;
-    alignas(64) std::atomic<size_t> tail_;
+    // Ring buffer (read-only after construction, 64-byte aligned slots)
+    const size_t size_;
+    const size_t mask_;
+    MemoryArena* const arena_;
+    BufferId* const buffer_;
+    Doorbell* doorbell_ = nullptr;      // Consumer wakeup (optional, set before start)
 
-    // Statistics (separate cache line)
-    alignas(64) std::atomic<uint64_t> total_enqueued_;
+    // Consumer line: head + consumer-local copy of tail + consumer stats
+    alignas(64) std::atomic<size_t> head_;
+    size_t tail_cache_;
     std::atomic<uint64_t> total_dequeued_;
+
+    // Producer line: tail + producer-local copy of head + producer stats
+    alignas(64) std::atomic<size_t> tail_;
+    size_t head_cache_;
+    std::atomic<uint64_t> total_enqueued_;
     std::atomic<uint64_t> enqueue_failures_;
 };
 
-// Recommended queue sizes
-using MessageBufferQueue = MessageQueue<4096>;   // 4K slots (~32 KB)
-using LargeMessageQueue = MessageQueue<16384>;   // 16K slots (~128 KB)
-using SmallMessageQueue = MessageQueue<1024>;    // 1K slots (~8 KB)
+// Subscriber → worker queue (size from INI [memory] message_queue)
+using MessageBufferQueue = MessageQueue;
 
 } // namespace example
 } // namespace aeron
@@ -0,0 +1,128 @@
+/**
+ * MessageValidator.h
+ *
+ * Message integrity checks with per-reason failure counters
+ *
+ * Checks (in this order, first failure is reported):
+ * - TOO_SHORT:    fragment shorter than a MessageHeader
+ * - BAD_MAGIC:    magic != "SEKR"
+ * - BAD_VERSION:  version outside 1..MAX_VERSION
+ * - BAD_LENGTH:   message_length != header + received payload
+ * - BAD_TYPE:     message_type not a known MessageType
+ * - BAD_CHECKSUM: CRC32 / CRC32C mismatch (only if the header flags one)
+ *
+ * Design:
+ * - validateBatch(): structural checks for 4 headers per SSE2 compare
+ *   (fields gathered into lanes, one movemask per check), checksums only
+ *   for the flagged messages that passed them
+ * - validate(): same checks for one message (receive thread: fragments
+ *   arrive one at a time, checked before sequence tracking)
+ * - Counters are single-writer (the thread that owns the validator)
+ *
+ * Performance:
+ * - Structural checks: ~1-2 ns per message in batches
+ * - Checksum: CRC32C ~30 ns for 64 B header + 256 B payload (SSE4.2)
+ *
+ * Usage:
+ *   MessageValidator validator;
+ *   validator.validateBatch(views, count, results);
+ *   if (results[i] != ValidationResult::OK) { drop }
+ */
+
+#ifndef AERON_EXAMPLE_MESSAGE_VALIDATOR_H
+#define AERON_EXAMPLE_MESSAGE_VALIDATOR_H
+
+#include "MessageBuffer.h"
+#include "StatCounter.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace aeron {
+namespace example {
+
+enum class ValidationResult : uint8_t {
+    OK = 0,
+    TOO_SHORT,
+    BAD_MAGIC,
+    BAD_VERSION,
+    BAD_LENGTH,
+    BAD_TYPE,
+    BAD_CHECKSUM,
+    COUNT
+};
+
+constexpr size_t VALIDATION_RESULT_COUNT = static_cast<size_t>(ValidationResult::COUNT);
+
+class MessageValidator {
+public:
+    // Accepted header versions (same bound as MessageBuffer::validate)
+    static constexpr uint16_t MAX_VERSION = 100;
+
+    // Known message types: MSG_ORDER_NEW..MSG_HEARTBEAT, MSG_TEST
+    // (MSG_BATCH envelopes are unpacked before validation - one that reaches
+    //  the validator is BAD_TYPE)
+    static constexpr uint16_t MIN_MESSAGE_TYPE = MSG_ORDER_NEW;
+    static constexpr uint16_t MAX_MESSAGE_TYPE = MSG_HEARTBEAT;
+
+    struct Statistics {
+        uint64_t checked;                             // Messages validated
+        uint64_t checksums_verified;                  // Checksum computed (flagged)
+        uint64_t failures[VALIDATION_RESULT_COUNT];   // Per reason ([OK] unused)
+
+        uint64_t invalid() const noexcept {
+            uint64_t total = 0;
+            for (size_t i = 1; i < VALIDATION_RESULT_COUNT; i++) {
+                total += failures[i];
+            }
+            return total;
+        }
+    };
+
+    MessageValidator() = default;
+
+    // Non-copyable
+    MessageValidator(const MessageValidator&) = delete;
+    MessageValidator& operator=(const MessageValidator&) = delete;
+
+    /**
+     * Validate one message
+     */
+    ValidationResult validate(const MessageView& view) noexcept;
+
+    /**
+     * Validate count messages (any count, processed in groups of 4)
+     *
+     * @param results One result per view
+     * @return Number of valid messages
+     */
+    size_t validateBatch(const MessageView* views, size_t count, ValidationResult* results) noexcept;
+
+    Statistics getStatistics() const noexcept;
+
+    // "too short", "bad magic", ...
+    static const char* reasonName(ValidationResult result) noexcept;
+
+    /**
+     * One line per failure reason that occurred (prefix: indentation)
+     */
+    void printStatistics(const char* prefix) const;
+
+private:
+    // Checksum of a structurally valid message (flagged only)
+    ValidationResult checkChecksum(const MessageView& view) noexcept;
+
+    // Count one result (single writer)
+    void record(ValidationResult result) noexcept {
+        bump(failures_[static_cast<size_t>(result)]);
+    }
+
+    std::atomic<uint64_t> checked_{0};
+    std::atomic<uint64_t> checksums_verified_{0};
+    std::atomic<uint64_t> failures_[VALIDATION_RESULT_COUNT] = {};
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_MESSAGE_VALIDATOR_H
@@ -0,0 +1,164 @@
+/**
+ * MessageViewQueue.h
+ *
+ * In-place message queue (views into the Aeron term buffer)
+ *
+ * Design:
+ * - Lock-free SPSC queue of MessageView (no payload copy at all)
+ * - Worker publishes a "released position" after each processed view
+ * - Subscriber thread advances the Aeron image only up to that position,
+ *   so the term buffer region behind a view cannot be reused while the
+ *   worker still reads it
+ *
+ * Flow:
+ *   Subscriber thread                      Worker thread
+ *   controlledPeek(peek_pos) ──views──>    dequeue(view)
+ *   image->position(released) <──────      ... process ...
+ *                                          release(view.position)
+ *
+ * Memory: size × sizeof(MessageView) (no 4.2 KB buffer per message),
+ *         optionally in a MemoryArena (hugepages)
+ */
+
+#ifndef AERON_EXAMPLE_MESSAGE_VIEW_QUEUE_H
+#define AERON_EXAMPLE_MESSAGE_VIEW_QUEUE_H
+
+#include "MessageBuffer.h"
+#include "SPSCQueue.h"
+#include "StatCounter.h"
+#include <atomic>
+#include <iostream>
+#include <utility>
+
+namespace aeron {
+namespace example {
+
+class MessageViewQueue {
+public:
+    static constexpr size_t DEFAULT_SIZE = 4096;
+
+    /**
+     * @param size Views (rounded up to a power of 2)
+     * @param arena Backing memory for the views (nullptr = heap)
+     */
+    explicit MessageViewQueue(size_t size = DEFAULT_SIZE, MemoryArena* arena = nullptr)
+        : queue_(size, arena), released_position_(0) {
+        total_enqueued_.store(0, std::memory_order_relaxed);
+        total_released_.store(0, std::memory_order_relaxed);
+
+        std::cout << "MessageViewQueue initialized: " << (queue_.capacity() + 1) << " slots, "
+                  << ((queue_.capacity() + 1) * sizeof(MessageView) / 1024) << " KB"
+                  << (arena ? " (arena)" : "") << std::endl;
+    }
+
+    // Non-copyable
+    MessageViewQueue(const MessageViewQueue&) = delete;
+    MessageViewQueue& operator=(const MessageViewQueue&) = delete;
+
+    /**
+     * Enqueue a view (subscriber thread)
+     *
+     * @return true if enqueued, false if queue is full
+     */
+    bool enqueue(const MessageView& view) noexcept {
+        if (!queue_.enqueue(view)) {
+            return false;
+        }
+        bump(total_enqueued_, 1);
+        return true;
+    }
+
+    /**
+     * Enqueue one poll's worth of views (subscriber thread)
+     *
+     * @return Number of views enqueued (prefix of views)
+     */
+    size_t enqueueBatch(const MessageView* views, size_t count) noexcept {
+        const size_t n = queue_.enqueueBatch(views, count);
+        bump(total_enqueued_, n);
+        return n;
+    }
+
+    /**
+     * Dequeue a view (worker thread)
+     *
+     * The view stays valid until release() is called with its position.
+     */
+    bool dequeue(MessageView& view) noexcept {
+        return queue_.dequeue(view);
+    }
+
+    /**
+     * Drain up to limit views into handler (worker thread)
+     *
+     * Caller releases the last drained position once the burst is done.
+     */
+    template<typename Handler>
+    size_t drainTo(Handler&& handler, size_t limit) {
+        return queue_.drainTo(std::forward<Handler>(handler), limit);
+    }
+
+    /**
+     * Release all fragments up to and including position (worker thread)
+     *
+     * Views are released in queue order, so the position is monotonic.
+     */
+    void release(int64_t position) noexcept {
+        released_position_.store(position, std::memory_order_release);
+        bump(total_released_, 1);
+    }
+
+    /**
+     * Highest position released by the worker (subscriber thread)
+     */
+    int64_t releasedPosition() const noexcept {
+        return released_position_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Re-base released position when the subscriber switches image
+     *
+     * Only valid while nothing is outstanding (queue drained and released).
+     */
+    void resetReleasedPosition(int64_t position) noexcept {
+        released_position_.store(position, std::memory_order_release);
+    }
+
+    size_t size() const noexcept { return queue_.size(); }
+    bool empty() const noexcept { return queue_.empty(); }
+    bool full() const noexcept { return queue_.size() >= queue_.capacity(); }
+    size_t freeSlots(size_t needed = 1) noexcept { return queue_.freeSlots(needed); }  // Subscriber thread only
+    size_t capacity() const noexcept { return queue_.capacity(); }
+
+    double utilization() const noexcept {
+        return static_cast<double>(size()) / capacity();
+    }
+
+    void printStatistics() const {
+        std::cout << "\n=== Message View Queue Statistics ===" << std::endl;
+        std::cout << "Capacity:          " << capacity() << " views" << std::endl;
+        std::cout << "Current size:      " << size() << std::endl;
+        std::cout << "Enqueued:          " << total_enqueued_.load(std::memory_order_relaxed) << std::endl;
+        std::cout << "Release stores:    " << total_released_.load(std::memory_order_relaxed) << std::endl;
+        std::cout << "Released position: " << releasedPosition() << std::endl;
+        std::cout << "=====================================\n" << std::endl;
+    }
+
+private:
+    SPSCQueue<MessageView> queue_;
+
+    // Written by worker, read by subscriber thread (own cache line)
+    alignas(64) std::atomic<int64_t> released_position_;
+
+    // Statistics (one writer each, separate cache lines)
+    alignas(64) std::atomic<uint64_t> total_enqueued_;
+    alignas(64) std::atomic<uint64_t> total_released_;
+};
+
+// In-place subscriber → worker queue (size from INI [memory] view_queue)
+using InPlaceMessageQueue = MessageViewQueue;
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_MESSAGE_VIEW_QUEUE_H
@@ -5,7 +5,7 @@
  *
  * Responsibilities:
  * - Dequeue messages from MessageQueue
- * - Validate message integrity
+ * - Validate message integrity (per burst, see MessageValidator)
  * - Duplicate detection (sequence-based)
  * - Business logic processing
  * - Send statistics to monitoring
@@ -13,7 +13,8 @@
  *
  * Design:
  * - Single consumer from message queue (SPSC)
- * - Hash-based duplicate detection
+ * - Optional recovered queue (gap fill output), same processing path
+ * - Bounded duplicate detection per (stream, publisher, session) source
  * - Extensible message type handlers
  * - Graceful shutdown support
  */
@@ -22,11 +23,16 @@
 #define AERON_EXAMPLE_MESSAGE_WORKER_H
 
 #include "MessageBuffer.h"
-#include "BufferPool.h"
+#include "SizeClassBufferPool.h"
 #include "MessageQueue.h"
+#include "MessageViewQueue.h"
+#include "ByteRingBuffer.h"
 #include "SPSCQueue.h"
+#include "IdleStrategy.h"
+#include "ThreadUtil.h"
+#include "DedupTable.h"
+#include "MessageValidator.h"
 #include <atomic>
-#include <unordered_set>
 #include <thread>
 #include <functional>
 
@@ -44,12 +50,21 @@ public:
      * Business logic callback type
      *
      * Called for each validated, non-duplicate message
-     * Parameters: MessageBuffer pointer
+     * Parameters: MessageBuffer handle (valid only during the call)
      */
     using MessageHandler = std::function<void(const MessageBuffer*)>;
 
     /**
-     * Constructor
+     * View callback type
+     *
+     * Called for each validated, non-duplicate message in all receive
+     * modes. In in-place / ring mode the view points into the Aeron term
+     * buffer / byte ring and is only valid for the duration of the call.
+     */
+    using ViewHandler = std::function<void(const MessageView&)>;
+
+    /**
+     * Constructor (copy mode)
      *
      * @param queue Message queue (source of messages)
      * @param pool Buffer pool (for returning buffers)
@@ -60,6 +75,30 @@ public:
         MessageBufferPool& pool,
         MessageStatsQueue& stats_queue);
 
+    /**
+     * Constructor (in-place mode)
+     *
+     * @param view_queue View queue (source of term buffer views)
+     * @param stats_queue Statistics queue (for monitoring)
+     * @param reassembly_pool Pool of reassembled (fragmented) messages, optional
+     */
+    MessageWorker(
+        InPlaceMessageQueue& view_queue,
+        MessageStatsQueue& stats_queue,
+        MessageBufferPool* reassembly_pool = nullptr);
+
+    /**
+     * Constructor (byte ring mode)
+     *
+     * @param ring Byte ring (records are read in place, no buffers to return)
+     * @param stats_queue Statistics queue (for monitoring)
+     * @param pool Pool of gap fill buffers (recovered queue), optional
+     */
+    MessageWorker(
+        MessageRingBuffer& ring,
+        MessageStatsQueue& stats_queue,
+        MessageBufferPool* pool = nullptr);
+
     ~MessageWorker();
 
     // Non-copyable
@@ -74,6 +113,52 @@ public:
      */
     void setMessageHandler(MessageHandler handler);
 
+    /**
+     * Set view handler (all receive modes)
+     */
+    void setViewHandler(ViewHandler handler);
+
+    /**
+     * Set idle strategy for empty queue (call before start())
+     *
+     * Default: backoff (spin → yield → 1~10 μs park)
+     * park: spin, then futex park; start() attaches this worker's doorbell
+     * to its message / recovered queues so their producers wake it
+     */
+    void setIdleStrategy(std::unique_ptr<IdleStrategy> strategy);
+
+    /**
+     * Idle strategy statistics of the worker loop
+     */
+    IdleStats getIdleStats() const;
+
+    /**
+     * Thread name / CPU affinity / SCHED_FIFO for the worker thread
+     * (call before start(), applied by the worker thread itself)
+     */
+    void setThreadSettings(const std::string& name, const ThreadSettings& settings);
+
+    /**
+     * Also drain messages recovered by the gap fill agent (call before
+     * start(); buffers are returned to this worker's pool)
+     */
+    void setRecoveredQueue(MessageBufferQueue* queue);
+
+    /**
+     * Validate live messages on this worker (default: true, call before
+     * start()). false when the subscriber thread already validates them
+     * ([validation] stage = receiver); recovered messages are always
+     * validated, short fragments always rejected.
+     */
+    void setValidation(bool enabled);
+
+    /**
+     * Per-reason validation counters of this worker
+     */
+    const MessageValidator& validator() const {
+        return validator_;
+    }
+
     /**
      * Start worker thread
      */
@@ -96,6 +181,7 @@ public:
         uint64_t messages_processed;      // Successfully processed
         uint64_t messages_invalid;        // Failed validation
         uint64_t messages_duplicate;      // Duplicate detected
+        uint64_t messages_recovered;      // Drained from the recovered queue
         uint64_t queue_empty_count;       // Queue was empty
         double avg_processing_time_us;    // Average processing time
         double avg_queue_depth;           // Average queue depth
@@ -115,22 +201,38 @@ private:
     // Worker thread main loop
     void workerThreadMain();
 
-    // Message processing steps
-    bool validateMessage(const MessageBuffer* buf);
-    bool checkDuplicate(const MessageBuffer* buf);
-    void processMessage(const MessageBuffer* buf);
-    void sendToMonitoring(const MessageBuffer* buf);
+    // Messages drained per burst (queue head published once per burst)
+    static constexpr size_t DRAIN_BATCH_LIMIT = 64;
+
+    // Drain + process one burst, returns number of messages drained
+    size_t drainBufferQueue(MessageBufferQueue& queue, bool validate);
+    size_t drainViewQueue();
+    size_t drainRing();
+
+    // Validate burst_views_[0, count) into burst_results_ (validate = false:
+    // only reject views without a header)
+    void validateBurst(size_t count, bool validate);
+
+    // Message processing steps (buf is nullptr in in-place / ring mode)
+    void processView(const MessageView& view, const MessageBuffer* buf, ValidationResult result);
+    bool checkDuplicate(const MessageView& view);
+    void processMessage(const MessageView& view, const MessageBuffer* buf);
+    void sendToMonitoring(const MessageView& view);
 
     // Message type handlers (extensible)
-    void handleOrderNew(const MessageBuffer* buf);
-    void handleOrderExecution(const MessageBuffer* buf);
-    void handleOrderModify(const MessageBuffer* buf);
-    void handleOrderCancel(const MessageBuffer* buf);
-    void handleQuoteUpdate(const MessageBuffer* buf);
-
-    // References (not owned)
-    MessageBufferQueue& message_queue_;
-    MessageBufferPool& buffer_pool_;
+    void handleOrderNew(const MessageView& view);
+    void handleOrderExecution(const MessageView& view);
+    void handleOrderModify(const MessageView& view);
+    void handleOrderCancel(const MessageView& view);
+    void handleQuoteUpdate(const MessageView& view);
+
+    // Sources (not owned) - exactly one of message_queue_/view_queue_/ring_ is set
+    // buffer_pool_: copy mode pool, or in-place / ring side pool (may be null)
+    MessageBufferQueue* message_queue_;
+    MessageBufferPool* buffer_pool_;
+    InPlaceMessageQueue* view_queue_;
+    MessageRingBuffer* ring_;
+    MessageBufferQueue* recovered_queue_;   // Gap fill output (optional)
     MessageStatsQueue& stats_queue_;
 
     // Worker thread
@@ -139,14 +241,36 @@ private:
 
     // Business logic handler (optional)
     MessageHandler message_handler_;
+    ViewHandler view_handler_;
+
+    // Empty-queue wait policy
+    std::unique_ptr<IdleStrategy> idle_strategy_;
+
+    // Producers' wakeup for the park idle strategy (copy mode queues)
+    Doorbell doorbell_;
+    bool doorbell_attached_ = false;
+
+    // Thread placement
+    std::string thread_name_;
+    ThreadSettings thread_settings_;
+
+    // Duplicate detection (sliding bitmap per source, fixed memory)
+    DedupTable dedup_;
+
+    // Integrity checks, batched per drained burst
+    MessageValidator validator_;
+    bool validation_enabled_ = true;
 
-    // Duplicate detection
-    std::unordered_set<uint64_t> seen_sequences_;
+    // Current burst (views validated together before processing)
+    MessageView burst_views_[DRAIN_BATCH_LIMIT];
+    MessageBuffer burst_buffers_[DRAIN_BATCH_LIMIT];
+    ValidationResult burst_results_[DRAIN_BATCH_LIMIT];
 
     // Statistics
     std::atomic<uint64_t> messages_processed_;
     std::atomic<uint64_t> messages_invalid_;
     std::atomic<uint64_t> messages_duplicate_;
+    std::atomic<uint64_t> messages_recovered_;
     std::atomic<uint64_t> queue_empty_count_;
 
     // Performance metrics
@@ -1,6 +1,7 @@
 #ifndef SPSC_QUEUE_H
 #define SPSC_QUEUE_H
 
+#include "MemoryArena.h"
 #include <atomic>
 #include <cstddef>
 #include <new>
@@ -11,22 +12,31 @@
  * 성능 특성:
  * - Enqueue: ~50ns (lock-free)
  * - Dequeue: ~50ns (lock-free)
- * - Cache-friendly (false sharing 방지)
+ * - enqueueBatch/drainTo: batch당 release store 1회
+ * - Cache-friendly (false sharing 방지, 상대편 index는 cached copy 사용)
  *
  * 제약사항:
  * - 단일 Producer, 단일 Consumer만 지원
- * - Fixed size (생성 시 크기 결정)
+ * - Fixed size (생성 시 크기 결정, 2의 거듭제곱으로 올림)
+ * - arena 가 주어지면 slot 배열은 arena(hugepage) 에서 할당
  */
-template<typename T, size_t Size>
+template<typename T>
 class SPSCQueue {
-    static_assert((Size & (Size - 1)) == 0, "Size must be power of 2");
-
 public:
-    SPSCQueue() : head_(0), tail_(0) {
-        // Cache line alignment를 위한 초기화
+    explicit SPSCQueue(size_t size, aeron::example::MemoryArena* arena = nullptr)
+        : head_(0), tail_cache_(0), tail_(0), head_cache_(0)
+        , size_(roundUpPowerOf2(size))
+        , mask_(size_ - 1)
+        , arena_(arena)
+        , buffer_(aeron::example::MemoryArena::newArray<T>(arena, size_)) {
+    }
+
+    ~SPSCQueue() {
+        aeron::example::MemoryArena::deleteArray(arena_, buffer_, size_);
     }
 
-    ~SPSCQueue() = default;
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
 
     // Producer: 메시지를 queue에 추가 (Non-blocking)
     // 반환값: true = 성공, false = queue 가득 참
@@ -34,9 +44,12 @@ public:
         const size_t current_tail = tail_.load(std::memory_order_relaxed);
         const size_t next_tail = increment(current_tail);
 
-        // Queue가 가득 찼는지 확인
-        if (next_tail == head_.load(std::memory_order_acquire)) {
-            return false;  // Queue full, skip
+        // Queue가 가득 찼는지 확인 (cached head가 full일 때만 다시 읽음)
+        if (next_tail == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (next_tail == head_cache_) {
+                return false;  // Queue full, skip
+            }
         }
 
         // 데이터 저장
@@ -52,9 +65,12 @@ public:
     bool dequeue(T& item) noexcept {
         const size_t current_head = head_.load(std::memory_order_relaxed);
 
-        // Queue가 비어있는지 확인
-        if (current_head == tail_.load(std::memory_order_acquire)) {
-            return false;  // Queue empty
+        // Queue가 비어있는지 확인 (cached tail이 empty일 때만 다시 읽음)
+        if (current_head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (current_head == tail_cache_) {
+                return false;  // Queue empty
+            }
         }
 
         // 데이터 읽기
@@ -65,6 +81,63 @@ public:
         return true;
     }
 
+    // Producer: 여러 아이템을 한 번에 추가 (tail은 한 번만 publish)
+    // 반환값: 추가된 개수 (앞에서부터, 공간이 부족하면 일부만)
+    size_t enqueueBatch(const T* items, size_t count) noexcept {
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+
+        size_t free_slots = (head_cache_ - current_tail - 1) & mask_;
+        if (free_slots < count) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            free_slots = (head_cache_ - current_tail - 1) & mask_;
+        }
+
+        const size_t n = count < free_slots ? count : free_slots;
+        for (size_t i = 0; i < n; i++) {
+            buffer_[(current_tail + i) & mask_] = items[i];
+        }
+
+        if (n > 0) {
+            tail_.store((current_tail + n) & mask_, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // Consumer: 최대 limit개를 handler(const T&)로 처리 (head는 한 번만 publish)
+    // 반환값: 처리한 개수
+    template<typename Handler>
+    size_t drainTo(Handler&& handler, size_t limit) {
+        const size_t current_head = head_.load(std::memory_order_relaxed);
+
+        size_t available = (tail_cache_ - current_head) & mask_;
+        if (available < limit) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            available = (tail_cache_ - current_head) & mask_;
+        }
+
+        const size_t n = available < limit ? available : limit;
+        for (size_t i = 0; i < n; i++) {
+            handler(buffer_[(current_head + i) & mask_]);
+        }
+
+        if (n > 0) {
+            head_.store((current_head + n) & mask_, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // Producer: 남은 공간 (producer thread 전용, cached head 사용)
+    // cache 가 needed 보다 적으면 head_ 를 다시 읽음
+    size_t freeSlots(size_t needed = 1) noexcept {
+        const size_t current_tail = tail_.load(std::memory_order_relaxed);
+        size_t free_slots = (head_cache_ - current_tail - 1) & mask_;
+        if (free_slots < needed) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            free_slots = (head_cache_ - current_tail - 1) & mask_;
+        }
+        return free_slots;
+    }
+
     // Queue에 있는 아이템 개수 (근사치)
     size_t size() const noexcept {
         const size_t current_head = head_.load(std::memory_order_relaxed);
@@ -73,7 +146,7 @@ public:
         if (current_tail >= current_head) {
             return current_tail - current_head;
         } else {
-            return Size - current_head + current_tail;
+            return size_ - current_head + current_tail;
         }
     }
 
@@ -84,20 +157,37 @@ public:
     }
 
     // 최대 용량
-    constexpr size_t capacity() const noexcept {
-        return Size - 1;  // 1개는 full/empty 구분용
+    size_t capacity() const noexcept {
+        return size_ - 1;  // 1개는 full/empty 구분용
+    }
+
+    // 요청 크기 → 2의 거듭제곱 slot 수 (최소 2)
+    static size_t roundUpPowerOf2(size_t size) noexcept {
+        size_t rounded = 2;
+        while (rounded < size) {
+            rounded <<= 1;
+        }
+        return rounded;
     }
 
 private:
     // Index를 순환시킴 (power of 2 최적화)
     size_t increment(size_t idx) const noexcept {
-        return (idx + 1) & (Size - 1);
+        return (idx + 1) & mask_;
     }
 
     // Cache line padding으로 false sharing 방지
+    // 각 cache line에는 해당 스레드만 쓰는 cached copy를 같이 둔다
     alignas(64) std::atomic<size_t> head_;  // Consumer가 읽는 위치
+    size_t tail_cache_;                     // Consumer 전용: 마지막으로 본 tail
     alignas(64) std::atomic<size_t> tail_;  // Producer가 쓰는 위치
-    alignas(64) T buffer_[Size];
+    size_t head_cache_;                     // Producer 전용: 마지막으로 본 head
+
+    // 읽기 전용 (생성 후 불변)
+    alignas(64) const size_t size_;
+    const size_t mask_;
+    aeron::example::MemoryArena* const arena_;
+    T* const buffer_;
 };
 
 /**
@@ -109,20 +199,23 @@ struct MessageStats {
     int64_t send_timestamp;   // 전송 타임스탬프 (ns)
     int64_t recv_timestamp;   // 수신 타임스탬프 (ns)
     int64_t position;         // Aeron position
+    int64_t event_timestamp;  // 이벤트 / 의도한 전송 시각 (ns, load generator: intended time)
 
     // 기본 생성자
     MessageStats()
         : message_number(-1)
         , send_timestamp(0)
         , recv_timestamp(0)
-        , position(0) {}
+        , position(0)
+        , event_timestamp(0) {}
 
     // 매개변수 생성자
-    MessageStats(int64_t msg_num, int64_t send_ts, int64_t recv_ts, int64_t pos)
+    MessageStats(int64_t msg_num, int64_t send_ts, int64_t recv_ts, int64_t pos, int64_t event_ts = 0)
         : message_number(msg_num)
         , send_timestamp(send_ts)
         , recv_timestamp(recv_ts)
-        , position(pos) {}
+        , position(pos)
+        , event_timestamp(event_ts) {}
 
     // 레이턴시 계산 (마이크로초)
     double latency_us() const {
@@ -131,9 +224,18 @@ struct MessageStats {
         }
         return 0.0;
     }
+
+    // Coordinated omission 보정 레이턴시: 의도한 전송 시각부터 (마이크로초)
+    double corrected_latency_us() const {
+        if (event_timestamp > 0 && recv_timestamp > event_timestamp) {
+            return (recv_timestamp - event_timestamp) / 1000.0;
+        }
+        return 0.0;
+    }
 };
 
-// 권장 Queue 크기 (2의 거듭제곱)
-using MessageStatsQueue = SPSCQueue<MessageStats, 16384>;  // 16K items
+// 기본 Queue 크기 (INI [memory] stats_queue 로 변경)
+using MessageStatsQueue = SPSCQueue<MessageStats>;
+constexpr size_t DEFAULT_STATS_QUEUE_SIZE = 16384;  // 16K items (~640 KB)
 
 #endif // SPSC_QUEUE_H
@@ -0,0 +1,158 @@
+/**
+ * SequenceWindow.h
+ *
+ * Sliding bitmap of recently seen sequence numbers (duplicate detection)
+ *
+ * Design:
+ * - One bit per sequence in a ring of 64-bit words, indexed by
+ *   (sequence / 64) & mask - no search
+ * - Window = the newest `size` sequences up to the highest seen one
+ *   (rounded up to a power-of-2 number of words; the oldest word slides
+ *   out as a whole, so at least size - 63 are always covered)
+ * - Advancing the highest sequence clears only the words it moves into
+ * - Out-of-order arrivals inside the window are tracked exactly
+ * - Sequences older than the window are reported as TOO_OLD (not
+ *   tracked; the caller decides)
+ *
+ * Performance:
+ * - testAndSet: O(1), ~2-5 ns (one word read-modify-write)
+ * - Advance by k words: O(min(k, words)) clears
+ * - Memory: size / 8 bytes (1M window = 128 KB)
+ *
+ * Thread Safety:
+ * - Single thread (owned by the subscriber thread per stream)
+ *
+ * Usage:
+ *   SequenceWindow window(1000000);
+ *   if (window.testAndSet(seq) == SequenceWindow::Result::DUPLICATE) { drop }
+ */
+
+#ifndef AERON_EXAMPLE_SEQUENCE_WINDOW_H
+#define AERON_EXAMPLE_SEQUENCE_WINDOW_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+class SequenceWindow {
+public:
+    enum class Result {
+        NEW,          // First time seen (now recorded)
+        DUPLICATE,    // Already recorded
+        TOO_OLD       // Below the window (not recorded)
+    };
+
+    explicit SequenceWindow(size_t size = 0) {
+        resize(size);
+    }
+
+    /**
+     * Set the window size and forget all sequences (0 = disabled)
+     */
+    void resize(size_t size) {
+        size_t words = 1;
+        while (words * 64 < size) {
+            words <<= 1;
+        }
+        words_.assign(size > 0 ? words : 0, 0);
+        mask_ = words_.empty() ? 0 : words_.size() - 1;
+        highest_ = 0;
+        empty_ = true;
+    }
+
+    /**
+     * Forget all sequences (keeps the size)
+     */
+    void reset() {
+        std::fill(words_.begin(), words_.end(), 0);
+        highest_ = 0;
+        empty_ = true;
+    }
+
+    bool enabled() const noexcept {
+        return !words_.empty();
+    }
+
+    /**
+     * Tracked window in sequences (power of 2, >= requested size)
+     */
+    size_t capacity() const noexcept {
+        return words_.size() * 64;
+    }
+
+    /**
+     * Record a sequence, reporting whether it was already seen
+     */
+    Result testAndSet(int64_t sequence) noexcept {
+        if (words_.empty()) {
+            return Result::NEW;
+        }
+
+        const uint64_t seq = static_cast<uint64_t>(sequence);
+        const uint64_t word = seq >> 6;
+        const uint64_t bit = 1ULL << (seq & 63);
+
+        if (empty_) {
+            empty_ = false;
+            highest_ = seq;
+            words_[word & mask_] = bit;
+            return Result::NEW;
+        }
+
+        const uint64_t highest_word = highest_ >> 6;
+
+        if (seq > highest_) {
+            // Slide forward: clear the words entered (all of them after a long jump)
+            if (word - highest_word > mask_) {
+                std::fill(words_.begin(), words_.end(), 0);
+            } else {
+                for (uint64_t w = highest_word + 1; w <= word; w++) {
+                    words_[w & mask_] = 0;
+                }
+            }
+            highest_ = seq;
+            words_[word & mask_] |= bit;
+            return Result::NEW;
+        }
+
+        if (highest_word - word > mask_) {
+            return Result::TOO_OLD;
+        }
+
+        uint64_t& slot = words_[word & mask_];
+        if (slot & bit) {
+            return Result::DUPLICATE;
+        }
+        slot |= bit;
+        return Result::NEW;
+    }
+
+    /**
+     * Seen and still inside the window
+     */
+    bool contains(int64_t sequence) const noexcept {
+        if (words_.empty() || empty_) {
+            return false;
+        }
+        const uint64_t seq = static_cast<uint64_t>(sequence);
+        if (seq > highest_ || (highest_ >> 6) - (seq >> 6) > mask_) {
+            return false;
+        }
+        return (words_[(seq >> 6) & mask_] & (1ULL << (seq & 63))) != 0;
+    }
+
+private:
+    std::vector<uint64_t> words_;
+    uint64_t mask_ = 0;
+    uint64_t highest_ = 0;
+    bool empty_ = true;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_SEQUENCE_WINDOW_H
@@ -0,0 +1,321 @@
+/**
+ * ShardRouter.h
+ *
+ * Key → shard routing of message buffer ids over N SPSC queues
+ *
+ * Design:
+ * - Key: header session_id, header publisher_id, or an integer field of
+ *   the payload (offset/width bytes, little-endian); ids are resolved
+ *   through the buffer pool to read it
+ * - Shard = mix(key) scaled to [0, N) (no modulo); same key → same
+ *   queue, so per-key order is kept (one producer, FIFO queues)
+ * - routeBatch(): partitions a poll batch by shard and publishes each
+ *   shard queue once (one release store per shard per batch)
+ * - Hot keys: Space-Saving top-K on every HOT_KEY_SAMPLE-th message
+ *   (approximate counts, reported in the skew report)
+ *
+ * Thread Safety:
+ * - One producer thread per router (subscriber or gap fill agent);
+ *   statistics readable from any thread (relaxed atomics)
+ *
+ * Usage:
+ *   ShardRouter router(config, {&queue0, &queue1, &queue2}, pool);
+ *   size_t enqueued = router.routeBatch(ids, count, accepted);
+ */
+
+#ifndef AERON_EXAMPLE_SHARD_ROUTER_H
+#define AERON_EXAMPLE_SHARD_ROUTER_H
+
+#include "MessageBuffer.h"
+#include "MessageQueue.h"
+#include "SizeClassBufferPool.h"
+#include "StatCounter.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Field the shard is chosen by
+ */
+enum class ShardKey {
+    SESSION_ID,     // MessageHeader::session_id (one publisher session per worker)
+    PUBLISHER_ID,   // MessageHeader::publisher_id
+    PAYLOAD         // Payload field (e.g. instrument / account id)
+};
+
+/**
+ * Worker sharding
+ */
+struct ShardConfig {
+    size_t shards = 1;                // Workers (1 = no sharding)
+    ShardKey key = ShardKey::SESSION_ID;
+    size_t payload_offset = 0;        // ShardKey::PAYLOAD: byte offset in payload
+    size_t payload_width = 8;         // ShardKey::PAYLOAD: 1..8 bytes
+
+    /**
+     * "session" | "publisher" | "payload"
+     * @throws std::invalid_argument unknown name
+     */
+    static ShardKey parseKey(const std::string& name) {
+        if (name == "session") return ShardKey::SESSION_ID;
+        if (name == "publisher") return ShardKey::PUBLISHER_ID;
+        if (name == "payload") return ShardKey::PAYLOAD;
+        throw std::invalid_argument("Unknown shard key: " + name
+                                    + " (session | publisher | payload)");
+    }
+
+    static const char* keyName(ShardKey key) {
+        switch (key) {
+            case ShardKey::PUBLISHER_ID: return "publisher";
+            case ShardKey::PAYLOAD:      return "payload";
+            default:                     return "session";
+        }
+    }
+};
+
+class ShardRouter {
+public:
+    // Hot key tracking: Space-Saving counters, one update per N messages
+    static constexpr size_t HOT_KEY_SLOTS = 16;
+    static constexpr uint64_t HOT_KEY_SAMPLE = 16;
+
+    struct HotKey {
+        uint64_t key;
+        uint64_t count;       // Sampled count × HOT_KEY_SAMPLE (upper bound)
+        size_t shard;
+    };
+
+    /**
+     * @param queues One queue per shard (not owned)
+     * @param pool Pool the routed ids belong to (key lookup)
+     */
+    ShardRouter(const ShardConfig& config, std::vector<MessageBufferQueue*> queues,
+                const MessageBufferPool& pool)
+        : config_(config)
+        , pool_(pool)
+        , queues_(std::move(queues))
+        , routed_(new std::atomic<uint64_t>[queues_.size()])
+        , drops_(new std::atomic<uint64_t>[queues_.size()]) {
+
+        if (queues_.empty()) {
+            throw std::invalid_argument("ShardRouter needs at least one queue");
+        }
+        if (config_.key == ShardKey::PAYLOAD
+            && (config_.payload_width == 0 || config_.payload_width > 8)) {
+            throw std::invalid_argument("Shard payload width must be 1..8 bytes");
+        }
+
+        batches_.resize(queues_.size());
+        indices_.resize(queues_.size());
+        for (size_t i = 0; i < queues_.size(); i++) {
+            routed_[i].store(0, std::memory_order_relaxed);
+            drops_[i].store(0, std::memory_order_relaxed);
+            batches_[i].reserve(MAX_BATCH);
+            indices_[i].reserve(MAX_BATCH);
+        }
+        for (auto& slot : hot_keys_) {
+            slot.key.store(0, std::memory_order_relaxed);
+            slot.count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Non-copyable
+    ShardRouter(const ShardRouter&) = delete;
+    ShardRouter& operator=(const ShardRouter&) = delete;
+
+    size_t shardCount() const noexcept {
+        return queues_.size();
+    }
+
+    MessageBufferQueue& queue(size_t shard) noexcept {
+        return *queues_[shard];
+    }
+
+    /**
+     * Shard key of a message (see ShardKey)
+     */
+    uint64_t keyOf(const MessageBuffer& buf) const noexcept {
+        switch (config_.key) {
+            case ShardKey::PUBLISHER_ID:
+                return buf.header->publisher_id;
+            case ShardKey::PAYLOAD: {
+                // Short payload → missing bytes read as 0
+                uint64_t key = 0;
+                const size_t payload_length = buf.payloadLength();
+                if (config_.payload_offset < payload_length) {
+                    const size_t width = std::min(
+                        config_.payload_width,
+                        payload_length - config_.payload_offset);
+                    std::memcpy(&key, buf.payload + config_.payload_offset, width);
+                }
+                return key;
+            }
+            default:
+                return buf.header->session_id;
+        }
+    }
+
+    /**
+     * Shard of a key: 64-bit mix, then scaled to [0, shards)
+     */
+    size_t shardOf(uint64_t key) const noexcept {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(((key >> 32) * queues_.size()) >> 32);
+    }
+
+    /**
+     * Smallest free slot count over all shard queues (producer thread);
+     * a batch of this many messages fits whatever the keys are
+     * (needed: see MessageBufferQueue::freeSlots)
+     */
+    size_t minFreeSlots(size_t needed = 1) noexcept {
+        size_t free_slots = queues_[0]->freeSlots(needed);
+        for (size_t i = 1; i < queues_.size(); i++) {
+            free_slots = std::min(free_slots, queues_[i]->freeSlots(needed));
+        }
+        return free_slots;
+    }
+
+    /**
+     * Smallest shard queue capacity (largest batch that can ever fit)
+     */
+    size_t minCapacity() const noexcept {
+        size_t capacity = queues_[0]->capacity();
+        for (size_t i = 1; i < queues_.size(); i++) {
+            capacity = std::min(capacity, queues_[i]->capacity());
+        }
+        return capacity;
+    }
+
+    /**
+     * Route a batch (order within each key preserved)
+     *
+     * @param accepted Optional, accepted[i] = ids[i] was enqueued;
+     *                 rejected buffers stay owned by the caller
+     * @return Number of buffers enqueued
+     */
+    size_t routeBatch(const BufferId* ids, size_t count, bool* accepted) noexcept {
+        size_t enqueued = 0;
+
+        for (size_t start = 0; start < count; start += MAX_BATCH) {
+            const size_t end = std::min(count, start + MAX_BATCH);
+
+            for (size_t i = start; i < end; i++) {
+                const uint64_t key = keyOf(pool_.resolve(ids[i]));
+                const size_t shard = shardOf(key);
+                batches_[shard].push_back(ids[i]);
+                indices_[shard].push_back(i);
+                if (++sample_tick_ % HOT_KEY_SAMPLE == 0) {
+                    sampleHotKey(key);
+                }
+            }
+
+            for (size_t shard = 0; shard < queues_.size(); shard++) {
+                auto& batch = batches_[shard];
+                if (batch.empty()) {
+                    continue;
+                }
+                const size_t n = queues_[shard]->enqueueBatch(batch.data(), batch.size());
+                if (accepted) {
+                    for (size_t j = 0; j < batch.size(); j++) {
+                        accepted[indices_[shard][j]] = j < n;
+                    }
+                }
+                bump(routed_[shard], n);
+                if (n < batch.size()) {
+                    bump(drops_[shard], batch.size() - n);
+                }
+                enqueued += n;
+                batch.clear();
+                indices_[shard].clear();
+            }
+        }
+        return enqueued;
+    }
+
+    uint64_t routed(size_t shard) const noexcept {
+        return routed_[shard].load(std::memory_order_relaxed);
+    }
+
+    uint64_t drops(size_t shard) const noexcept {
+        return drops_[shard].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Heaviest sampled keys, largest first
+     */
+    std::vector<HotKey> hotKeys() const {
+        std::vector<HotKey> result;
+        for (const auto& slot : hot_keys_) {
+            const uint64_t count = slot.count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            const uint64_t key = slot.key.load(std::memory_order_relaxed);
+            result.push_back(HotKey{key, count * HOT_KEY_SAMPLE, shardOf(key)});
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const HotKey& a, const HotKey& b) { return a.count > b.count; });
+        return result;
+    }
+
+    const ShardConfig& config() const noexcept {
+        return config_;
+    }
+
+private:
+    // Partition scratch per shard (one poll batch at a time)
+    static constexpr size_t MAX_BATCH = 256;
+
+    struct HotKeySlot {
+        std::atomic<uint64_t> key;
+        std::atomic<uint64_t> count;
+    };
+
+    // Space-Saving: hit → +1, miss → replace the minimum and inherit its count
+    void sampleHotKey(uint64_t key) noexcept {
+        HotKeySlot* min_slot = &hot_keys_[0];
+        for (auto& slot : hot_keys_) {
+            const uint64_t count = slot.count.load(std::memory_order_relaxed);
+            if (count > 0 && slot.key.load(std::memory_order_relaxed) == key) {
+                slot.count.store(count + 1, std::memory_order_relaxed);
+                return;
+            }
+            if (count < min_slot->count.load(std::memory_order_relaxed)) {
+                min_slot = &slot;
+            }
+        }
+        min_slot->key.store(key, std::memory_order_relaxed);
+        min_slot->count.store(min_slot->count.load(std::memory_order_relaxed) + 1,
+                              std::memory_order_relaxed);
+    }
+
+    ShardConfig config_;
+    const MessageBufferPool& pool_;
+    std::vector<MessageBufferQueue*> queues_;
+    std::vector<std::vector<BufferId>> batches_;
+    std::vector<std::vector<size_t>> indices_;
+
+    // Statistics (single writer)
+    std::unique_ptr<std::atomic<uint64_t>[]> routed_;
+    std::unique_ptr<std::atomic<uint64_t>[]> drops_;
+    HotKeySlot hot_keys_[HOT_KEY_SLOTS];
+    uint64_t sample_tick_ = 0;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_SHARD_ROUTER_H
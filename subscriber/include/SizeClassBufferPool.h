@@ -0,0 +1,196 @@
+/**
+ * SizeClassBufferPool.h
+ *
+ * Buffer pool with per-size-class sub-pools (256 B / 4 KB / 64 KB / 1 MB)
+ *
+ * Design:
+ * - One lock-free BufferPool per size class (see BufferPool.h)
+ * - allocate(payload_size) picks the smallest class that fits and
+ *   spills to the next larger class when that class is exhausted
+ * - deallocate() / resolve() dispatch on the size class bits of the BufferId
+ * - Per-thread magazines in every class (flushThreadCache() returns them)
+ *
+ * Why:
+ * - Small ticks no longer pin a whole 4 KB slot
+ * - Reassembled snapshot / reference-data messages (up to 1 MB) fit
+ *   without truncation
+ *
+ * Memory (default PoolSizing, INI [memory] pool_small/medium/large/huge):
+ *   4096 × 256 B + 1024 × 4 KB + 64 × 64 KB + 8 × 1 MB ≈ 18 MB
+ */
+
+#ifndef AERON_EXAMPLE_SIZE_CLASS_BUFFER_POOL_H
+#define AERON_EXAMPLE_SIZE_CLASS_BUFFER_POOL_H
+
+#include "BufferPool.h"
+#include "MemoryArena.h"
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+
+namespace aeron {
+namespace example {
+
+/**
+ * Buffers per size class
+ */
+struct PoolSizing {
+    size_t small = 4096;     // 256 B
+    size_t medium = 1024;    // 4 KB
+    size_t large = 64;       // 64 KB
+    size_t huge = 8;         // 1 MB
+};
+
+class SizeClassBufferPool {
+public:
+    /**
+     * @param sizing Buffers per class (each 1..BufferPool::MAX_POOL_SIZE)
+     * @param arena Backing memory for every class (nullptr = heap)
+     * @throws std::invalid_argument bad class size
+     */
+    explicit SizeClassBufferPool(const PoolSizing& sizing = PoolSizing(),
+                                 MemoryArena* arena = nullptr)
+        : small_(sizing.small, SIZE_CLASS_PAYLOAD[SIZE_CLASS_SMALL], arena)
+        , medium_(sizing.medium, SIZE_CLASS_PAYLOAD[SIZE_CLASS_MEDIUM], arena)
+        , large_(sizing.large, SIZE_CLASS_PAYLOAD[SIZE_CLASS_LARGE], arena)
+        , huge_(sizing.huge, SIZE_CLASS_PAYLOAD[SIZE_CLASS_HUGE], arena)
+        , oversize_requests_(0), spills_(0) {
+        std::cout << "SizeClassBufferPool initialized: "
+                  << capacity() << " buffers in " << SIZE_CLASS_COUNT << " size classes"
+                  << std::endl;
+    }
+
+    // Non-copyable
+    SizeClassBufferPool(const SizeClassBufferPool&) = delete;
+    SizeClassBufferPool& operator=(const SizeClassBufferPool&) = delete;
+
+    /**
+     * Allocate a buffer whose payload slot holds at least payload_size bytes
+     *
+     * @return Buffer, empty if payload_size > MAX_MESSAGE_PAYLOAD_SIZE
+     *         or every fitting class is exhausted
+     */
+    MessageBuffer allocate(size_t payload_size) noexcept {
+        const uint8_t wanted = sizeClassFor(payload_size);
+        if (wanted >= SIZE_CLASS_COUNT) {
+            oversize_requests_.fetch_add(1, std::memory_order_relaxed);
+            return MessageBuffer();
+        }
+
+        for (uint8_t cls = wanted; cls < SIZE_CLASS_COUNT; ++cls) {
+            MessageBuffer buf = pool(cls).allocate();
+            if (buf) {
+                if (cls != wanted) {
+                    spills_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return buf;
+            }
+        }
+        return MessageBuffer();
+    }
+
+    /**
+     * Return a buffer to the sub-pool it came from
+     */
+    void deallocate(BufferId id) noexcept {
+        if (id == INVALID_BUFFER_ID) {
+            return;
+        }
+        const uint8_t cls = bufferIdClass(id);
+        if (cls >= SIZE_CLASS_COUNT) {
+            std::cerr << "ERROR: Buffer with unknown size class "
+                      << static_cast<int>(cls) << std::endl;
+            return;
+        }
+        pool(cls).deallocate(id);
+    }
+
+    void deallocate(const MessageBuffer& buf) noexcept {
+        deallocate(buf.id);
+    }
+
+    /**
+     * Handle of an allocated buffer (worker side of a BufferId queue)
+     */
+    MessageBuffer resolve(BufferId id) const noexcept {
+        return pool(bufferIdClass(id)).resolve(id);
+    }
+
+    /**
+     * Return the calling thread's magazines to the shared free lists
+     * (call when idle or before the thread exits)
+     */
+    void flushThreadCache() noexcept {
+        small_.flushThreadCache();
+        medium_.flushThreadCache();
+        large_.flushThreadCache();
+        huge_.flushThreadCache();
+    }
+
+    size_t available() const noexcept {
+        return small_.available() + medium_.available() +
+               large_.available() + huge_.available();
+    }
+
+    size_t capacity() const noexcept {
+        return small_.capacity() + medium_.capacity() +
+               large_.capacity() + huge_.capacity();
+    }
+
+    double utilization() const noexcept {
+        return static_cast<double>(capacity() - available()) / capacity();
+    }
+
+    uint64_t oversizeRequests() const noexcept {
+        return oversize_requests_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t spills() const noexcept {
+        return spills_.load(std::memory_order_relaxed);
+    }
+
+    void printStatistics() const {
+        std::cout << "\n=== Size-Class Buffer Pool Statistics ===" << std::endl;
+        printClass("256B", small_);
+        printClass("4KB ", medium_);
+        printClass("64KB", large_);
+        printClass("1MB ", huge_);
+        std::cout << "Spills to larger class: " << spills() << std::endl;
+        std::cout << "Oversize requests:      " << oversizeRequests()
+                  << " (> " << MAX_MESSAGE_PAYLOAD_SIZE << " B)" << std::endl;
+        std::cout << "==========================================\n" << std::endl;
+    }
+
+private:
+    BufferPool& pool(uint8_t cls) noexcept {
+        return *pools_[cls];
+    }
+
+    const BufferPool& pool(uint8_t cls) const noexcept {
+        return *pools_[cls];
+    }
+
+    static void printClass(const char* label, const BufferPool& pool) {
+        auto stats = pool.getStatistics();
+        std::cout << label << ": " << stats.current_in_use << " / " << pool.capacity()
+                  << " in use, allocs " << stats.total_allocations
+                  << ", failures " << stats.allocation_failures << std::endl;
+    }
+
+    BufferPool small_;
+    BufferPool medium_;
+    BufferPool large_;
+    BufferPool huge_;
+    BufferPool* const pools_[SIZE_CLASS_COUNT] = {&small_, &medium_, &large_, &huge_};
+
+    alignas(64) std::atomic<uint64_t> oversize_requests_;
+    std::atomic<uint64_t> spills_;
+};
+
+// Subscriber pool (default PoolSizing ~18 MB)
+using MessageBufferPool = SizeClassBufferPool;
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_SIZE_CLASS_BUFFER_POOL_H
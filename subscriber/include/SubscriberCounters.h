@@ -0,0 +1,115 @@
+/**
+ * SubscriberCounters.h
+ *
+ * Publishes subscriber statistics into the shared-memory counters file
+ *
+ * Design:
+ * - Each add*() allocates labelled counters for one component and
+ *   registers an updater that copies its statistics into them
+ * - update() runs the updaters on one thread (the main thread, every
+ *   [counters] update_interval_ms): that thread is the only writer of
+ *   these counters, so every store is a plain relaxed store
+ * - Components keep their own single-writer atomics; the hot path is
+ *   unchanged and the file lags by at most one update interval
+ *
+ * Labels follow "<component>: <statistic>" (aeron_substat --filter
+ * matches on them), e.g. "subscriber: messages received",
+ * "worker 2: messages processed", "shard 2 queue: depth".
+ *
+ * Usage:
+ *   CountersFile file(path, 256);
+ *   SubscriberCounters counters(file);
+ *   counters.addSubscriber(subscriber);
+ *   counters.addWorker("worker", worker);
+ *   counters.addQueue("message queue", *message_queue);
+ *   while (running) { counters.update(); sleep(interval); }
+ */
+
+#ifndef AERON_EXAMPLE_SUBSCRIBER_COUNTERS_H
+#define AERON_EXAMPLE_SUBSCRIBER_COUNTERS_H
+
+#include "CountersFile.h"
+#include "AeronSubscriber.h"
+#include "MessageWorker.h"
+#include "SizeClassBufferPool.h"
+#include "ShardRouter.h"
+#include "ByteRingBuffer.h"
+#include "MessageValidator.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+class SubscriberCounters {
+public:
+    explicit SubscriberCounters(CountersFile& file)
+        : file_(file) {}
+
+    // Non-copyable
+    SubscriberCounters(const SubscriberCounters&) = delete;
+    SubscriberCounters& operator=(const SubscriberCounters&) = delete;
+
+    /**
+     * Receive path, per-stream gap / duplicate counts, gap fill agent
+     * (call after enableGapFill())
+     */
+    void addSubscriber(const AeronSubscriber& subscriber);
+
+    /**
+     * Processed / invalid / duplicate / recovered of one worker
+     * (+ its validator, see addValidator())
+     */
+    void addWorker(const std::string& name, const MessageWorker& worker);
+
+    /**
+     * Validated / checksums verified / invalid per reason
+     * ("<name>: invalid bad checksum", ...)
+     */
+    void addValidator(const std::string& name, const MessageValidator& validator);
+
+    /**
+     * Buffers in use per pool, spills and oversize requests
+     */
+    void addPool(const MessageBufferPool& pool);
+
+    /**
+     * Routed / dropped messages per shard
+     */
+    void addShardRouter(const ShardRouter& router);
+
+    /**
+     * Depth / capacity gauges of a slot queue
+     * (MessageQueue, MessageViewQueue: anything with size() / capacity())
+     */
+    template<typename Queue>
+    void addQueue(const std::string& name, const Queue& queue) {
+        Counter depth = file_.allocate(name + ": depth", CounterType::GAUGE);
+        Counter capacity = file_.allocate(name + ": capacity", CounterType::GAUGE);
+        capacity.set(static_cast<int64_t>(queue.capacity()));
+        updaters_.push_back([&queue, depth]() mutable {
+            depth.set(static_cast<int64_t>(queue.size()));
+        });
+    }
+
+    /**
+     * Used bytes / capacity of the byte ring, records queued
+     */
+    void addRing(const std::string& name, const MessageRingBuffer& ring);
+
+    /**
+     * Copy every registered component's statistics into its counters and
+     * refresh the heartbeat (single caller thread)
+     */
+    void update();
+
+private:
+    CountersFile& file_;
+    std::vector<std::function<void()>> updaters_;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_SUBSCRIBER_COUNTERS_H
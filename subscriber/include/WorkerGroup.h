@@ -0,0 +1,134 @@
+/**
+ * WorkerGroup.h
+ *
+ * Key-sharded group of MessageWorkers (copy mode)
+ *
+ * Design:
+ * - N shards, each = own SPSC MessageQueue + MessageWorker (+ optional
+ *   recovered queue for gap fill output)
+ * - Subscriber thread routes each message by key (ShardRouter): same key
+ *   → same worker, so per-key order is preserved while business handling
+ *   scales across cores
+ * - Gap fill agent gets its own router over the recovered queues (same
+ *   key → same shard as the live messages, SPSC per producer)
+ * - Duplicate detection stays per worker: with session/publisher keys a
+ *   source always lands on one shard
+ *
+ * Statistics:
+ * - Per-shard routed / drops / processed, aggregated totals
+ * - Skew report: max/mean routed per shard + sampled hot keys
+ *
+ * Usage:
+ *   WorkerGroup group(shard_config, pool, stats_queues, true);
+ *   group.setThreadSettings("aeron-worker", worker_thread, {4, 5, 6});
+ *   group.start();
+ *   subscriber.setShardRouter(&group.router());
+ */
+
+#ifndef AERON_EXAMPLE_WORKER_GROUP_H
+#define AERON_EXAMPLE_WORKER_GROUP_H
+
+#include "MessageWorker.h"
+#include "ShardRouter.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aeron {
+namespace example {
+
+class WorkerGroup {
+public:
+    /**
+     * @param config Shard count and key
+     * @param pool Buffer pool shared by all shards
+     * @param stats_queues One monitoring queue per shard (not owned)
+     * @param recovered Create per-shard recovered queues (gap fill)
+     * @param queue_size Slots per shard queue (power of 2)
+     * @param arena Backing memory for the shard queues (nullptr = heap)
+     * @throws std::invalid_argument shards == 0, stats_queues too short
+     *         or bad queue_size
+     */
+    WorkerGroup(const ShardConfig& config,
+                MessageBufferPool& pool,
+                const std::vector<MessageStatsQueue*>& stats_queues,
+                bool recovered,
+                size_t queue_size = MessageQueue::DEFAULT_SIZE,
+                MemoryArena* arena = nullptr);
+
+    ~WorkerGroup();
+
+    // Non-copyable
+    WorkerGroup(const WorkerGroup&) = delete;
+    WorkerGroup& operator=(const WorkerGroup&) = delete;
+
+    /**
+     * Thread names <base>-<shard>, cpus[shard] overrides settings.cpu
+     * (call before start())
+     */
+    void setThreadSettings(const std::string& base_name, const ThreadSettings& settings,
+                           const std::vector<int>& cpus);
+
+    void setIdleStrategy(const IdleStrategyConfig& config);
+    void setValidation(bool enabled);
+    void setMessageHandler(MessageWorker::MessageHandler handler);
+
+    void start();
+    void stop();
+
+    size_t shardCount() const noexcept {
+        return shards_.size();
+    }
+
+    MessageWorker& worker(size_t shard) {
+        return *shards_[shard].worker;
+    }
+
+    // Subscriber thread → shard queues
+    ShardRouter& router() {
+        return *router_;
+    }
+
+    // Gap fill agent → shard recovered queues (nullptr if not created)
+    ShardRouter* recoveredRouter() {
+        return recovered_router_.get();
+    }
+
+    /**
+     * Totals over all shards (averages weighted by messages)
+     */
+    MessageWorker::Statistics getStatistics() const;
+
+    /**
+     * Summed idle statistics of all shard workers
+     */
+    IdleStats getIdleStats() const;
+
+    /**
+     * Queued messages over all shard queues (monitoring)
+     */
+    size_t queuedMessages() const;
+    size_t queueCapacity() const;
+
+    /**
+     * Per-shard table, totals and skew / hot key report
+     */
+    void printStatistics() const;
+
+private:
+    struct Shard {
+        std::unique_ptr<MessageBufferQueue> queue;
+        std::unique_ptr<MessageBufferQueue> recovered_queue;
+        std::unique_ptr<MessageWorker> worker;
+    };
+
+    ShardConfig config_;
+    std::vector<Shard> shards_;
+    std::unique_ptr<ShardRouter> router_;
+    std::unique_ptr<ShardRouter> recovered_router_;
+};
+
+} // namespace example
+} // namespace aeron
+
+#endif // AERON_EXAMPLE_WORKER_GROUP_H
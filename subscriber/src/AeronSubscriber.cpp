@@ -1,36 +1,52 @@
 #include "AeronSubscriber.h"
 #include "AeronConfig.h"
+#include "NanoClock.h"
+#include "concurrent/logbuffer/FrameDescriptor.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <thread>
 #include <chrono>
-
-namespace {
-    // Utility function for timestamp
-    inline int64_t getCurrentTimeNanos() {
-        auto now = std::chrono::system_clock::now().time_since_epoch();
-        return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
-    }
-}
+#include <limits>
 
 namespace aeron {
 namespace example {
 
+namespace FrameDescriptor = aeron::concurrent::logbuffer::FrameDescriptor;
+
 AeronSubscriber::AeronSubscriber()
     : running_(false)
     , message_count_(0)
     , gap_count_(0)
     , last_message_number_(-1)
-    , expected_sequence_(0)
-    , duplicate_buffer_pos_(0)
     , buffer_pool_(nullptr)
     , message_queue_(nullptr)
+    , shard_router_(nullptr)
+    , view_queue_(nullptr)
+    , inplace_peek_position_(0)
+    , inplace_fragment_start_(0)
+    , ring_(nullptr)
+    , pending_count_(0)
+    , queue_budget_(std::numeric_limits<size_t>::max())
+    , backpressure_since_ns_(0)
     , zc_messages_received_(0)
     , zc_buffer_allocation_failures_(0)
     , zc_queue_full_failures_(0)
+    , zc_inplace_aborts_(0)
+    , zc_inplace_term_stalls_(0)
+    , zc_reassembled_messages_(0)
+    , zc_reassembly_drops_(0)
+    , zc_batches_unpacked_(0)
+    , zc_batch_errors_(0)
+    , zc_backpressure_aborts_(0)
+    , zc_backpressure_episodes_(0)
+    , zc_backpressure_total_ns_(0)
+    , zc_backpressure_max_ns_(0)
     , gaps_detected_(0)
-    , gaps_recovered_(0)
     , duplicates_detected_(0) {
+
+    idle_strategy_ = IdleStrategy::create(config_.idle_strategy);
+    initStreams();
 }
 
 AeronSubscriber::AeronSubscriber(const SubscriberConfig& config)
@@ -39,20 +55,75 @@ AeronSubscriber::AeronSubscriber(const SubscriberConfig& config)
     , message_count_(0)
     , gap_count_(0)
     , last_message_number_(-1)
-    , expected_sequence_(0)
-    , duplicate_buffer_pos_(0)
     , buffer_pool_(nullptr)
     , message_queue_(nullptr)
+    , shard_router_(nullptr)
+    , view_queue_(nullptr)
+    , inplace_peek_position_(0)
+    , inplace_fragment_start_(0)
+    , ring_(nullptr)
+    , pending_count_(0)
+    , queue_budget_(std::numeric_limits<size_t>::max())
+    , backpressure_since_ns_(0)
     , zc_messages_received_(0)
     , zc_buffer_allocation_failures_(0)
     , zc_queue_full_failures_(0)
+    , zc_inplace_aborts_(0)
+    , zc_inplace_term_stalls_(0)
+    , zc_reassembled_messages_(0)
+    , zc_reassembly_drops_(0)
+    , zc_batches_unpacked_(0)
+    , zc_batch_errors_(0)
+    , zc_backpressure_aborts_(0)
+    , zc_backpressure_episodes_(0)
+    , zc_backpressure_total_ns_(0)
+    , zc_backpressure_max_ns_(0)
     , gaps_detected_(0)
-    , gaps_recovered_(0)
     , duplicates_detected_(0) {
 
-    // Initialize duplicate detection buffer
-    if (config_.duplicate_check_enabled) {
-        duplicate_buffer_.resize(config_.duplicate_window_size, -1);
+    idle_strategy_ = IdleStrategy::create(config_.idle_strategy);
+    if (config_.validate_on_receive) {
+        validator_ = std::make_unique<MessageValidator>();
+    }
+    initStreams();
+}
+
+/**
+ * Build per-stream state from config_.streams
+ *
+ * No [stream.*] configured → one stream from subscription_channel /
+ * subscription_stream_id (기존 단일 스트림 동작).
+ */
+void AeronSubscriber::initStreams() {
+    std::vector<StreamConfig> configs = config_.streams;
+
+    if (configs.empty()) {
+        StreamConfig single;
+        single.name = "default";
+        single.channel = config_.subscription_channel;
+        single.stream_id = config_.subscription_stream_id;
+        configs.push_back(single);
+    }
+
+    if (configs.size() > std::numeric_limits<uint16_t>::max()) {
+        throw std::invalid_argument("Too many subscription streams");
+    }
+
+    for (size_t i = 0; i < configs.size(); i++) {
+        auto stream = std::make_unique<StreamState>();
+        stream->config = configs[i];
+        stream->index = static_cast<uint16_t>(i);
+
+        if (stream->config.channel.empty()) {
+            stream->config.channel = AeronConfig::SUBSCRIPTION_CHANNEL;
+        }
+
+        // Initialize duplicate detection window (bitmap, size/8 bytes)
+        if (config_.duplicate_check_enabled && config_.duplicate_window_size > 0) {
+            stream->duplicate_window.resize(static_cast<size_t>(config_.duplicate_window_size));
+        }
+
+        streams_.push_back(std::move(stream));
     }
 }
 
@@ -79,20 +150,171 @@ void AeronSubscriber::initializeZeroCopy(MessageBufferPool* pool, MessageBufferQ
     std::cout << "  Message queue capacity: " << queue->capacity() << std::endl;
 }
 
+void AeronSubscriber::initializeInPlace(InPlaceMessageQueue* queue,
+                                        MessageBufferPool* reassembly_pool) {
+    if (!queue) {
+        throw std::invalid_argument("View queue is required for in-place mode");
+    }
+    if (streams_.size() > 1) {
+        // Released position is tracked for a single image
+        throw std::invalid_argument("In-place mode supports a single subscription stream");
+    }
+
+    view_queue_ = queue;
+    buffer_pool_ = reassembly_pool;
+    config_.receive_mode = ReceiveMode::IN_PLACE;
+
+    std::cout << "In-place receive initialized:" << std::endl;
+    std::cout << "  View queue capacity: " << queue->capacity() << std::endl;
+    if (reassembly_pool) {
+        std::cout << "  Reassembly pool capacity: " << reassembly_pool->capacity()
+                  << " (fragmented messages only)" << std::endl;
+    } else {
+        std::cout << "  No buffer pool (fragmented messages are dropped)" << std::endl;
+    }
+}
+
+void AeronSubscriber::initializeRing(MessageRingBuffer* ring,
+                                     MessageBufferPool* reassembly_pool) {
+    if (!ring) {
+        throw std::invalid_argument("Byte ring is required for ring mode");
+    }
+
+    ring_ = ring;
+    buffer_pool_ = reassembly_pool;
+    config_.receive_mode = ReceiveMode::RING;
+
+    std::cout << "Byte ring receive initialized:" << std::endl;
+    std::cout << "  Ring capacity: " << (ring->capacity() / 1024) << " KB, max message "
+              << ring->maxMessageLength() << " bytes" << std::endl;
+    if (reassembly_pool) {
+        std::cout << "  Reassembly pool capacity: " << reassembly_pool->capacity()
+                  << " (fragmented messages only)" << std::endl;
+    } else {
+        std::cout << "  No buffer pool (fragmented messages are dropped)" << std::endl;
+    }
+}
+
+void AeronSubscriber::setStreamQueue(size_t stream_index, MessageBufferQueue* queue,
+                                     MessageBufferQueue* recovered_queue) {
+    if (stream_index >= streams_.size()) {
+        throw std::out_of_range("Stream index out of range: " + std::to_string(stream_index));
+    }
+    streams_[stream_index]->message_queue = queue;
+    streams_[stream_index]->recovered_queue = recovered_queue;
+}
+
+void AeronSubscriber::setShardRouter(ShardRouter* router) {
+    shard_router_ = router;
+}
+
+bool AeronSubscriber::enableGapFill(MessageBufferQueue* recovered_queue,
+                                    ShardRouter* recovered_router) {
+    if (!config_.gap_recovery_enabled || !config_.gap_fill.enabled) {
+        std::cout << "Gap fill: DISABLED" << std::endl;
+        return false;
+    }
+    if (!aeron_ || !buffer_pool_ || (!recovered_queue && !recovered_router)) {
+        std::cerr << "Gap fill requires initialize(), a buffer pool and a recovered queue" << std::endl;
+        return false;
+    }
+
+    GapFillConfig gap_config = config_.gap_fill;
+    if (gap_config.archive_control_channel.empty()) {
+        gap_config.archive_control_channel = config_.archive_control_channel;
+    }
+
+    gap_fill_ = std::make_unique<GapFillAgent>(aeron_, gap_config, *buffer_pool_);
+    for (const auto& stream : streams_) {
+        if (stream->recovered_queue || !recovered_router) {
+            gap_fill_->addStream(stream->config.name, stream->config.channel, stream->config.stream_id,
+                                 stream->recovered_queue ? stream->recovered_queue : recovered_queue);
+        } else {
+            gap_fill_->addStream(stream->config.name, stream->config.channel, stream->config.stream_id,
+                                 nullptr, recovered_router);
+        }
+    }
+    gap_fill_->start();
+    return true;
+}
+
+const GapFillAgent* AeronSubscriber::getGapFillAgent() const {
+    return gap_fill_.get();
+}
+
+size_t AeronSubscriber::streamCount() const {
+    return streams_.size();
+}
+
+std::vector<AeronSubscriber::StreamStats> AeronSubscriber::getStreamStats() const {
+    std::vector<StreamStats> result;
+    result.reserve(streams_.size());
+
+    for (const auto& stream : streams_) {
+        StreamStats stats;
+        stats.name = stream->config.name;
+        stats.channel = stream->config.channel;
+        stats.stream_id = stream->config.stream_id;
+        stats.active = stream->active;
+        stats.messages_received = stream->messages_received.load(std::memory_order_relaxed);
+        stats.gaps_detected = stream->gaps_detected.load(std::memory_order_relaxed);
+        stats.duplicates_detected = stream->duplicates_detected.load(std::memory_order_relaxed);
+        stats.queue_full_failures = stream->queue_full_failures.load(std::memory_order_relaxed);
+        result.push_back(stats);
+    }
+
+    return result;
+}
+
 AeronSubscriber::ZeroCopyStats AeronSubscriber::getZeroCopyStats() const {
     ZeroCopyStats stats;
     stats.messages_received = zc_messages_received_.load(std::memory_order_relaxed);
     stats.buffer_allocation_failures = zc_buffer_allocation_failures_.load(std::memory_order_relaxed);
     stats.queue_full_failures = zc_queue_full_failures_.load(std::memory_order_relaxed);
+    stats.inplace_aborts = zc_inplace_aborts_.load(std::memory_order_relaxed);
+    stats.inplace_term_stalls = zc_inplace_term_stalls_.load(std::memory_order_relaxed);
+    stats.reassembled_messages = zc_reassembled_messages_.load(std::memory_order_relaxed);
+    stats.reassembly_drops = zc_reassembly_drops_.load(std::memory_order_relaxed);
+    stats.batches_unpacked = zc_batches_unpacked_.load(std::memory_order_relaxed);
+    stats.batch_errors = zc_batch_errors_.load(std::memory_order_relaxed);
+    stats.backpressure_aborts = zc_backpressure_aborts_.load(std::memory_order_relaxed);
+    stats.backpressure_episodes = zc_backpressure_episodes_.load(std::memory_order_relaxed);
+    stats.backpressure_total_ns = zc_backpressure_total_ns_.load(std::memory_order_relaxed);
+    stats.backpressure_max_ns = zc_backpressure_max_ns_.load(std::memory_order_relaxed);
     return stats;
 }
 
-void AeronSubscriber::enableCheckpoint(const std::string& file, int flush_interval_sec) {
-    checkpoint_ = std::make_unique<CheckpointManager>(file, flush_interval_sec);
+const MessageValidator* AeronSubscriber::getValidator() const {
+    return validator_.get();
+}
+
+bool AeronSubscriber::passesValidation(const MessageView& view) {
+    return !validator_ || validator_->validate(view) == ValidationResult::OK;
+}
+
+IdleStats AeronSubscriber::getIdleStats() const {
+    return idle_strategy_->stats();
+}
+
+void AeronSubscriber::enableCheckpoint(const std::string& file, int flush_interval_sec,
+                                       const ThreadSettings& thread) {
+    for (auto& stream : streams_) {
+        // 스트림마다 독립 checkpoint (단일 스트림은 기존 파일명 유지)
+        const std::string path = streams_.size() == 1
+            ? file : file + "." + stream->config.name;
+        stream->checkpoint = std::make_unique<CheckpointManager>(path, flush_interval_sec, thread);
+    }
 }
 
 CheckpointManager* AeronSubscriber::getCheckpointManager() const {
-    return checkpoint_.get();
+    return getCheckpointManager(0);
+}
+
+CheckpointManager* AeronSubscriber::getCheckpointManager(size_t stream_index) const {
+    if (stream_index >= streams_.size()) {
+        return nullptr;
+    }
+    return streams_[stream_index]->checkpoint.get();
 }
 
 bool AeronSubscriber::initialize() {
@@ -145,45 +367,66 @@ bool AeronSubscriber::initialize() {
 bool AeronSubscriber::startLive() {
     std::cout << "Starting in LIVE mode..." << std::endl;
 
-    const std::string& channel = config_.subscription_channel.empty()
-        ? AeronConfig::SUBSCRIPTION_CHANNEL
-        : config_.subscription_channel;
+    for (auto& stream : streams_) {
+        // ReplayMerge가 이미 시작된 스트림은 건너뜀 (auto-discovery fallback)
+        if (stream->subscription) {
+            continue;
+        }
+        if (!addSubscription(*stream)) {
+            return false;
+        }
+    }
+
+    std::cout << "Live subscription ready (" << streams_.size() << " stream(s))" << std::endl;
+    return true;
+}
 
-    std::cout << "  Subscription channel: " << channel << std::endl;
-    std::cout << "  Stream ID: " << config_.subscription_stream_id << std::endl;
+bool AeronSubscriber::addSubscription(StreamState& stream) {
+    std::cout << "  [" << stream.config.name << "] Subscription channel: "
+              << stream.config.channel << std::endl;
+    std::cout << "  [" << stream.config.name << "] Stream ID: "
+              << stream.config.stream_id << std::endl;
 
     // Live subscription 생성
     std::int64_t subscription_id = aeron_->addSubscription(
-        channel,
-        config_.subscription_stream_id
+        stream.config.channel,
+        stream.config.stream_id
     );
 
     std::cout << "Subscription added with ID: " << subscription_id << std::endl;
 
     // Subscription이 사용 가능할 때까지 대기
-    subscription_ = aeron_->findSubscription(subscription_id);
-    while (!subscription_) {
+    stream.subscription = aeron_->findSubscription(subscription_id);
+    while (!stream.subscription) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        subscription_ = aeron_->findSubscription(subscription_id);
+        stream.subscription = aeron_->findSubscription(subscription_id);
     }
 
-    std::cout << "Live subscription ready" << std::endl;
+    stream.active = true;
     return true;
 }
 
 bool AeronSubscriber::startReplayMerge(int64_t recordingId, int64_t startPosition) {
+    if (streams_.size() > 1) {
+        std::cout << "NOTE: Explicit recording ID applies to stream '"
+                  << streams_[0]->config.name << "' only" << std::endl;
+    }
+    return startReplayMerge(*streams_[0], recordingId, startPosition);
+}
+
+bool AeronSubscriber::startReplayMerge(StreamState& stream, int64_t recordingId,
+                                       int64_t startPosition) {
     std::cout << "\n========================================" << std::endl;
-    std::cout << "Starting OFFICIAL ReplayMerge API" << std::endl;
+    std::cout << "Starting OFFICIAL ReplayMerge API [" << stream.config.name << "]" << std::endl;
     std::cout << "========================================" << std::endl;
     std::cout << "  Recording ID: " << recordingId << std::endl;
     std::cout << "  Start position: " << startPosition << std::endl;
 
     try {
-        const std::string& live_channel = config_.subscription_channel.empty()
-            ? AeronConfig::SUBSCRIPTION_CHANNEL
-            : config_.subscription_channel;
+        const std::string& live_channel = stream.config.channel;
 
         std::cout << "  Live channel: " << live_channel << std::endl;
+        std::cout << "  Stream ID: " << stream.config.stream_id << std::endl;
         std::cout << "  Replay destination: " << config_.replay_destination << std::endl;
 
         // ========================================
@@ -194,20 +437,20 @@ bool AeronSubscriber::startReplayMerge(int64_t recordingId, int64_t startPositio
         //    This single subscription will receive both replay and live messages
         std::int64_t sub_id = aeron_->addSubscription(
             live_channel,
-            config_.subscription_stream_id
+            stream.config.stream_id
         );
 
-        subscription_ = aeron_->findSubscription(sub_id);
-        while (!subscription_) {
+        stream.subscription = aeron_->findSubscription(sub_id);
+        while (!stream.subscription) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            subscription_ = aeron_->findSubscription(sub_id);
+            stream.subscription = aeron_->findSubscription(sub_id);
         }
         std::cout << "✓ Multi-destination subscription created" << std::endl;
 
         // 2. Create ReplayMerge object
         //    This automatically handles the entire merge lifecycle
-        replay_merge_ = std::make_unique<aeron::archive::client::ReplayMerge>(
-            subscription_,                      // Multi-destination subscription
+        stream.replay_merge = std::make_unique<aeron::archive::client::ReplayMerge>(
+            stream.subscription,                // Multi-destination subscription
             archive_,                           // Archive client
             live_channel,                       // Replay channel (same as live)
             config_.replay_destination,         // Replay destination (ephemeral port)
@@ -217,6 +460,7 @@ bool AeronSubscriber::startReplayMerge(int64_t recordingId, int64_t startPositio
             aeron::currentTimeMillis,           // Clock function for progress tracking
             5000                                // Merge progress timeout (5 seconds)
         );
+        stream.active = true;
 
         std::cout << "✓ ReplayMerge object created" << std::endl;
         std::cout << "\n========================================" << std::endl;
@@ -307,44 +551,63 @@ int64_t AeronSubscriber::getRecordingStopPosition(int64_t recordingId) {
 bool AeronSubscriber::startReplayMergeAuto(int64_t startPosition) {
     std::cout << "Starting REPLAY MERGE with AUTO-DISCOVERY..." << std::endl;
 
-    try {
-        // 1. Get channel from config
-        const std::string& channel = config_.subscription_channel.empty()
-            ? AeronConfig::SUBSCRIPTION_CHANNEL
-            : config_.subscription_channel;
+    size_t started = 0;
 
-        // 2. Auto-discover latest recording
-        int64_t recordingId = findLatestRecording(channel, config_.subscription_stream_id);
+    for (auto& stream : streams_) {
+        try {
+            // 1. Auto-discover latest recording for this stream
+            const std::string& channel = stream->config.channel;
+            int64_t recordingId = findLatestRecording(channel, stream->config.stream_id);
 
-        if (recordingId < 0) {
-            std::cerr << "Auto-discovery failed: No recording found" << std::endl;
-            return false;
-        }
+            if (recordingId < 0) {
+                std::cerr << "Auto-discovery failed [" << stream->config.name
+                          << "]: No recording found" << std::endl;
+                continue;
+            }
 
-        // 3. Get recording information
-        int64_t stopPosition = getRecordingStopPosition(recordingId);
+            // 2. Resume from this stream's own checkpoint when available
+            int64_t resumePosition = startPosition;
+            if (stream->checkpoint && stream->checkpoint->getLastPosition() > 0) {
+                resumePosition = stream->checkpoint->getLastPosition();
+            }
 
-        std::cout << "\n========================================" << std::endl;
-        std::cout << "Auto-discovered Recording" << std::endl;
-        std::cout << "========================================" << std::endl;
-        std::cout << "Recording ID: " << recordingId << std::endl;
-        std::cout << "Channel: " << channel << std::endl;
-        std::cout << "Stream ID: " << config_.subscription_stream_id << std::endl;
-        std::cout << "Start position: " << startPosition << std::endl;
+            // 3. Get recording information
+            int64_t stopPosition = getRecordingStopPosition(recordingId);
 
-        if (stopPosition >= 0) {
-            std::cout << "Current position: " << stopPosition << std::endl;
-            std::cout << "Messages to replay: ~" << ((stopPosition - startPosition) / 100) << std::endl;
-        }
-        std::cout << "========================================\n" << std::endl;
+            std::cout << "\n========================================" << std::endl;
+            std::cout << "Auto-discovered Recording [" << stream->config.name << "]" << std::endl;
+            std::cout << "========================================" << std::endl;
+            std::cout << "Recording ID: " << recordingId << std::endl;
+            std::cout << "Channel: " << channel << std::endl;
+            std::cout << "Stream ID: " << stream->config.stream_id << std::endl;
+            std::cout << "Start position: " << resumePosition << std::endl;
 
-        // 4. Start replay merge with discovered recording
-        return startReplayMerge(recordingId, startPosition);
+            if (stopPosition >= 0) {
+                std::cout << "Current position: " << stopPosition << std::endl;
+                std::cout << "Messages to replay: ~" << ((stopPosition - resumePosition) / 100) << std::endl;
+            }
+            std::cout << "========================================\n" << std::endl;
 
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to start auto-discovery ReplayMerge: " << e.what() << std::endl;
+            // 4. Start replay merge with discovered recording
+            if (startReplayMerge(*stream, recordingId, resumePosition)) {
+                started++;
+            }
+
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to start auto-discovery ReplayMerge ["
+                      << stream->config.name << "]: " << e.what() << std::endl;
+        }
+    }
+
+    if (started == 0) {
         return false;
     }
+
+    // 레코딩이 없는 스트림은 live로 시작
+    if (started < streams_.size()) {
+        return startLive();
+    }
+    return true;
 }
 
 int64_t AeronSubscriber::extractMessageNumber(const std::string& message) {
@@ -367,217 +630,1175 @@ int64_t AeronSubscriber::extractMessageNumber(const std::string& message) {
  * Fast path for zero-copy mode
  *
  * Performance target: < 1 μs
- * - Allocate buffer from pool (~100ns)
- * - memcpy Aeron buffer (~500ns for 4KB)
- * - Enqueue buffer pointer (~50ns)
+ * - Allocate buffer of the fitting size class (~100ns)
+ * - memcpy Aeron buffer (~500ns for 4KB, ~30ns for a 256B tick)
+ * - Append to poll batch (enqueued once per poll, see flushPendingBuffers)
  * Total: ~650ns
+ *
+ * Fragmented messages (> MTU) are reassembled straight into one pool
+ * buffer and continue here once END_FRAG arrives.
+ *
+ * OverflowPolicy::BACKPRESSURE: pool exhaustion returns false before
+ * anything is recorded, the caller aborts the controlled poll and the
+ * same fragment is delivered again on the next poll.
  */
-void AeronSubscriber::handleMessageFastPath(
+bool AeronSubscriber::handleMessageFastPath(
+    StreamState& stream,
     const uint8_t* buffer,
     size_t length,
-    int64_t position) {
+    int64_t position,
+    uint8_t flags,
+    int32_t session_id) {
 
-    // 1. Record receive timestamp IMMEDIATELY (~10ns)
-    int64_t recv_timestamp = getCurrentTimeNanos();
+    const bool lossless = config_.overflow_policy == OverflowPolicy::BACKPRESSURE;
 
-    // 2. Allocate buffer from pool (~100ns)
-    MessageBuffer* msg_buf = buffer_pool_->allocate();
+    // 1. Record receive timestamp IMMEDIATELY (~10ns, TSC)
+    int64_t recv_timestamp = NanoClock::nanoTime();
 
-    if (!msg_buf) {
-        // Pool exhausted - drop message
-        zc_buffer_allocation_failures_.fetch_add(1, std::memory_order_relaxed);
-        return;
-    }
+    MessageBuffer msg_buf;
 
-    // 3. Zero-copy: memcpy Aeron buffer to our buffer (~500ns for 4KB)
-    msg_buf->copyFromAeron(buffer, length);
-    msg_buf->header.recv_time_ns = recv_timestamp;
+    if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED) {
+        if (isBatchEnvelope(buffer, length)) {
+            return handleBatchFastPath(stream, buffer, length, position, session_id, recv_timestamp);
+        }
 
-    // 4. Simple gap detection & recovery (온프레미스 최적화) (~50ns)
-    int64_t message_number = msg_buf->header.sequence_number;
+        // 2. Allocate buffer of the fitting size class (~100ns)
+        const size_t payload_size = length > sizeof(MessageHeader)
+            ? length - sizeof(MessageHeader) : 0;
+        msg_buf = buffer_pool_->allocate(payload_size);
 
-    if (config_.gap_recovery_enabled && checkForGaps(message_number)) {
-        gaps_detected_.fetch_add(1, std::memory_order_relaxed);
-        // Trigger immediate gap recovery in background (non-blocking)
-        triggerImmediateGapRecovery(expected_sequence_, message_number - 1);
+        if (!msg_buf) {
+            // Larger than the largest class can never fit - always dropped
+            if (lossless && sizeClassFor(payload_size) < SIZE_CLASS_COUNT) {
+                return false;
+            }
+            // Pool exhausted (or larger than the largest class) - drop message
+            zc_buffer_allocation_failures_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // 3. Zero-copy: memcpy Aeron buffer to our buffer (~500ns for 4KB)
+        msg_buf.copyFromAeron(buffer, length);
+    } else {
+        // 2-3. Fragment reassembly (message incomplete until END_FRAG)
+        bool out_of_buffers = false;
+        msg_buf = reassembleFragment(stream, buffer, length, flags, session_id,
+                                     lossless ? &out_of_buffers : nullptr);
+        if (!msg_buf) {
+            return !out_of_buffers;
+        }
     }
 
-    // 5. Simple duplicate check (~20ns)
-    if (config_.duplicate_check_enabled && isDuplicate(message_number)) {
-        duplicates_detected_.fetch_add(1, std::memory_order_relaxed);
+    msg_buf.header->recv_time_ns = recv_timestamp;
+    msg_buf.descriptor->stream_index = stream.index;
+
+    // Receive-thread validation: a corrupt header never reaches sequence tracking
+    if (!passesValidation(makeView(msg_buf))) {
+        buffer_pool_->deallocate(msg_buf);
+        return true;
+    }
+
+    // 4-6. Gap detection, duplicate check, tracking update (~80ns)
+    if (!acceptSequence(stream, msg_buf.header->sequence_number, position, session_id)) {
         // Drop duplicate message
         buffer_pool_->deallocate(msg_buf);
+        return true;
+    }
+
+    // 7. Append to poll batch (enqueued to worker after poll() returns)
+    appendPendingBuffer(stream, msg_buf, position);
+
+    // Fast path complete - return to Aeron polling loop
+    return true;
+}
+
+void AeronSubscriber::appendPendingBuffer(StreamState& stream, const MessageBuffer& msg_buf,
+                                          int64_t position) {
+    if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+        flushPendingBuffers(stream);
+    }
+    pending_buffers_[pending_count_] = msg_buf.id;
+    pending_sequences_[pending_count_] = static_cast<int64_t>(msg_buf.header->sequence_number);
+    pending_positions_[pending_count_] = position;
+    pending_count_++;
+}
+
+/**
+ * MSG_BATCH envelope, copy mode
+ *
+ * - Every inner message gets its own pool buffer first; only then are they
+ *   validated / sequence-tracked one by one (same as a single message)
+ * - BACKPRESSURE: queue budget for all inner messages is checked up front
+ *   (reserveQueueBudget) and an empty pool frees what was taken, so an
+ *   aborted envelope leaves nothing recorded and is delivered again whole
+ * - Checkpoint position of every inner message is the envelope end
+ * - Malformed envelope: dropped whole (batch_errors)
+ */
+bool AeronSubscriber::handleBatchFastPath(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    int64_t position,
+    int32_t session_id,
+    int64_t recv_timestamp) {
+
+    const bool lossless = config_.overflow_policy == OverflowPolicy::BACKPRESSURE;
+    const uint32_t count = batchMessageCount(buffer, length);
+    if (count == 0) {
+        zc_batch_errors_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (lossless && !reserveQueueBudget(stream, pending_count_ + count)) {
+        return false;
+    }
+
+    bool out_of_buffers = false;
+    batch_buffers_.clear();
+    forEachBatchMessage(buffer, length, [&](const uint8_t* message, size_t message_length) {
+        if (out_of_buffers) {
+            return;
+        }
+        const size_t payload_size = message_length - sizeof(MessageHeader);
+        MessageBuffer msg_buf = buffer_pool_->allocate(payload_size);
+        if (!msg_buf) {
+            if (lossless && sizeClassFor(payload_size) < SIZE_CLASS_COUNT) {
+                out_of_buffers = true;
+                return;
+            }
+            zc_buffer_allocation_failures_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        msg_buf.copyFromAeron(message, message_length);
+        batch_buffers_.push_back(msg_buf);
+    });
+
+    if (out_of_buffers) {
+        for (const MessageBuffer& msg_buf : batch_buffers_) {
+            buffer_pool_->deallocate(msg_buf);
+        }
+        batch_buffers_.clear();
+        return false;
+    }
+
+    zc_batches_unpacked_.fetch_add(1, std::memory_order_relaxed);
+
+    for (MessageBuffer& msg_buf : batch_buffers_) {
+        msg_buf.header->recv_time_ns = recv_timestamp;
+        msg_buf.descriptor->stream_index = stream.index;
+
+        if (!passesValidation(makeView(msg_buf)) ||
+            !acceptSequence(stream, msg_buf.header->sequence_number, position, session_id)) {
+            buffer_pool_->deallocate(msg_buf);
+            continue;
+        }
+        appendPendingBuffer(stream, msg_buf, position);
+    }
+    batch_buffers_.clear();
+    return true;
+}
+
+/**
+ * queue_budget_ is read once per poll from the cached consumer position;
+ * an envelope needs room for all of its messages at once, so a short
+ * budget is refreshed before giving up (otherwise a stale cache could
+ * abort the same envelope forever).
+ *
+ * An envelope larger than the queue itself can never fit: it takes the
+ * drop path (messages that do not fit are counted as queue-full drops).
+ */
+bool AeronSubscriber::reserveQueueBudget(StreamState& stream, size_t needed) {
+    if (needed <= queue_budget_) {
+        return true;
+    }
+
+    size_t capacity;
+    if (!stream.message_queue && shard_router_) {
+        capacity = shard_router_->minCapacity();
+        queue_budget_ = shard_router_->minFreeSlots(needed);
+    } else {
+        MessageBufferQueue* queue = stream.message_queue ? stream.message_queue : message_queue_;
+        capacity = queue->capacity();
+        queue_budget_ = queue->freeSlots(needed);
+    }
+    return needed <= queue_budget_ || needed > capacity;
+}
+
+/**
+ * Hand the current poll batch to the worker (one tail publish)
+ *
+ * Buffers that do not fit are returned to the pool and counted as
+ * queue-full drops. Checkpoint uses the copied sequence/position since
+ * the worker may already own (and recycle) the enqueued buffers.
+ * Goes to the stream's dedicated queue when one is set, otherwise to the
+ * shard queues when a router is set (one publish per shard).
+ */
+void AeronSubscriber::flushPendingBuffers(StreamState& stream) {
+    if (ring_) {
+        flushPendingRecords(stream);
+        return;
+    }
+    if (pending_count_ == 0) {
         return;
     }
 
-    // 6. Update tracking (~10ns)
-    expected_sequence_ = message_number + 1;
-    if (config_.duplicate_check_enabled) {
-        addToDecluplicationBuffer(message_number);
+    const size_t count = pending_count_;
+    pending_count_ = 0;
+
+    // BACKPRESSURE: a mid-poll flush (batch envelopes) uses up queue room
+    if (queue_budget_ != std::numeric_limits<size_t>::max()) {
+        queue_budget_ = queue_budget_ > count ? queue_budget_ - count : 0;
+    }
+
+    // 8. Enqueue batch to worker thread(s) (~50ns per batch)
+    size_t enqueued = 0;
+    size_t last = 0;   // Index of the last enqueued message (checkpoint)
+
+    if (!stream.message_queue && shard_router_) {
+        enqueued = shard_router_->routeBatch(pending_buffers_, count, pending_accepted_);
+        for (size_t i = 0; i < count; i++) {
+            if (pending_accepted_[i]) {
+                last = i;
+            } else {
+                buffer_pool_->deallocate(pending_buffers_[i]);
+            }
+        }
+    } else {
+        MessageBufferQueue* queue = stream.message_queue ? stream.message_queue : message_queue_;
+        enqueued = queue->enqueueBatch(pending_buffers_, count);
+        // Queue full - return remaining buffers to pool and drop messages
+        for (size_t i = enqueued; i < count; i++) {
+            buffer_pool_->deallocate(pending_buffers_[i]);
+        }
+        last = enqueued > 0 ? enqueued - 1 : 0;
+    }
+
+    if (enqueued < count) {
+        zc_queue_full_failures_.fetch_add(count - enqueued, std::memory_order_relaxed);
+        stream.queue_full_failures.fetch_add(count - enqueued, std::memory_order_relaxed);
+    }
+
+    if (enqueued == 0) {
+        return;
+    }
+
+    // 9. Update statistics (once per batch)
+    zc_messages_received_.fetch_add(enqueued, std::memory_order_relaxed);
+    const uint64_t received =
+        stream.messages_received.fetch_add(enqueued, std::memory_order_relaxed) + enqueued;
+
+    // 10. Update checkpoint with last enqueued message (~10ns)
+    if (stream.checkpoint) {
+        stream.checkpoint->update(
+            pending_sequences_[last],
+            pending_positions_[last],
+            static_cast<int64_t>(received)
+        );
+    }
+}
+
+/**
+ * Byte ring path (ReceiveMode::RING)
+ *
+ * - Unfragmented: sequence read straight from the fragment, then one
+ *   memcpy into a ring record (no allocation, no pointer enqueue)
+ * - Fragmented: reassembled in the pool, copied into the ring at
+ *   END_FRAG and the pool buffer is returned immediately
+ * - Records become visible to the worker once per poll (flushPendingRecords)
+ * - BACKPRESSURE: ring room is checked before anything is consumed
+ *   (END_FRAG checks room for the whole reassembled message)
+ */
+bool AeronSubscriber::handleMessageRing(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    int64_t position,
+    uint8_t flags,
+    int32_t session_id) {
+
+    const bool lossless = config_.overflow_policy == OverflowPolicy::BACKPRESSURE;
+    const int64_t recv_timestamp = NanoClock::nanoTime();
+
+    if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED) {
+        if (isBatchEnvelope(buffer, length)) {
+            return handleBatchRing(stream, buffer, length, position, session_id, recv_timestamp);
+        }
+
+        // Larger than maxMessageLength() can never fit - always dropped
+        if (lossless && length <= ring_->maxMessageLength() && !ring_->canClaim(length)) {
+            return false;
+        }
+
+        if (!passesValidation(MessageView::fromAeron(buffer, length, recv_timestamp, position))) {
+            return true;
+        }
+
+        const bool has_header = length >= sizeof(MessageHeader);
+        int64_t sequence = 0;
+        if (has_header) {
+            sequence = static_cast<int64_t>(
+                reinterpret_cast<const MessageHeader*>(buffer)->sequence_number);
+            if (!acceptSequence(stream, sequence, position, session_id)) {
+                return true;
+            }
+        }
+
+        uint8_t* record = ring_->claim(length, stream.index, recv_timestamp);
+        if (!record) {
+            zc_queue_full_failures_.fetch_add(1, std::memory_order_relaxed);
+            stream.queue_full_failures.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        std::memcpy(record, buffer, length);
+
+        // Short fragment: worker rejects it (no header), nothing to checkpoint
+        if (!has_header) {
+            return true;
+        }
+        reinterpret_cast<MessageHeader*>(record)->recv_time_ns = recv_timestamp;
+
+        if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+            flushPendingRecords(stream);
+        }
+        pending_sequences_[pending_count_] = sequence;
+        pending_positions_[pending_count_] = position;
+        pending_count_++;
+        return true;
+    }
+
+    if (lossless && (flags & FrameDescriptor::END_FRAG)) {
+        // Completing the message consumes every fragment - make sure it fits first
+        auto it = stream.reassembly.find(session_id);
+        if (it != stream.reassembly.end() && it->second) {
+            const size_t total = it->second.wireSize() + length;
+            if (total <= ring_->maxMessageLength() && !ring_->canClaim(total)) {
+                return false;
+            }
+        }
+    }
+
+    bool out_of_buffers = false;
+    MessageBuffer msg_buf = reassembleFragment(stream, buffer, length, flags, session_id,
+                                               lossless ? &out_of_buffers : nullptr);
+    if (!msg_buf) {
+        return !out_of_buffers;
     }
 
-    // 7. Enqueue to worker thread (~50ns)
-    if (!message_queue_->enqueue(msg_buf)) {
-        // Queue full - return buffer to pool and drop message
+    if (!passesValidation(makeView(msg_buf))) {
         buffer_pool_->deallocate(msg_buf);
+        return true;
+    }
+
+    const int64_t sequence = static_cast<int64_t>(msg_buf.header->sequence_number);
+    if (!acceptSequence(stream, sequence, position, session_id)) {
+        buffer_pool_->deallocate(msg_buf);
+        return true;
+    }
+
+    uint8_t* record = ring_->claim(msg_buf.wireSize(), stream.index, recv_timestamp);
+    if (!record) {
         zc_queue_full_failures_.fetch_add(1, std::memory_order_relaxed);
+        stream.queue_full_failures.fetch_add(1, std::memory_order_relaxed);
+        buffer_pool_->deallocate(msg_buf);
+        return true;
+    }
+
+    msg_buf.header->recv_time_ns = recv_timestamp;
+    std::memcpy(record, msg_buf.header, sizeof(MessageHeader));
+    std::memcpy(record + sizeof(MessageHeader), msg_buf.payload, msg_buf.payloadLength());
+    buffer_pool_->deallocate(msg_buf);
+
+    if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+        flushPendingRecords(stream);
+    }
+    pending_sequences_[pending_count_] = sequence;
+    pending_positions_[pending_count_] = position;
+    pending_count_++;
+    return true;
+}
+
+/**
+ * MSG_BATCH envelope, ring mode
+ *
+ * Each inner message becomes its own ring record (one memcpy, no pool).
+ * BACKPRESSURE: room for the envelope bytes plus one record header and
+ * alignment per inner message is checked before anything is consumed.
+ */
+bool AeronSubscriber::handleBatchRing(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    int64_t position,
+    int32_t session_id,
+    int64_t recv_timestamp) {
+
+    const uint32_t count = batchMessageCount(buffer, length);
+    if (count == 0) {
+        zc_batch_errors_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (config_.overflow_policy == OverflowPolicy::BACKPRESSURE) {
+        const size_t required = length +
+            count * (MessageRingBuffer::HEADER_LENGTH + MessageRingBuffer::RECORD_ALIGNMENT);
+        if (required <= ring_->maxMessageLength() && !ring_->canClaim(required)) {
+            return false;
+        }
+    }
+
+    zc_batches_unpacked_.fetch_add(1, std::memory_order_relaxed);
+
+    forEachBatchMessage(buffer, length, [&](const uint8_t* message, size_t message_length) {
+        if (!passesValidation(MessageView::fromAeron(message, message_length, recv_timestamp, position))) {
+            return;
+        }
+
+        const int64_t sequence = static_cast<int64_t>(
+            reinterpret_cast<const MessageHeader*>(message)->sequence_number);
+        if (!acceptSequence(stream, sequence, position, session_id)) {
+            return;
+        }
+
+        uint8_t* record = ring_->claim(message_length, stream.index, recv_timestamp);
+        if (!record) {
+            zc_queue_full_failures_.fetch_add(1, std::memory_order_relaxed);
+            stream.queue_full_failures.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::memcpy(record, message, message_length);
+        reinterpret_cast<MessageHeader*>(record)->recv_time_ns = recv_timestamp;
+
+        if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+            flushPendingRecords(stream);
+        }
+        pending_sequences_[pending_count_] = sequence;
+        pending_positions_[pending_count_] = position;
+        pending_count_++;
+    });
+    return true;
+}
+
+/**
+ * Publish the records of the current poll to the worker (one tail
+ * release store) and checkpoint the last one
+ */
+void AeronSubscriber::flushPendingRecords(StreamState& stream) {
+    ring_->publish();
+
+    if (pending_count_ == 0) {
         return;
     }
 
-    // 8. Update statistics
-    zc_messages_received_.fetch_add(1, std::memory_order_relaxed);
+    const size_t count = pending_count_;
+    pending_count_ = 0;
 
-    // 9. Update checkpoint (if enabled) (~10ns)
-    if (checkpoint_) {
-        checkpoint_->update(
-            msg_buf->header.sequence_number,
-            position,
-            zc_messages_received_.load(std::memory_order_relaxed)
+    zc_messages_received_.fetch_add(count, std::memory_order_relaxed);
+    const uint64_t received =
+        stream.messages_received.fetch_add(count, std::memory_order_relaxed) + count;
+
+    if (stream.checkpoint) {
+        stream.checkpoint->update(
+            pending_sequences_[count - 1],
+            pending_positions_[count - 1],
+            static_cast<int64_t>(received)
         );
     }
+}
 
-    // Total time: ~670ns (checkpoint adds ~10ns)
-    // Fast path complete - return to Aeron polling loop
+/**
+ * In-place path (ReceiveMode::IN_PLACE)
+ *
+ * Called from controlledPeek, so the fragment is NOT consumed yet:
+ * - No pool allocation, no memcpy (view into the term buffer)
+ * - Caller guarantees the view queue has room for the pending batch
+ * - Duplicates are still enqueued (marked discard) so that the worker
+ *   releases their position in order
+ * - BACKPRESSURE: no reassembly buffer → false (peek stops here)
+ */
+bool AeronSubscriber::handleMessageInPlace(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    int64_t position,
+    uint8_t flags,
+    int32_t session_id) {
+
+    const int64_t recv_timestamp = NanoClock::nanoTime();
+    MessageView view;
+
+    if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED) {
+        if (isBatchEnvelope(buffer, length)) {
+            return handleBatchInPlace(stream, buffer, length, position, session_id, recv_timestamp);
+        }
+        view = MessageView::fromAeron(buffer, length, recv_timestamp, position);
+    } else {
+        // Fragments are not contiguous in the term buffer - reassemble a copy
+        bool out_of_buffers = false;
+        MessageBuffer msg_buf = reassembleFragment(
+            stream, buffer, length, flags, session_id,
+            config_.overflow_policy == OverflowPolicy::BACKPRESSURE ? &out_of_buffers : nullptr);
+        if (!msg_buf) {
+            return !out_of_buffers;
+        }
+        msg_buf.header->recv_time_ns = recv_timestamp;
+        view = makeView(msg_buf);
+        view.position = position;
+        view.owned_buffer = msg_buf.id;
+    }
+    view.stream_index = stream.index;
+
+    // Invalid messages are still enqueued (discard) so their position is released in order
+    if (!passesValidation(view)) {
+        view.discard = true;
+    } else if (view.header && !acceptSequence(stream, view.header->sequence_number, position, session_id)) {
+        view.discard = true;
+    }
+
+    // A batch envelope earlier in this peek may have filled the batch
+    if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+        flushPendingViews(stream);
+    }
+    pending_views_[pending_count_++] = view;
+    return true;
+}
+
+/**
+ * MSG_BATCH envelope, in-place mode
+ *
+ * One view per inner message, all pointing into the same term buffer
+ * fragment. The worker releases the position of the last view it drained,
+ * so only the last inner view carries the envelope end; the others carry
+ * the fragment start (nothing of the envelope is released early).
+ * Sequence tracking / checkpoint still use the envelope end position.
+ *
+ * - View queue room for every inner message is checked up front, with a
+ *   fresh consumer position if the cached budget is short
+ *   (false: peek stops here, same as a full queue)
+ * - Malformed envelope, or more inner messages than the view queue can
+ *   ever hold: one discard view (position released in order)
+ */
+bool AeronSubscriber::handleBatchInPlace(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    int64_t position,
+    int32_t session_id,
+    int64_t recv_timestamp) {
+
+    const uint32_t count = batchMessageCount(buffer, length);
+
+    // Malformed, or more messages than the view queue can ever hold
+    if (count == 0 || count > view_queue_->capacity()) {
+        zc_batch_errors_.fetch_add(1, std::memory_order_relaxed);
+        MessageView view = MessageView::fromAeron(buffer, length, recv_timestamp, position);
+        view.stream_index = stream.index;
+        view.discard = true;
+        if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+            flushPendingViews(stream);
+        }
+        pending_views_[pending_count_++] = view;
+        return true;
+    }
+
+    // Budget from the cached consumer position may be stale: refresh before giving up
+    if (pending_count_ + count > queue_budget_) {
+        queue_budget_ = view_queue_->freeSlots(pending_count_ + count);
+        if (pending_count_ + count > queue_budget_) {
+            return false;
+        }
+    }
+
+    zc_batches_unpacked_.fetch_add(1, std::memory_order_relaxed);
+
+    uint32_t index = 0;
+    forEachBatchMessage(buffer, length, [&](const uint8_t* message, size_t message_length) {
+        const bool last = ++index == count;
+        MessageView view = MessageView::fromAeron(
+            message, message_length, recv_timestamp, last ? position : inplace_fragment_start_);
+        view.stream_index = stream.index;
+
+        if (!passesValidation(view) ||
+            !acceptSequence(stream, view.header->sequence_number, position, session_id)) {
+            view.discard = true;
+        }
+
+        if (pending_count_ == POLL_FRAGMENT_LIMIT) {
+            flushPendingViews(stream);
+        }
+        pending_views_[pending_count_++] = view;
+    });
+    return true;
+}
+
+/**
+ * Fragment reassembly into a pooled buffer
+ *
+ * - BEGIN_FRAG: MessageHeader::message_length gives the full size, so the
+ *   size class is chosen once and later fragments append with no realloc
+ * - Middle: append
+ * - END_FRAG: message complete, buffer handed back to the caller
+ *
+ * Aeron delivers the fragments of one message contiguously per image,
+ * so one in-progress buffer per (stream, session) is enough.
+ *
+ * out_of_buffers (backpressure mode): an empty pool at BEGIN_FRAG is
+ * reported instead of dropping the message; nothing is consumed and the
+ * fragment is retried on the next poll.
+ */
+MessageBuffer AeronSubscriber::reassembleFragment(
+    StreamState& stream,
+    const uint8_t* buffer,
+    size_t length,
+    uint8_t flags,
+    int32_t session_id,
+    bool* out_of_buffers) {
+
+    MessageBuffer& in_progress = stream.reassembly[session_id];
+
+    if (flags & FrameDescriptor::BEGIN_FRAG) {
+        if (in_progress) {
+            // Previous message never saw END_FRAG
+            buffer_pool_->deallocate(in_progress);
+            in_progress = MessageBuffer();
+            zc_reassembly_drops_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (!buffer_pool_ || length < sizeof(MessageHeader)) {
+            zc_reassembly_drops_.fetch_add(1, std::memory_order_relaxed);
+            return MessageBuffer();
+        }
+
+        const auto* header = reinterpret_cast<const MessageHeader*>(buffer);
+        const size_t total_payload = header->message_length > sizeof(MessageHeader)
+            ? header->message_length - sizeof(MessageHeader) : 0;
+
+        MessageBuffer msg_buf = buffer_pool_->allocate(total_payload);
+        if (!msg_buf) {
+            if (out_of_buffers && sizeClassFor(total_payload) < SIZE_CLASS_COUNT) {
+                *out_of_buffers = true;
+                return MessageBuffer();
+            }
+            zc_buffer_allocation_failures_.fetch_add(1, std::memory_order_relaxed);
+            zc_reassembly_drops_.fetch_add(1, std::memory_order_relaxed);
+            return MessageBuffer();
+        }
+
+        msg_buf.copyFromAeron(buffer, length);
+        in_progress = msg_buf;
+        return MessageBuffer();
+    }
+
+    if (!in_progress) {
+        // BEGIN_FRAG was dropped (already counted) or joined mid-message
+        return MessageBuffer();
+    }
+
+    if (!in_progress.appendPayload(buffer, length)) {
+        // Longer than message_length announced
+        buffer_pool_->deallocate(in_progress);
+        in_progress = MessageBuffer();
+        zc_reassembly_drops_.fetch_add(1, std::memory_order_relaxed);
+        return MessageBuffer();
+    }
+
+    if (flags & FrameDescriptor::END_FRAG) {
+        MessageBuffer complete = in_progress;
+        in_progress = MessageBuffer();
+        zc_reassembled_messages_.fetch_add(1, std::memory_order_relaxed);
+        return complete;
+    }
+
+    return MessageBuffer();
+}
+
+void AeronSubscriber::releaseReassemblyBuffers() {
+    for (auto& stream : streams_) {
+        for (auto& entry : stream->reassembly) {
+            if (entry.second) {
+                buffer_pool_->deallocate(entry.second);
+                entry.second = MessageBuffer();
+            }
+        }
+        stream->reassembly.clear();
+    }
+}
+
+/**
+ * Hand the peeked views to the worker (one tail publish)
+ */
+void AeronSubscriber::flushPendingViews(StreamState& stream) {
+    if (pending_count_ == 0) {
+        return;
+    }
+
+    const size_t count = pending_count_;
+    pending_count_ = 0;
+    queue_budget_ = queue_budget_ > count ? queue_budget_ - count : 0;
+
+    // Room was reserved before peeking, so the whole batch fits
+    view_queue_->enqueueBatch(pending_views_, count);
+
+    // Statistics + checkpoint for the last accepted view
+    uint64_t accepted = 0;
+    const MessageView* last = nullptr;
+    for (size_t i = 0; i < count; i++) {
+        if (!pending_views_[i].discard) {
+            accepted++;
+            if (pending_views_[i].header) {
+                last = &pending_views_[i];
+            }
+        }
+    }
+
+    if (accepted == 0) {
+        return;
+    }
+
+    zc_messages_received_.fetch_add(accepted, std::memory_order_relaxed);
+    const uint64_t received =
+        stream.messages_received.fetch_add(accepted, std::memory_order_relaxed) + accepted;
+
+    // Term buffer cannot be reused before the worker releases these views
+    if (stream.checkpoint && last) {
+        stream.checkpoint->update(
+            static_cast<int64_t>(last->header->sequence_number),
+            last->position,
+            static_cast<int64_t>(received)
+        );
+    }
+}
+
+/**
+ * One in-place duty cycle
+ *
+ * 1. Advance image position to what the worker has released
+ * 2. controlledPeek from our own peek position (does not move the image)
+ *    - ABORT when the view queue is full (fragment stays unconsumed)
+ *      or, in backpressure mode, no reassembly buffer is available
+ *    - BREAK once fragment_limit views were handed over
+ *
+ * Note: a single image of a single stream is followed
+ * (single publisher, see initializeInPlace).
+ */
+int AeronSubscriber::pollInPlace(int fragment_limit) {
+    StreamState& stream = *streams_[0];
+    std::shared_ptr<aeron::Image> image;
+
+    if (stream.replay_merge) {
+        // Drive the merge state machine without letting it poll the image
+        stream.replay_merge->doWork();
+        image = stream.replay_merge->image();
+    } else if (stream.subscription && stream.subscription->imageCount() > 0) {
+        image = stream.subscription->imageByIndex(0);
+    }
+
+    if (!image) {
+        return 0;
+    }
+
+    if (!inplace_image_ || inplace_image_->correlationId() != image->correlationId()) {
+        // Switch image only when nothing from the previous one is outstanding
+        if (inplace_image_ && view_queue_->releasedPosition() < inplace_peek_position_) {
+            return 0;
+        }
+        inplace_image_ = image;
+        inplace_peek_position_ = image->position();
+        view_queue_->resetReleasedPosition(inplace_peek_position_);
+    }
+
+    // 1. Give the term buffer back up to the worker's released position
+    //    (Image::position() throws beyond the end of the current term)
+    const int64_t term_mask = image->termBufferLength() - 1;
+    int64_t current = image->position();
+    int64_t term_limit = (current - (current & term_mask)) + term_mask + 1;
+    const int64_t released = std::min(view_queue_->releasedPosition(), term_limit);
+    if (released > current) {
+        image->position(released);
+        current = released;
+        term_limit = (current - (current & term_mask)) + term_mask + 1;
+    }
+
+    // Peek must start within the term of the current image position;
+    // at term_limit or beyond, the worker is a whole term behind
+    if (inplace_peek_position_ >= term_limit) {
+        zc_inplace_term_stalls_.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    // 2. Hand over views without consuming
+    //    (free slots read once per poll, not per fragment)
+    queue_budget_ = view_queue_->freeSlots(POLL_FRAGMENT_LIMIT);
+    inplace_fragment_start_ = inplace_peek_position_;
+    int fragments = 0;
+    bool queue_full = false;
+
+    auto peekHandler = [&](
+        aeron::concurrent::AtomicBuffer& buffer,
+        aeron::util::index_t offset,
+        aeron::util::index_t length,
+        const aeron::Header& header) -> aeron::ControlledPollAction
+    {
+        if (pending_count_ >= queue_budget_) {
+            queue_full = true;
+            return aeron::ControlledPollAction::ABORT;
+        }
+
+        if (!handleMessageInPlace(
+                stream,
+                buffer.buffer() + offset,
+                static_cast<size_t>(length),
+                header.position(),
+                header.flags(),
+                header.sessionId())) {
+            queue_full = true;
+            return aeron::ControlledPollAction::ABORT;
+        }
+        inplace_fragment_start_ = header.position();
+
+        return (++fragments >= fragment_limit)
+            ? aeron::ControlledPollAction::BREAK
+            : aeron::ControlledPollAction::CONTINUE;
+    };
+
+    inplace_peek_position_ = image->controlledPeek(
+        inplace_peek_position_, peekHandler, std::numeric_limits<int64_t>::max());
+
+    flushPendingViews(stream);
+
+    if (queue_full) {
+        zc_inplace_aborts_.fetch_add(1, std::memory_order_relaxed);
+    }
+    noteBackpressure(queue_full);
+
+    return fragments;
 }
 
-void AeronSubscriber::handleMessage(
+bool AeronSubscriber::handleMessage(
+    StreamState& stream,
     const uint8_t* buffer,
     size_t length,
-    int64_t position) {
+    int64_t position,
+    uint8_t flags,
+    int32_t session_id) {
+
+    if (ring_) {
+        return handleMessageRing(stream, buffer, length, position, flags, session_id);
+    }
 
     // Zero-copy mode is mandatory
     if (buffer_pool_ && message_queue_) {
-        handleMessageFastPath(buffer, length, position);
-        return;
+        return handleMessageFastPath(stream, buffer, length, position, flags, session_id);
     }
 
     // Fatal error - zero-copy components not initialized
     std::cerr << "FATAL: Zero-copy components not initialized! Call initializeZeroCopy() first." << std::endl;
     running_ = false;
+    return true;
 }
 
-void AeronSubscriber::run() {
-    std::cout << "Subscriber running. Press Ctrl+C to exit." << std::endl;
-    std::cout << "========================================\n" << std::endl;
-
-    if (!subscription_ && !replay_merge_) {
-        std::cerr << "No active subscription. Call startLive() or startReplayMerge() first." << std::endl;
+/**
+ * Backpressure episode = first aborted poll until a poll that is not
+ * aborted (downstream caught up). Called once per poll, subscriber thread.
+ */
+void AeronSubscriber::noteBackpressure(bool blocked) {
+    if (blocked) {
+        zc_backpressure_aborts_.fetch_add(1, std::memory_order_relaxed);
+        if (backpressure_since_ns_ == 0) {
+            backpressure_since_ns_ = NanoClock::nanoTime();
+            zc_backpressure_episodes_.fetch_add(1, std::memory_order_relaxed);
+        }
         return;
     }
 
+    if (backpressure_since_ns_ != 0) {
+        const uint64_t blocked_ns =
+            static_cast<uint64_t>(NanoClock::nanoTime() - backpressure_since_ns_);
+        backpressure_since_ns_ = 0;
+        zc_backpressure_total_ns_.fetch_add(blocked_ns, std::memory_order_relaxed);
+        if (blocked_ns > zc_backpressure_max_ns_.load(std::memory_order_relaxed)) {
+            zc_backpressure_max_ns_.store(blocked_ns, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * One stream's share of the duty cycle (copy mode)
+ *
+ * ReplayMerge failure deactivates this stream only; the other streams
+ * keep polling.
+ *
+ * OverflowPolicy::BACKPRESSURE uses controlledPoll instead of poll:
+ * - Queue room is read once per poll (like the in-place path)
+ * - ABORT when the batch would not fit or the pool is empty; the image
+ *   position stays at the aborted fragment, so the publisher is held
+ *   back by flow control instead of losing messages
+ */
+int AeronSubscriber::pollStream(StreamState& stream) {
     // Fragment handler lambda
-    auto fragmentHandler = [this](
+    auto fragmentHandler = [this, &stream](
         aeron::concurrent::AtomicBuffer& buffer,
         aeron::util::index_t offset,
         aeron::util::index_t length,
         const aeron::Header& header)
     {
         handleMessage(
+            stream,
             buffer.buffer() + offset,
             static_cast<size_t>(length),
-            header.position()
+            header.position(),
+            header.flags(),
+            header.sessionId()
         );
     };
 
+    const bool lossless = config_.overflow_policy == OverflowPolicy::BACKPRESSURE;
+    bool blocked = false;
+
+    auto controlledHandler = [this, &stream, &blocked](
+        aeron::concurrent::AtomicBuffer& buffer,
+        aeron::util::index_t offset,
+        aeron::util::index_t length,
+        const aeron::Header& header) -> aeron::ControlledPollAction
+    {
+        if (pending_count_ >= queue_budget_ ||
+            !handleMessage(
+                stream,
+                buffer.buffer() + offset,
+                static_cast<size_t>(length),
+                header.position(),
+                header.flags(),
+                header.sessionId())) {
+            blocked = true;
+            return aeron::ControlledPollAction::ABORT;
+        }
+        return aeron::ControlledPollAction::CONTINUE;
+    };
+
+    if (lossless) {
+        // Ring: room is checked per message (variable-length records)
+        if (ring_) {
+            queue_budget_ = std::numeric_limits<size_t>::max();
+        } else if (!stream.message_queue && shard_router_) {
+            // Sharded: the batch fits whatever the keys are
+            queue_budget_ = shard_router_->minFreeSlots(POLL_FRAGMENT_LIMIT);
+        } else {
+            MessageBufferQueue* queue = stream.message_queue ? stream.message_queue : message_queue_;
+            queue_budget_ = queue ? queue->freeSlots(POLL_FRAGMENT_LIMIT) : 0;
+        }
+    }
+
+    const std::string& name = stream.config.name;
+    int fragments = 0;
+
+    if (stream.replay_merge) {
+        // ========================================
+        // ReplayMerge Mode (Official API)
+        // ========================================
+
+        // ReplayMerge.poll() automatically:
+        // 1. Calls doWork() to advance state machine
+        // 2. Polls the image for fragments
+        // 3. Handles all state transitions
+        if (lossless) {
+            // Same as poll(), with a controlled poll of the merged image
+            stream.replay_merge->doWork();
+            std::shared_ptr<aeron::Image> image = stream.replay_merge->image();
+            fragments = image ? image->controlledPoll(controlledHandler, POLL_FRAGMENT_LIMIT) : 0;
+            noteBackpressure(blocked);
+        } else {
+            fragments = stream.replay_merge->poll(fragmentHandler, POLL_FRAGMENT_LIMIT);
+        }
+        flushPendingBuffers(stream);
+
+        const uint64_t received = stream.messages_received.load(std::memory_order_relaxed);
+
+        // 100개마다 진행 상황 출력
+        if (fragments > 0 && received > 0 && received % 100 == 0) {
+            std::cout << "[REPLAY_MERGE:" << name << "] Received " << received
+                      << " messages (automatic state management)" << std::endl;
+        }
+
+        // Check if merge completed successfully
+        if (stream.replay_merge->isMerged()) {
+            std::cout << "\n========================================" << std::endl;
+            std::cout << "✓ SUCCESSFULLY MERGED TO LIVE! [" << name << "]" << std::endl;
+            std::cout << "========================================" << std::endl;
+            std::cout << "  Total messages received: " << received << std::endl;
+            std::cout << "  ReplayMerge completed all phases:" << std::endl;
+            std::cout << "    ✓ RESOLVE_REPLAY_PORT" << std::endl;
+            std::cout << "    ✓ GET_RECORDING_POSITION" << std::endl;
+            std::cout << "    ✓ REPLAY (recorded messages)" << std::endl;
+            std::cout << "    ✓ CATCHUP (seamless transition)" << std::endl;
+            std::cout << "    ✓ ATTEMPT_LIVE_JOIN" << std::endl;
+            std::cout << "    ✓ MERGED (now live-only)" << std::endl;
+            std::cout << "========================================" << std::endl;
+            std::cout << "\nNow in LIVE-ONLY mode." << std::endl;
+            std::cout << "Continuing to receive live messages...\n" << std::endl;
+
+            // Release ReplayMerge object
+            // subscription continues to receive live messages
+            stream.replay_merge.reset();
+
+        } else if (stream.replay_merge->hasFailed()) {
+            std::cerr << "\n========================================" << std::endl;
+            std::cerr << "❌ REPLAYMERGE FAILED! [" << name << "]" << std::endl;
+            std::cerr << "========================================" << std::endl;
+            std::cerr << "  ReplayMerge encountered an error." << std::endl;
+            std::cerr << "  Check Archive logs for details." << std::endl;
+            std::cerr << "  Messages received before failure: " << received << std::endl;
+            std::cerr << "========================================\n" << std::endl;
+
+            stream.replay_merge.reset();
+            stream.active = false;
+        }
+
+    } else if (stream.subscription) {
+        // ========================================
+        // Live-only Mode
+        // ========================================
+        if (lossless) {
+            fragments = stream.subscription->controlledPoll(controlledHandler, POLL_FRAGMENT_LIMIT);
+            noteBackpressure(blocked);
+        } else {
+            fragments = stream.subscription->poll(fragmentHandler, POLL_FRAGMENT_LIMIT);
+        }
+        flushPendingBuffers(stream);
+
+        const uint64_t received = stream.messages_received.load(std::memory_order_relaxed);
+
+        // 100개마다 Live 수신 상황 출력
+        if (fragments > 0 && received % 100 == 0) {
+            std::cout << "[LIVE:" << name << "] Received " << received
+                      << " messages" << std::endl;
+        }
+    }
+
+    return fragments;
+}
+
+void AeronSubscriber::run() {
+    std::cout << "Subscriber running. Press Ctrl+C to exit." << std::endl;
+    std::cout << "========================================\n" << std::endl;
+
+    bool any_started = false;
+    for (const auto& stream : streams_) {
+        any_started = any_started || stream->subscription || stream->replay_merge;
+    }
+    if (!any_started) {
+        std::cerr << "No active subscription. Call startLive() or startReplayMerge() first." << std::endl;
+        return;
+    }
+
+    const bool in_place = (config_.receive_mode == ReceiveMode::IN_PLACE);
+    if (in_place && !view_queue_) {
+        std::cerr << "FATAL: In-place mode requires initializeInPlace() first." << std::endl;
+        return;
+    }
+
     while (running_) {
         int fragments = 0;
 
-        if (replay_merge_) {
+        if (in_place) {
             // ========================================
-            // ReplayMerge Mode (Official API)
+            // In-place Mode (controlledPeek, no copy)
             // ========================================
-
-            // ReplayMerge.poll() automatically:
-            // 1. Calls doWork() to advance state machine
-            // 2. Polls the image for fragments
-            // 3. Handles all state transitions
-            fragments = replay_merge_->poll(fragmentHandler, 10);
-
-            // 100개마다 진행 상황 출력
-            if (message_count_ > 0 && message_count_ % 100 == 0) {
-                std::cout << "[REPLAY_MERGE] Received " << message_count_
-                          << " messages (automatic state management)" << std::endl;
-            }
-
-            // Check if merge completed successfully
-            if (replay_merge_->isMerged()) {
-                std::cout << "\n========================================" << std::endl;
-                std::cout << "✓ SUCCESSFULLY MERGED TO LIVE!" << std::endl;
-                std::cout << "========================================" << std::endl;
-                std::cout << "  Total messages received: " << message_count_ << std::endl;
-                std::cout << "  ReplayMerge completed all phases:" << std::endl;
-                std::cout << "    ✓ RESOLVE_REPLAY_PORT" << std::endl;
-                std::cout << "    ✓ GET_RECORDING_POSITION" << std::endl;
-                std::cout << "    ✓ REPLAY (recorded messages)" << std::endl;
-                std::cout << "    ✓ CATCHUP (seamless transition)" << std::endl;
-                std::cout << "    ✓ ATTEMPT_LIVE_JOIN" << std::endl;
-                std::cout << "    ✓ MERGED (now live-only)" << std::endl;
-                std::cout << "========================================" << std::endl;
-                std::cout << "\nNow in LIVE-ONLY mode." << std::endl;
-                std::cout << "Continuing to receive live messages...\n" << std::endl;
-
-                // Release ReplayMerge object
-                // subscription_ continues to receive live messages
-                replay_merge_.reset();
-
-            } else if (replay_merge_->hasFailed()) {
-                std::cerr << "\n========================================" << std::endl;
-                std::cerr << "❌ REPLAYMERGE FAILED!" << std::endl;
-                std::cerr << "========================================" << std::endl;
-                std::cerr << "  ReplayMerge encountered an error." << std::endl;
-                std::cerr << "  Check Archive logs for details." << std::endl;
-                std::cerr << "  Messages received before failure: " << message_count_ << std::endl;
-                std::cerr << "========================================\n" << std::endl;
-
-                replay_merge_.reset();
+            fragments = pollInPlace(POLL_FRAGMENT_LIMIT);
+
+            auto& replay_merge = streams_[0]->replay_merge;
+            if (replay_merge && replay_merge->isMerged()) {
+                std::cout << "\n✓ SUCCESSFULLY MERGED TO LIVE! (in-place mode)" << std::endl;
+                replay_merge.reset();
+            } else if (replay_merge && replay_merge->hasFailed()) {
+                std::cerr << "\n❌ REPLAYMERGE FAILED! (in-place mode)" << std::endl;
+                replay_merge.reset();
                 break;
             }
 
-        } else if (subscription_) {
+        } else {
             // ========================================
-            // Live-only Mode
+            // Copy Mode: every stream polled once per duty cycle
             // ========================================
-            fragments = subscription_->poll(fragmentHandler, 10);
+            size_t active = 0;
+            for (auto& stream : streams_) {
+                if (!stream->active) {
+                    continue;
+                }
+                fragments += pollStream(*stream);
+                if (stream->active) {
+                    active++;
+                }
+            }
 
-            // 100개마다 Live 수신 상황 출력
-            if (fragments > 0 && message_count_ % 100 == 0) {
-                std::cout << "[LIVE] Received " << message_count_
-                          << " messages" << std::endl;
+            if (active == 0) {
+                std::cerr << "No active streams left - stopping subscriber loop" << std::endl;
+                break;
             }
         }
 
-        if (fragments == 0) {
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(AeronConfig::IDLE_SLEEP_MS));
-        }
+        idle_strategy_->idle(fragments);
+    }
+
+    // 재조립 중이던 버퍼 반환 (subscriber thread 소유, pool은 아직 유효)
+    if (buffer_pool_) {
+        releaseReassemblyBuffers();
+        buffer_pool_->flushThreadCache();
     }
 }
 
 
+bool AeronSubscriber::acceptSequence(StreamState& stream, int64_t message_number,
+                                     int64_t position, int32_t session_id) {
+    // Simple gap detection & recovery (온프레미스 최적화) (~50ns)
+    if (config_.gap_recovery_enabled && checkForGaps(stream, message_number)) {
+        gaps_detected_.fetch_add(1, std::memory_order_relaxed);
+        stream.gaps_detected.fetch_add(1, std::memory_order_relaxed);
+        // Hand the range to the gap fill agent (non-blocking)
+        triggerImmediateGapRecovery(stream, stream.expected_sequence, message_number - 1,
+                                    position, session_id);
+    }
+
+    // Duplicate check + record (~5ns, sliding bitmap)
+    if (isDuplicate(stream, message_number)) {
+        duplicates_detected_.fetch_add(1, std::memory_order_relaxed);
+        stream.duplicates_detected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Update tracking (~10ns) - a late (out-of-order) message does not move
+    // expected_sequence back
+    if (message_number >= stream.expected_sequence) {
+        stream.expected_sequence = message_number + 1;
+    }
+    stream.last_position = position;
+
+    return true;
+}
+
 // Simple gap recovery (온프레미스 최적화)
-bool AeronSubscriber::checkForGaps(int64_t message_number) {
-    if (expected_sequence_ == 0) {
+bool AeronSubscriber::checkForGaps(StreamState& stream, int64_t message_number) {
+    if (stream.expected_sequence == 0) {
         // First message - initialize expected sequence
-        expected_sequence_ = message_number + 1;
+        stream.expected_sequence = message_number + 1;
         return false;
     }
 
-    // Simple gap detection: expected_sequence_ < message_number
-    if (message_number < expected_sequence_) {
+    // Simple gap detection: expected_sequence < message_number
+    if (message_number < stream.expected_sequence) {
         // Old message (possible duplicate) - not a gap
         return false;
     }
 
-    if (message_number > expected_sequence_) {
-        // Gap detected: missing messages [expected_sequence_, message_number-1]
-        int64_t gap_size = message_number - expected_sequence_;
+    if (message_number > stream.expected_sequence) {
+        // Gap detected: missing messages [expected_sequence, message_number-1]
+        int64_t gap_size = message_number - stream.expected_sequence;
 
         // Only trigger immediate recovery if gap is small (온프레미스 최적화)
         if (gap_size <= config_.max_gap_tolerance) {
             return true;  // Trigger immediate recovery
         } else {
             // Large gap - log but don't recover (probably replay scenario)
-            std::cout << "⚠️  Large gap detected (" << gap_size << " messages) - skipping recovery" << std::endl;
+            std::cout << "⚠️  Large gap detected [" << stream.config.name << "] ("
+                      << gap_size << " messages) - skipping recovery" << std::endl;
             return false;
         }
     }
@@ -585,64 +1806,45 @@ bool AeronSubscriber::checkForGaps(int64_t message_number) {
     return false;  // No gap
 }
 
-bool AeronSubscriber::isDuplicate(int64_t message_number) {
-    if (!config_.duplicate_check_enabled || duplicate_buffer_.empty()) {
+/**
+ * O(1) duplicate check (~5ns regardless of window size)
+ *
+ * Out-of-order sequences inside the window are tracked exactly.
+ * Sequences older than the window cannot be classified and are accepted
+ * (same as a sequence that fell out of the previous ring buffer).
+ */
+bool AeronSubscriber::isDuplicate(StreamState& stream, int64_t message_number) {
+    if (!config_.duplicate_check_enabled) {
         return false;
     }
 
-    // Simple ring buffer search (fixed window)
-    for (size_t i = 0; i < duplicate_buffer_.size(); ++i) {
-        if (duplicate_buffer_[i] == message_number) {
-            return true;  // Duplicate found
-        }
-    }
-
-    return false;  // Not a duplicate
-}
-
-void AeronSubscriber::addToDecluplicationBuffer(int64_t message_number) {
-    if (!config_.duplicate_check_enabled || duplicate_buffer_.empty()) {
-        return;
-    }
-
-    // Add to ring buffer at current position
-    duplicate_buffer_[duplicate_buffer_pos_] = message_number;
-    duplicate_buffer_pos_ = (duplicate_buffer_pos_ + 1) % duplicate_buffer_.size();
+    return stream.duplicate_window.testAndSet(message_number)
+        == SequenceWindow::Result::DUPLICATE;
 }
 
-bool AeronSubscriber::triggerImmediateGapRecovery(int64_t gap_start, int64_t gap_end) {
-    if (!archive_) {
-        std::cerr << "Archive not available for gap recovery" << std::endl;
+/**
+ * Queue the missing range for the gap fill agent (~50ns)
+ *
+ * No archive RPC here: the agent replays [last_position, position) on
+ * its own thread and injects the missing messages into the worker path.
+ */
+bool AeronSubscriber::triggerImmediateGapRecovery(StreamState& stream,
+                                                  int64_t gap_start, int64_t gap_end,
+                                                  int64_t position, int32_t session_id) {
+    if (!gap_fill_) {
         return false;
     }
 
-    try {
-        // Find latest recording for gap recovery
-        int64_t recording_id = findLatestRecording(
-            config_.subscription_channel.empty() ?
-                std::string(AeronConfig::SUBSCRIPTION_CHANNEL) : config_.subscription_channel,
-            config_.subscription_stream_id
-        );
-
-        if (recording_id <= 0) {
-            std::cerr << "No recording found for gap recovery" << std::endl;
-            return false;
-        }
-
-        std::cout << "🔄 Gap recovery: messages " << gap_start << "-" << gap_end
-                  << " (recording " << recording_id << ")" << std::endl;
+    GapFillRequest request;
+    request.stream_index = stream.index;
+    request.session_id = session_id;
+    request.from_sequence = gap_start;
+    request.to_sequence = gap_end;
+    request.from_position = stream.last_position;
+    request.to_position = position;
 
-        // Non-blocking gap recovery using existing replay infrastructure
-        // Note: In production, this would be done in a separate thread
-        // For now, we just log the gap and let normal replay-to-live handle it
-        gaps_recovered_.fetch_add(gap_end - gap_start + 1, std::memory_order_relaxed);
-
-        return true;
-
-    } catch (const std::exception& e) {
-        std::cerr << "Gap recovery failed: " << e.what() << std::endl;
-        return false;
-    }
+    // Full queue: dropped and counted by the agent
+    return gap_fill_->requestGap(request);
 }
 
 // Minimal gap stats for legacy compatibility
@@ -659,10 +1861,39 @@ void AeronSubscriber::shutdown() {
     std::cout << "\n=== FINAL STATISTICS ===" << std::endl;
     std::cout << "Messages received:      " << zc_messages_received_.load() << std::endl;
     std::cout << "Gaps detected:          " << gaps_detected_.load() << std::endl;
-    std::cout << "Gaps recovered:         " << gaps_recovered_.load() << std::endl;
+    std::cout << "Gaps recovered:         "
+              << (gap_fill_ ? gap_fill_->getStatistics().messages_recovered : 0)
+              << " messages" << std::endl;
     std::cout << "Duplicates detected:    " << duplicates_detected_.load() << std::endl;
     std::cout << "Buffer allocation fails: " << zc_buffer_allocation_failures_.load() << std::endl;
     std::cout << "Queue full failures:    " << zc_queue_full_failures_.load() << std::endl;
+    if (config_.receive_mode == ReceiveMode::IN_PLACE) {
+        std::cout << "In-place peek aborts:   " << zc_inplace_aborts_.load() << std::endl;
+        std::cout << "In-place term stalls:   " << zc_inplace_term_stalls_.load() << std::endl;
+    }
+    std::cout << "Reassembled messages:   " << zc_reassembled_messages_.load() << std::endl;
+    std::cout << "Reassembly drops:       " << zc_reassembly_drops_.load() << std::endl;
+    if (zc_backpressure_episodes_.load() > 0) {
+        std::cout << "Backpressure:           " << zc_backpressure_episodes_.load()
+                  << " episodes, " << zc_backpressure_aborts_.load() << " aborted polls, "
+                  << zc_backpressure_total_ns_.load() / 1000 << " us total, "
+                  << zc_backpressure_max_ns_.load() / 1000 << " us max" << std::endl;
+    }
+
+    if (streams_.size() > 1) {
+        std::cout << "\n--- Per-stream ---" << std::endl;
+        for (const auto& stats : getStreamStats()) {
+            std::cout << "  [" << stats.name << "] " << stats.channel
+                      << " stream " << stats.stream_id
+                      << (stats.active ? "" : " (FAILED)") << std::endl;
+            std::cout << "    received " << stats.messages_received
+                      << ", gaps " << stats.gaps_detected
+                      << ", duplicates " << stats.duplicates_detected
+                      << ", queue full " << stats.queue_full_failures << std::endl;
+        }
+    }
+
+    idle_strategy_->printStatistics("subscriber");
 
     if (gap_count_ > 0) {
         std::cout << "\nLegacy gap count: " << gap_count_ << std::endl;
@@ -672,9 +1903,17 @@ void AeronSubscriber::shutdown() {
     std::cout << "\nGap Recovery: " << (config_.gap_recovery_enabled ? "ENABLED" : "DISABLED") << std::endl;
     std::cout << "Duplicate Check: " << (config_.duplicate_check_enabled ? "ENABLED" : "DISABLED") << std::endl;
 
+    if (gap_fill_) {
+        gap_fill_->stop();
+        gap_fill_->printStatistics();
+    }
+
     // ReplayMerge 정리 (자동으로 정리됨)
-    replay_merge_.reset();
-    subscription_.reset();
+    inplace_image_.reset();
+    for (auto& stream : streams_) {
+        stream->replay_merge.reset();
+        stream->subscription.reset();
+    }
     archive_.reset();
     aeron_.reset();
 
@@ -1,4 +1,5 @@
 #include "CheckpointManager.h"
+#include "NanoClock.h"
 #include <cstdio>
 #include <cerrno>
 #include <cstring>
@@ -7,9 +8,11 @@
 namespace aeron {
 namespace example {
 
-CheckpointManager::CheckpointManager(const std::string& file, int flush_interval_sec)
+CheckpointManager::CheckpointManager(const std::string& file, int flush_interval_sec,
+                                     const ThreadSettings& thread)
     : checkpoint_file_(file)
-    , flush_interval_(flush_interval_sec) {
+    , flush_interval_(flush_interval_sec)
+    , thread_settings_(thread) {
 
     std::cout << "========================================" << std::endl;
     std::cout << "Initializing CheckpointManager" << std::endl;
@@ -91,6 +94,8 @@ void CheckpointManager::printStatistics() const {
 }
 
 void CheckpointManager::flushLoop() {
+    ThreadUtil::configureCurrentThread("aeron-ckpt", thread_settings_);
+
     while (running_) {
         // Sleep for flush interval
         std::this_thread::sleep_for(flush_interval_);
@@ -250,8 +255,8 @@ void CheckpointManager::load() {
 }
 
 int64_t CheckpointManager::getCurrentTimeNanos() {
-    auto now = std::chrono::system_clock::now().time_since_epoch();
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    // Called per update() - TSC clock instead of system_clock::now()
+    return NanoClock::nanoTime();
 }
 
 } // namespace example
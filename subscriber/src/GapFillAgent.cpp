@@ -0,0 +1,450 @@
+/**
+ * GapFillAgent.cpp
+ *
+ * Archive replay of missing ranges on a dedicated thread
+ */
+
+#include "GapFillAgent.h"
+#include "NanoClock.h"
+#include "StatCounter.h"
+#include "concurrent/logbuffer/FrameDescriptor.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace aeron {
+namespace example {
+
+namespace FrameDescriptor = aeron::concurrent::logbuffer::FrameDescriptor;
+
+GapFillAgent::GapFillAgent(std::shared_ptr<aeron::Aeron> aeron,
+                           const GapFillConfig& config,
+                           MessageBufferPool& pool)
+    : config_(config)
+    , aeron_(std::move(aeron))
+    , pool_(pool) {
+
+    IdleStrategyConfig wait_config;
+    wait_config.name = "sleeping";
+    wait_config.sleep_ns = AeronConfig::IDLE_SLEEP_NS;
+    wait_idle_ = IdleStrategy::create(wait_config);
+
+    IdleStrategyConfig poll_config;
+    poll_config.name = "backoff";
+    poll_idle_ = IdleStrategy::create(poll_config);
+
+    // Worst case: every missing message of one replay held until sorted
+    recovered_.reserve(1024);
+}
+
+GapFillAgent::~GapFillAgent() {
+    stop();
+}
+
+void GapFillAgent::addStream(const std::string& name, const std::string& channel,
+                             int stream_id, MessageBufferQueue* output,
+                             ShardRouter* router) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "Cannot add gap fill stream while agent is running" << std::endl;
+        return;
+    }
+
+    StreamTarget target;
+    target.name = name;
+    target.channel = channel;
+    target.stream_id = stream_id;
+    target.output = output;
+    target.router = router;
+    streams_.push_back(target);
+}
+
+void GapFillAgent::start() {
+    if (running_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&GapFillAgent::run, this);
+
+    std::cout << "✓ Gap fill agent started (replay " << config_.replay_channel
+              << ", stream " << config_.replay_stream_id << ")" << std::endl;
+}
+
+void GapFillAgent::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    std::cout << "✓ Gap fill agent stopped" << std::endl;
+}
+
+bool GapFillAgent::requestGap(const GapFillRequest& request) noexcept {
+    if (!requests_.enqueue(request)) {
+        bump(requests_dropped_);
+        return false;
+    }
+    bump(requests_count_);
+    return true;
+}
+
+void GapFillAgent::run() {
+    ThreadUtil::configureCurrentThread("aeron-gapfill", config_.thread);
+
+    GapFillRequest request;
+    while (running_.load(std::memory_order_acquire)) {
+        if (!requests_.dequeue(request)) {
+            releaseAbandonedSubscriptions();
+            wait_idle_->idle(0);
+            continue;
+        }
+        wait_idle_->idle(1);
+
+        fill(request);
+    }
+
+    releaseAbandonedSubscriptions();
+    pool_.flushThreadCache();
+    archive_.reset();
+}
+
+void GapFillAgent::releaseAbandonedSubscriptions() {
+    auto it = abandoned_subscriptions_.begin();
+    while (it != abandoned_subscriptions_.end()) {
+        bool resolved = true;
+        try {
+            // Dropping the returned subscription closes it
+            resolved = aeron_->findSubscription(*it) != nullptr;
+        } catch (const std::exception&) {
+            // Registration failed - nothing left to close
+        }
+        it = resolved ? abandoned_subscriptions_.erase(it) : it + 1;
+    }
+}
+
+/**
+ * Own archive client (AeronArchive is not thread-safe, and connecting
+ * here keeps the RPC off the subscriber thread). Retried per request.
+ */
+bool GapFillAgent::connectArchive() {
+    if (archive_) {
+        return true;
+    }
+
+    try {
+        archive_context_ = std::make_shared<aeron::archive::client::Context>();
+        archive_context_->aeron(aeron_);
+        archive_context_->controlRequestChannel(config_.archive_control_channel.empty()
+            ? AeronConfig::ARCHIVE_CONTROL_REQUEST_CHANNEL
+            : config_.archive_control_channel);
+        archive_context_->controlResponseChannel(AeronConfig::ARCHIVE_CONTROL_RESPONSE_CHANNEL);
+
+        archive_ = aeron::archive::client::AeronArchive::connect(*archive_context_);
+        return archive_ != nullptr;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Gap fill: archive connect failed: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+int64_t GapFillAgent::findRecording(StreamTarget& target, int32_t session_id) {
+    if (target.recording_id >= 0 && target.recording_session_id == session_id) {
+        return target.recording_id;
+    }
+
+    // Positions are per publisher session: match the session, not just the stream
+    const int64_t recording_id = archive_->findLastMatchingRecording(
+        0, target.channel, target.stream_id, session_id);
+
+    if (recording_id == aeron::NULL_VALUE) {
+        return -1;
+    }
+
+    target.recording_id = recording_id;
+    target.recording_session_id = session_id;
+    return recording_id;
+}
+
+/**
+ * Replay [from_position, to_position) of the stream's recording
+ *
+ * The range ends with the message that revealed the gap (already
+ * delivered live); only sequences inside the gap are kept.
+ */
+void GapFillAgent::fill(const GapFillRequest& request) {
+    if (request.stream_index >= streams_.size()) {
+        bump(requests_rejected_);
+        return;
+    }
+
+    StreamTarget& target = streams_[request.stream_index];
+    const int64_t length = request.to_position - request.from_position;
+    const int64_t missing = request.to_sequence - request.from_sequence + 1;
+
+    if (request.from_position <= 0 || length <= 0 || length > config_.max_replay_bytes) {
+        std::cerr << "Gap fill [" << target.name << "]: range " << request.from_position
+                  << "-" << request.to_position << " rejected (max "
+                  << config_.max_replay_bytes << " bytes)" << std::endl;
+        bump(requests_rejected_);
+        bump(messages_unrecovered_, missing);
+        return;
+    }
+
+    if (!connectArchive()) {
+        bump(replay_failures_);
+        bump(messages_unrecovered_, missing);
+        return;
+    }
+
+    std::shared_ptr<aeron::Subscription> subscription;
+    int64_t replay_session_id = aeron::NULL_VALUE;
+    bool replay_active = false;   // Archive still replaying (stopReplay needed)
+
+    try {
+        const int64_t recording_id = findRecording(target, request.session_id);
+        if (recording_id < 0) {
+            std::cerr << "Gap fill [" << target.name << "]: no recording for session "
+                      << request.session_id << std::endl;
+            bump(replay_failures_);
+            bump(messages_unrecovered_, missing);
+            return;
+        }
+
+        replay_session_id = archive_->startReplay(
+            recording_id, request.from_position, length,
+            config_.replay_channel, config_.replay_stream_id);
+        bump(replays_);
+        replay_active = true;
+
+        // Only this replay's image (replays share the replay channel/stream)
+        const std::string channel = config_.replay_channel
+            + (config_.replay_channel.find('?') == std::string::npos ? "?" : "|")
+            + "session-id=" + std::to_string(static_cast<int32_t>(replay_session_id));
+
+        const auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::milliseconds(config_.timeout_ms);
+
+        const int64_t subscription_id = aeron_->addSubscription(channel, config_.replay_stream_id);
+        while (!(subscription = aeron_->findSubscription(subscription_id))) {
+            if (std::chrono::steady_clock::now() > deadline || !running_) {
+                break;
+            }
+            poll_idle_->idle(0);
+        }
+        if (!subscription) {
+            if (running_) {
+                bump(replay_timeouts_);
+            }
+            abandoned_subscriptions_.push_back(subscription_id);
+        }
+
+        auto handler = [this, &request](
+            aeron::concurrent::AtomicBuffer& buffer,
+            aeron::util::index_t offset,
+            aeron::util::index_t fragment_length,
+            const aeron::Header& header)
+        {
+            onReplayFragment(request, buffer.buffer() + offset,
+                             static_cast<size_t>(fragment_length), header.flags());
+        };
+
+        while (subscription && running_.load(std::memory_order_acquire)) {
+            const int fragments = subscription->poll(handler, 10);
+
+            std::shared_ptr<aeron::Image> image =
+                subscription->imageBySessionId(static_cast<int32_t>(replay_session_id));
+            // Replay ended on the archive side (range done / end of recording)
+            if (image && (image->position() >= request.to_position || image->isEndOfStream())) {
+                replay_active = false;
+                break;
+            }
+            if (image && image->isClosed()) {
+                replay_active = false;
+                break;
+            }
+
+            if (std::chrono::steady_clock::now() > deadline) {
+                bump(replay_timeouts_);
+                break;
+            }
+
+            poll_idle_->idle(fragments);
+        }
+
+        if (replay_active) {
+            archive_->stopReplay(replay_session_id);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Gap fill [" << target.name << "]: replay failed: " << e.what() << std::endl;
+        bump(replay_failures_);
+        // Archive error may leave the recording id stale
+        target.recording_id = -1;
+    }
+
+    // Closes the replay subscription
+    subscription.reset();
+
+    if (in_progress_) {
+        pool_.deallocate(in_progress_);
+        in_progress_ = MessageBuffer();
+    }
+
+    // Gap order: replay order is already by position, sort guards session restarts
+    std::sort(recovered_.begin(), recovered_.end(),
+              [this](BufferId a, BufferId b) {
+                  return pool_.resolve(a).header->sequence_number
+                       < pool_.resolve(b).header->sequence_number;
+              });
+
+    const size_t recovered = recovered_.size();
+    size_t enqueued = 0;
+    if (target.router && recovered > 0) {
+        // Per shard, messages that did not fit are returned to the pool
+        std::unique_ptr<bool[]> accepted(new bool[recovered]);
+        enqueued = target.router->routeBatch(recovered_.data(), recovered, accepted.get());
+        for (size_t i = 0; i < recovered; i++) {
+            if (!accepted[i]) {
+                pool_.deallocate(recovered_[i]);
+            }
+        }
+    } else {
+        if (target.output && recovered > 0) {
+            enqueued = target.output->enqueueBatch(recovered_.data(), recovered);
+        }
+        for (size_t i = enqueued; i < recovered; i++) {
+            pool_.deallocate(recovered_[i]);
+        }
+    }
+    recovered_.clear();
+
+    bump(messages_recovered_, enqueued);
+    if (enqueued < recovered) {
+        bump(output_drops_, recovered - enqueued);
+    }
+    if (static_cast<int64_t>(enqueued) < missing) {
+        bump(messages_unrecovered_, missing - enqueued);
+    }
+
+    std::cout << "🔄 Gap fill [" << target.name << "]: messages "
+              << request.from_sequence << "-" << request.to_sequence
+              << " recovered " << enqueued << "/" << missing << std::endl;
+}
+
+void GapFillAgent::onReplayFragment(const GapFillRequest& request, const uint8_t* buffer,
+                                    size_t length, uint8_t flags) {
+    if ((flags & FrameDescriptor::UNFRAGMENTED) == FrameDescriptor::UNFRAGMENTED) {
+        if (!isBatchEnvelope(buffer, length)) {
+            recoverMessage(request, buffer, length);
+        } else if (batchMessageCount(buffer, length) > 0) {
+            // Envelope: each inner message is checked against the gap on its own
+            forEachBatchMessage(buffer, length, [&](const uint8_t* message, size_t message_length) {
+                recoverMessage(request, message, message_length);
+            });
+        }
+        return;
+    }
+
+    MessageBuffer complete;
+
+    if (flags & FrameDescriptor::BEGIN_FRAG) {
+        if (in_progress_) {
+            pool_.deallocate(in_progress_);
+            in_progress_ = MessageBuffer();
+        }
+        if (length < sizeof(MessageHeader)) {
+            return;
+        }
+        const auto* header = reinterpret_cast<const MessageHeader*>(buffer);
+        const int64_t sequence = static_cast<int64_t>(header->sequence_number);
+        if (sequence < request.from_sequence || sequence > request.to_sequence) {
+            return;
+        }
+
+        const size_t total_payload = header->message_length > sizeof(MessageHeader)
+            ? header->message_length - sizeof(MessageHeader) : 0;
+        in_progress_ = pool_.allocate(total_payload);
+        if (!in_progress_) {
+            bump(output_drops_);
+            return;
+        }
+        in_progress_.copyFromAeron(buffer, length);
+        return;
+
+    } else {
+        if (!in_progress_) {
+            return;
+        }
+        if (!in_progress_.appendPayload(buffer, length)) {
+            pool_.deallocate(in_progress_);
+            in_progress_ = MessageBuffer();
+            return;
+        }
+        if (!(flags & FrameDescriptor::END_FRAG)) {
+            return;
+        }
+        complete = in_progress_;
+        in_progress_ = MessageBuffer();
+    }
+
+    complete.header->recv_time_ns = NanoClock::nanoTime();
+    complete.descriptor->stream_index = static_cast<uint16_t>(request.stream_index);
+    recovered_.push_back(complete.id);
+}
+
+void GapFillAgent::recoverMessage(const GapFillRequest& request, const uint8_t* buffer,
+                                  size_t length) {
+    if (length < sizeof(MessageHeader)) {
+        return;
+    }
+    const auto* header = reinterpret_cast<const MessageHeader*>(buffer);
+    const int64_t sequence = static_cast<int64_t>(header->sequence_number);
+    if (sequence < request.from_sequence || sequence > request.to_sequence) {
+        return;  // Outside the gap (e.g. the message that revealed it)
+    }
+
+    MessageBuffer complete = pool_.allocate(length - sizeof(MessageHeader));
+    if (!complete) {
+        bump(output_drops_);
+        return;
+    }
+    complete.copyFromAeron(buffer, length);
+    complete.header->recv_time_ns = NanoClock::nanoTime();
+    complete.descriptor->stream_index = static_cast<uint16_t>(request.stream_index);
+    recovered_.push_back(complete.id);
+}
+
+GapFillAgent::Statistics GapFillAgent::getStatistics() const {
+    Statistics stats;
+    stats.requests = requests_count_.load(std::memory_order_relaxed);
+    stats.requests_dropped = requests_dropped_.load(std::memory_order_relaxed);
+    stats.requests_rejected = requests_rejected_.load(std::memory_order_relaxed);
+    stats.replays = replays_.load(std::memory_order_relaxed);
+    stats.replay_failures = replay_failures_.load(std::memory_order_relaxed);
+    stats.replay_timeouts = replay_timeouts_.load(std::memory_order_relaxed);
+    stats.messages_recovered = messages_recovered_.load(std::memory_order_relaxed);
+    stats.messages_unrecovered = messages_unrecovered_.load(std::memory_order_relaxed);
+    stats.output_drops = output_drops_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void GapFillAgent::printStatistics() const {
+    const Statistics stats = getStatistics();
+    std::cout << "\n=== Gap Fill Agent ===" << std::endl;
+    std::cout << "Requests:             " << stats.requests
+              << " (dropped " << stats.requests_dropped
+              << ", rejected " << stats.requests_rejected << ")" << std::endl;
+    std::cout << "Replays:              " << stats.replays
+              << " (failed " << stats.replay_failures
+              << ", timed out " << stats.replay_timeouts << ")" << std::endl;
+    std::cout << "Messages recovered:   " << stats.messages_recovered << std::endl;
+    std::cout << "Messages unrecovered: " << stats.messages_unrecovered << std::endl;
+    std::cout << "Output drops:         " << stats.output_drops << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
@@ -0,0 +1,244 @@
+/**
+ * MessageValidator.cpp
+ *
+ * Batched structural checks (SSE2, scalar fallback) + flagged checksums
+ */
+
+#include "MessageValidator.h"
+#include <cstring>
+#include <iostream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace aeron {
+namespace example {
+
+namespace {
+
+constexpr size_t LANES = 4;
+
+constexpr size_t LENGTH_OFFSET = offsetof(MessageHeader, message_length);
+
+uint32_t load32(const uint8_t* p) noexcept {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// "SEKR" as the first 4 header bytes read in host order
+const uint32_t MAGIC_WORD = load32(reinterpret_cast<const uint8_t*>("SEKR"));
+
+/**
+ * Header fields of up to 4 messages, one lane each
+ * (lanes without a header hold values that pass, see too_short)
+ */
+struct Lanes {
+    alignas(16) uint32_t magic[LANES];
+    alignas(16) uint32_t version_type[LANES];   // version | message_type << 16
+    alignas(16) uint32_t length[LANES];         // header message_length
+    alignas(16) uint32_t expected[LANES];       // header + received payload
+    unsigned too_short = 0;                     // bit per lane
+};
+
+void gather(const MessageView* views, size_t count, Lanes& lanes) noexcept {
+    for (size_t lane = 0; lane < LANES; lane++) {
+        const MessageHeader* header = lane < count ? views[lane].header : nullptr;
+        if (header) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(header);
+            lanes.magic[lane] = load32(bytes);
+            lanes.version_type[lane] = load32(bytes + offsetof(MessageHeader, version));
+            lanes.length[lane] = load32(bytes + LENGTH_OFFSET);
+            lanes.expected[lane] = static_cast<uint32_t>(sizeof(MessageHeader)) + views[lane].payload_length;
+        } else {
+            lanes.magic[lane] = MAGIC_WORD;
+            lanes.version_type[lane] = 1u | (static_cast<uint32_t>(MessageValidator::MIN_MESSAGE_TYPE) << 16);
+            lanes.length[lane] = 0;
+            lanes.expected[lane] = 0;
+            if (lane < count) {
+                lanes.too_short |= 1u << lane;
+            }
+        }
+    }
+}
+
+/**
+ * Pass bitmasks (bit per lane) of the four structural checks
+ */
+struct LaneMasks {
+    unsigned magic;
+    unsigned version;
+    unsigned length;
+    unsigned type;
+};
+
+#if defined(__SSE2__)
+
+unsigned movemask(__m128i mask) noexcept {
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask)));
+}
+
+// Unsigned 32-bit a < b (SSE2 only has signed compares: flip the sign bits)
+__m128i lessThanUnsigned(__m128i a, __m128i b) noexcept {
+    const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    return _mm_cmplt_epi32(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+}
+
+LaneMasks checkLanes(const Lanes& lanes) noexcept {
+    const __m128i magic = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.magic));
+    const __m128i version_type = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.version_type));
+    const __m128i length = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.length));
+    const __m128i expected = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.expected));
+    const __m128i one = _mm_set1_epi32(1);
+
+    // version in [1, MAX_VERSION]: (version - 1) < MAX_VERSION (unsigned)
+    const __m128i version = _mm_and_si128(version_type, _mm_set1_epi32(0xFFFF));
+    const __m128i version_ok = lessThanUnsigned(
+        _mm_sub_epi32(version, one), _mm_set1_epi32(MessageValidator::MAX_VERSION));
+
+    // type in [MIN, MAX] or MSG_TEST
+    const __m128i type = _mm_srli_epi32(version_type, 16);
+    const __m128i type_ok = _mm_or_si128(
+        lessThanUnsigned(_mm_sub_epi32(type, _mm_set1_epi32(MessageValidator::MIN_MESSAGE_TYPE)),
+                         _mm_set1_epi32(MessageValidator::MAX_MESSAGE_TYPE -
+                                        MessageValidator::MIN_MESSAGE_TYPE + 1)),
+        _mm_cmpeq_epi32(type, _mm_set1_epi32(MSG_TEST)));
+
+    LaneMasks masks;
+    masks.magic = movemask(_mm_cmpeq_epi32(magic, _mm_set1_epi32(static_cast<int>(MAGIC_WORD))));
+    masks.version = movemask(version_ok);
+    masks.length = movemask(_mm_cmpeq_epi32(length, expected));
+    masks.type = movemask(type_ok);
+    return masks;
+}
+
+#else
+
+LaneMasks checkLanes(const Lanes& lanes) noexcept {
+    LaneMasks masks{0, 0, 0, 0};
+    for (size_t lane = 0; lane < LANES; lane++) {
+        const uint32_t version = lanes.version_type[lane] & 0xFFFF;
+        const uint32_t type = lanes.version_type[lane] >> 16;
+        masks.magic |= static_cast<unsigned>(lanes.magic[lane] == MAGIC_WORD) << lane;
+        masks.version |= static_cast<unsigned>(version - 1 < MessageValidator::MAX_VERSION) << lane;
+        masks.length |= static_cast<unsigned>(lanes.length[lane] == lanes.expected[lane]) << lane;
+        masks.type |= static_cast<unsigned>(
+            type - MessageValidator::MIN_MESSAGE_TYPE <
+                static_cast<uint32_t>(MessageValidator::MAX_MESSAGE_TYPE - MessageValidator::MIN_MESSAGE_TYPE + 1) ||
+            type == MSG_TEST) << lane;
+    }
+    return masks;
+}
+
+#endif
+
+ValidationResult laneResult(const LaneMasks& masks, unsigned too_short, size_t lane) noexcept {
+    const unsigned bit = 1u << lane;
+    if (too_short & bit) {
+        return ValidationResult::TOO_SHORT;
+    }
+    if (!(masks.magic & bit)) {
+        return ValidationResult::BAD_MAGIC;
+    }
+    if (!(masks.version & bit)) {
+        return ValidationResult::BAD_VERSION;
+    }
+    if (!(masks.length & bit)) {
+        return ValidationResult::BAD_LENGTH;
+    }
+    if (!(masks.type & bit)) {
+        return ValidationResult::BAD_TYPE;
+    }
+    return ValidationResult::OK;
+}
+
+} // namespace
+
+ValidationResult MessageValidator::validate(const MessageView& view) noexcept {
+    ValidationResult result;
+    validateBatch(&view, 1, &result);
+    return result;
+}
+
+size_t MessageValidator::validateBatch(const MessageView* views, size_t count,
+                                       ValidationResult* results) noexcept {
+    size_t valid = 0;
+
+    for (size_t base = 0; base < count; base += LANES) {
+        const size_t lanes_used = count - base < LANES ? count - base : LANES;
+
+        Lanes lanes;
+        gather(views + base, lanes_used, lanes);
+        const LaneMasks masks = checkLanes(lanes);
+        const unsigned used_bits = (1u << lanes_used) - 1;
+
+        // Common case: every lane passes → no per-lane branching
+        const bool all_pass = (masks.magic & masks.version & masks.length & masks.type
+                               & ~lanes.too_short & used_bits) == used_bits;
+
+        for (size_t lane = 0; lane < lanes_used; lane++) {
+            const MessageView& view = views[base + lane];
+            ValidationResult result = all_pass ? ValidationResult::OK
+                                               : laneResult(masks, lanes.too_short, lane);
+            if (result == ValidationResult::OK && view.header->hasChecksum()) {
+                result = checkChecksum(view);
+            }
+            if (result == ValidationResult::OK) {
+                valid++;
+            } else {
+                record(result);
+            }
+            results[base + lane] = result;
+        }
+    }
+
+    bump(checked_, count);
+    return valid;
+}
+
+ValidationResult MessageValidator::checkChecksum(const MessageView& view) noexcept {
+    bump(checksums_verified_);
+    return verifyMessageChecksum(view.header, view.payload, view.payload_length)
+        ? ValidationResult::OK : ValidationResult::BAD_CHECKSUM;
+}
+
+MessageValidator::Statistics MessageValidator::getStatistics() const noexcept {
+    Statistics stats;
+    stats.checked = checked_.load(std::memory_order_relaxed);
+    stats.checksums_verified = checksums_verified_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < VALIDATION_RESULT_COUNT; i++) {
+        stats.failures[i] = failures_[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+const char* MessageValidator::reasonName(ValidationResult result) noexcept {
+    switch (result) {
+        case ValidationResult::OK:           return "ok";
+        case ValidationResult::TOO_SHORT:    return "too short";
+        case ValidationResult::BAD_MAGIC:    return "bad magic";
+        case ValidationResult::BAD_VERSION:  return "bad version";
+        case ValidationResult::BAD_LENGTH:   return "bad length";
+        case ValidationResult::BAD_TYPE:     return "bad type";
+        case ValidationResult::BAD_CHECKSUM: return "bad checksum";
+        case ValidationResult::COUNT:        break;
+    }
+    return "unknown";
+}
+
+void MessageValidator::printStatistics(const char* prefix) const {
+    const Statistics stats = getStatistics();
+    std::cout << prefix << "Validated:           " << stats.checked
+              << " (" << stats.checksums_verified << " checksums, "
+              << stats.invalid() << " invalid)" << std::endl;
+    for (size_t i = 1; i < VALIDATION_RESULT_COUNT; i++) {
+        if (stats.failures[i] > 0) {
+            std::cout << prefix << "  " << reasonName(static_cast<ValidationResult>(i))
+                      << ": " << stats.failures[i] << std::endl;
+        }
+    }
+}
+
+} // namespace example
+} // namespace aeron
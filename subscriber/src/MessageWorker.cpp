@@ -5,6 +5,8 @@
  */
 
 #include "MessageWorker.h"
+#include "NanoClock.h"
+#include "AeronConfig.h"
 #include <iostream>
 #include <iomanip>
 #include <chrono>
@@ -16,25 +18,89 @@ MessageWorker::MessageWorker(
     MessageBufferQueue& queue,
     MessageBufferPool& pool,
     MessageStatsQueue& stats_queue)
-    : message_queue_(queue)
-    , buffer_pool_(pool)
+    : message_queue_(&queue)
+    , buffer_pool_(&pool)
+    , view_queue_(nullptr)
+    , ring_(nullptr)
+    , recovered_queue_(nullptr)
     , stats_queue_(stats_queue)
     , running_(false)
+    , dedup_(AeronConfig::WORKER_DEDUP_WINDOW, AeronConfig::WORKER_DEDUP_MAX_SOURCES)
     , messages_processed_(0)
     , messages_invalid_(0)
     , messages_duplicate_(0)
+    , messages_recovered_(0)
     , queue_empty_count_(0)
     , total_processing_time_ns_(0)
     , processing_count_(0)
     , total_queue_depth_(0)
     , queue_depth_samples_(0) {
 
-    // Pre-allocate duplicate detection hash table
-    seen_sequences_.reserve(100000);
+    IdleStrategyConfig idle_config;
+    idle_config.name = "backoff";
+    idle_strategy_ = IdleStrategy::create(idle_config);
 
     std::cout << "MessageWorker created" << std::endl;
 }
 
+MessageWorker::MessageWorker(
+    InPlaceMessageQueue& view_queue,
+    MessageStatsQueue& stats_queue,
+    MessageBufferPool* reassembly_pool)
+    : message_queue_(nullptr)
+    , buffer_pool_(reassembly_pool)
+    , view_queue_(&view_queue)
+    , ring_(nullptr)
+    , recovered_queue_(nullptr)
+    , stats_queue_(stats_queue)
+    , running_(false)
+    , dedup_(AeronConfig::WORKER_DEDUP_WINDOW, AeronConfig::WORKER_DEDUP_MAX_SOURCES)
+    , messages_processed_(0)
+    , messages_invalid_(0)
+    , messages_duplicate_(0)
+    , messages_recovered_(0)
+    , queue_empty_count_(0)
+    , total_processing_time_ns_(0)
+    , processing_count_(0)
+    , total_queue_depth_(0)
+    , queue_depth_samples_(0) {
+
+    IdleStrategyConfig idle_config;
+    idle_config.name = "backoff";
+    idle_strategy_ = IdleStrategy::create(idle_config);
+
+    std::cout << "MessageWorker created (in-place mode)" << std::endl;
+}
+
+MessageWorker::MessageWorker(
+    MessageRingBuffer& ring,
+    MessageStatsQueue& stats_queue,
+    MessageBufferPool* pool)
+    : message_queue_(nullptr)
+    , buffer_pool_(pool)
+    , view_queue_(nullptr)
+    , ring_(&ring)
+    , recovered_queue_(nullptr)
+    , stats_queue_(stats_queue)
+    , running_(false)
+    , dedup_(AeronConfig::WORKER_DEDUP_WINDOW, AeronConfig::WORKER_DEDUP_MAX_SOURCES)
+    , messages_processed_(0)
+    , messages_invalid_(0)
+    , messages_duplicate_(0)
+    , messages_recovered_(0)
+    , queue_empty_count_(0)
+    , total_processing_time_ns_(0)
+    , processing_count_(0)
+    , total_queue_depth_(0)
+    , queue_depth_samples_(0) {
+
+    IdleStrategyConfig idle_config;
+    idle_config.name = "backoff";
+    idle_strategy_ = IdleStrategy::create(idle_config);
+
+    std::cout << "MessageWorker created (byte ring mode)" << std::endl;
+}
+
 MessageWorker::~MessageWorker() {
     stop();
 }
@@ -44,12 +110,78 @@ void MessageWorker::setMessageHandler(MessageHandler handler) {
     std::cout << "Message handler registered" << std::endl;
 }
 
+void MessageWorker::setViewHandler(ViewHandler handler) {
+    view_handler_ = std::move(handler);
+    std::cout << "View handler registered" << std::endl;
+}
+
+void MessageWorker::setIdleStrategy(std::unique_ptr<IdleStrategy> strategy) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "Cannot change idle strategy while worker is running" << std::endl;
+        return;
+    }
+    idle_strategy_ = std::move(strategy);
+    std::cout << "Worker idle strategy: " << idle_strategy_->name() << std::endl;
+}
+
+IdleStats MessageWorker::getIdleStats() const {
+    return idle_strategy_->stats();
+}
+
+void MessageWorker::setThreadSettings(const std::string& name, const ThreadSettings& settings) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "Cannot change thread settings while worker is running" << std::endl;
+        return;
+    }
+    thread_name_ = name;
+    thread_settings_ = settings;
+}
+
+void MessageWorker::setRecoveredQueue(MessageBufferQueue* queue) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "Cannot set recovered queue while worker is running" << std::endl;
+        return;
+    }
+    if (queue && !buffer_pool_) {
+        std::cerr << "Recovered queue requires a buffer pool" << std::endl;
+        return;
+    }
+    recovered_queue_ = queue;
+}
+
+void MessageWorker::setValidation(bool enabled) {
+    if (running_.load(std::memory_order_acquire)) {
+        std::cerr << "Cannot change validation while worker is running" << std::endl;
+        return;
+    }
+    validation_enabled_ = enabled;
+}
+
 void MessageWorker::start() {
     if (running_.load(std::memory_order_acquire)) {
         std::cerr << "Worker already running" << std::endl;
         return;
     }
 
+    // park: producers of this worker's queues ring its doorbell
+    auto* parking = dynamic_cast<ParkingIdleStrategy*>(idle_strategy_.get());
+    if (parking && !doorbell_attached_) {
+        if (message_queue_) {
+            message_queue_->setDoorbell(&doorbell_);
+            if (recovered_queue_) {
+                recovered_queue_->setDoorbell(&doorbell_);
+            }
+            parking->attach(&doorbell_, [this]() {
+                return !message_queue_->empty()
+                    || (recovered_queue_ && !recovered_queue_->empty());
+            });
+            doorbell_attached_ = true;
+        } else {
+            std::cerr << "WARNING: park idle strategy needs a message queue (copy mode);"
+                      << " worker wakes only on the park timeout" << std::endl;
+        }
+    }
+
     running_.store(true, std::memory_order_release);
 
     // Create worker thread
@@ -66,8 +198,9 @@ void MessageWorker::stop() {
 
     std::cout << "\nStopping worker thread..." << std::endl;
 
-    // Signal thread to stop
+    // Signal thread to stop (and wake it if parked)
     running_.store(false, std::memory_order_release);
+    doorbell_.ring();
 
     // Wait for thread to finish
     if (worker_thread_ && worker_thread_->joinable()) {
@@ -83,161 +216,206 @@ bool MessageWorker::isRunning() const {
 }
 
 void MessageWorker::workerThreadMain() {
+    ThreadUtil::configureCurrentThread(thread_name_, thread_settings_);
     std::cout << "Worker thread running (TID: " << std::this_thread::get_id() << ")" << std::endl;
 
-    MessageBuffer* msg_buf = nullptr;
-    uint64_t empty_count = 0;
-
     while (running_.load(std::memory_order_acquire)) {
         // 1. Sample queue depth for monitoring
-        size_t queue_depth = message_queue_.size();
+        size_t queue_depth = view_queue_ ? view_queue_->size()
+            : ring_ ? ring_->size() : message_queue_->size();
         total_queue_depth_ += queue_depth;
         queue_depth_samples_++;
 
-        // 2. Dequeue message (~50ns)
-        if (!message_queue_.dequeue(msg_buf)) {
-            // Queue empty - adaptive wait
+        // 2. Drain + process a burst of messages
+        size_t processed = view_queue_ ? drainViewQueue()
+            : ring_ ? drainRing() : drainBufferQueue(*message_queue_, validation_enabled_);
+
+        // Gap fill output (arrives after the live messages that followed the gap;
+        // never seen by the subscriber thread, so always validated here)
+        if (recovered_queue_) {
+            const size_t recovered = drainBufferQueue(*recovered_queue_, true);
+            messages_recovered_.fetch_add(recovered, std::memory_order_relaxed);
+            processed += recovered;
+        }
+
+        if (processed == 0) {
             queue_empty_count_.fetch_add(1, std::memory_order_relaxed);
-            empty_count++;
-
-            if (empty_count < 100) {
-                // Busy spin for a bit
-                std::this_thread::yield();
-            } else {
-                // Sleep briefly to avoid busy loop
-                std::this_thread::sleep_for(std::chrono::microseconds(10));
+
+            // Freed buffers parked in this thread's magazine back to the
+            // shared list, so the subscriber can allocate them
+            if (buffer_pool_) {
+                buffer_pool_->flushThreadCache();
             }
-            continue;
         }
 
-        empty_count = 0;
+        // 3. Queue empty - wait per idle strategy (processed > 0 resets backoff)
+        idle_strategy_->idle(static_cast<int>(processed));
+    }
 
-        // Record dequeue timestamp for queuing latency measurement
-        msg_buf->worker_dequeue_time_ns = getCurrentTimeNanos();
+    if (buffer_pool_) {
+        buffer_pool_->flushThreadCache();
+    }
 
-        // 3. Validate message (~200ns)
-        if (!validateMessage(msg_buf)) {
-            messages_invalid_.fetch_add(1, std::memory_order_relaxed);
-            buffer_pool_.deallocate(msg_buf);
-            continue;
-        }
+    std::cout << "Worker thread exiting (processed "
+              << messages_processed_.load(std::memory_order_relaxed)
+              << " messages)" << std::endl;
+}
 
-        // 4. Duplicate detection (~50ns with hash table)
-        if (checkDuplicate(msg_buf)) {
-            messages_duplicate_.fetch_add(1, std::memory_order_relaxed);
-            buffer_pool_.deallocate(msg_buf);
-            continue;
-        }
+size_t MessageWorker::drainBufferQueue(MessageBufferQueue& queue, bool validate) {
+    // Drain burst (~50ns per burst for the queue itself)
+    size_t count = 0;
+    queue.drainTo([this, &count](BufferId id) {
+        const MessageBuffer msg_buf = buffer_pool_->resolve(id);
 
-        // 5. Process message (variable time)
-        auto start_processing = getCurrentTimeNanos();
-        processMessage(msg_buf);
-        auto end_processing = getCurrentTimeNanos();
+        // Record dequeue timestamp for queuing latency measurement
+        msg_buf.descriptor->worker_dequeue_time_ns = NanoClock::nanoTime();
 
-        // Update processing time stats
-        total_processing_time_ns_ += (end_processing - start_processing);
-        processing_count_++;
+        burst_buffers_[count] = msg_buf;
+        burst_views_[count] = makeView(msg_buf);
+        count++;
+    }, DRAIN_BATCH_LIMIT);
 
-        // 6. Send to monitoring (~50ns)
-        sendToMonitoring(msg_buf);
+    // Validate the whole burst at once (4 headers per compare)
+    validateBurst(count, validate);
 
-        // 7. Return buffer to pool (~100ns)
-        buffer_pool_.deallocate(msg_buf);
+    for (size_t i = 0; i < count; i++) {
+        processView(burst_views_[i], &burst_buffers_[i], burst_results_[i]);
 
-        // 8. Update statistics
-        messages_processed_.fetch_add(1, std::memory_order_relaxed);
+        // Return buffer to pool (~100ns)
+        buffer_pool_->deallocate(burst_buffers_[i].id);
     }
-
-    std::cout << "Worker thread exiting (processed "
-              << messages_processed_.load(std::memory_order_relaxed)
-              << " messages)" << std::endl;
+    return count;
 }
 
-bool MessageWorker::validateMessage(const MessageBuffer* buf) {
-    if (!buf) {
-        return false;
-    }
+size_t MessageWorker::drainViewQueue() {
+    int64_t last_position = 0;
+    size_t count = 0;
 
-    // TEMPORARY: Disable strict validation for testing with existing publisher
-    // The existing publisher sends simple text messages without MessageHeader format
-    //
-    // For production, uncomment the validation code below:
-    /*
-    // Check magic
-    if (!buf->header.isValid()) {
-        return false;
-    }
+    // Term buffer stays valid until release(): views are processed after the drain
+    size_t drained = view_queue_->drainTo([&](const MessageView& view) {
+        last_position = view.position;
 
-    // Check version
-    if (buf->header.version == 0 || buf->header.version > 100) {
-        return false;
+        // Duplicates (and messages rejected by the subscriber thread) are
+        // only enqueued for their position
+        if (view.discard) {
+            if (view.owned_buffer != INVALID_BUFFER_ID) {
+                buffer_pool_->deallocate(view.owned_buffer);
+            }
+            return;
+        }
+        burst_views_[count++] = view;
+    }, DRAIN_BATCH_LIMIT);
+
+    validateBurst(count, validation_enabled_);
+
+    for (size_t i = 0; i < count; i++) {
+        // Reassembled message: copy lives in the pool, not the term buffer
+        const MessageView& view = burst_views_[i];
+        if (view.owned_buffer != INVALID_BUFFER_ID) {
+            const MessageBuffer owned_buffer = buffer_pool_->resolve(view.owned_buffer);
+            processView(view, &owned_buffer, burst_results_[i]);
+            buffer_pool_->deallocate(view.owned_buffer);
+        } else {
+            processView(view, nullptr, burst_results_[i]);
+        }
     }
 
-    // Check message type
-    if (buf->header.message_type == 0) {
-        return false;
+    // Hand the term buffer region back to the subscriber thread (once per burst)
+    if (drained > 0) {
+        view_queue_->release(last_position);
     }
+    return drained;
+}
 
-    // Check message length
-    if (buf->header.message_length > sizeof(MessageHeader) + MAX_PAYLOAD_SIZE) {
-        return false;
-    }
+size_t MessageWorker::drainRing() {
+    // Records are consumed sequentially from one contiguous array; the
+    // ring head is published once per burst (frees the bytes for the subscriber)
+    return ring_->read([this](const uint8_t* data, size_t length,
+                              uint16_t stream_index, int64_t recv_time_ns) {
+        MessageView view = MessageView::fromAeron(data, length, recv_time_ns, 0);
+        view.stream_index = stream_index;
+
+        // Records are only valid inside read(): validated one at a time
+        ValidationResult result;
+        if (validation_enabled_) {
+            result = validator_.validate(view);
+        } else {
+            result = view.header ? ValidationResult::OK : ValidationResult::TOO_SHORT;
+        }
+        processView(view, nullptr, result);
+    }, DRAIN_BATCH_LIMIT);
+}
 
-    // Verify checksum if enabled
-    if (buf->header.hasChecksum()) {
-        // TODO: Implement CRC32 verification
-        // For now, skip checksum validation
+void MessageWorker::validateBurst(size_t count, bool validate) {
+    if (validate) {
+        // Structural checks batched, checksums only where flagged (~2ns + CRC)
+        validator_.validateBatch(burst_views_, count, burst_results_);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        burst_results_[i] = burst_views_[i].header ? ValidationResult::OK : ValidationResult::TOO_SHORT;
     }
-    */
-
-    // Accept all messages for testing
-    return true;
 }
 
-bool MessageWorker::checkDuplicate(const MessageBuffer* buf) {
-    uint64_t seq = buf->header.sequence_number;
+void MessageWorker::processView(const MessageView& view, const MessageBuffer* buf,
+                                ValidationResult result) {
+    // 3. Validation result (counted per reason by the validator)
+    if (result != ValidationResult::OK) {
+        messages_invalid_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    // Check if already seen
-    if (seen_sequences_.count(seq) > 0) {
-        return true;  // Duplicate
+    // 4. Duplicate detection (~5ns, per-source bitmap)
+    if (checkDuplicate(view)) {
+        messages_duplicate_.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
 
-    // Add to seen set
-    seen_sequences_.insert(seq);
+    // 5. Process message (variable time)
+    auto start_processing = NanoClock::nanoTime();
+    processMessage(view, buf);
+    auto end_processing = NanoClock::nanoTime();
 
-    // Optional: Trim old sequences if set grows too large
-    // (In production, use a sliding window or time-based expiration)
-    if (seen_sequences_.size() > 1000000) {
-        // Clear oldest half (simple strategy)
-        // TODO: Implement proper LRU or time-based eviction
-        seen_sequences_.clear();
-        std::cout << "⚠️  Duplicate detection set cleared (size limit reached)" << std::endl;
-    }
+    // Update processing time stats
+    total_processing_time_ns_ += (end_processing - start_processing);
+    processing_count_++;
+
+    // 6. Send to monitoring (~50ns)
+    sendToMonitoring(view);
 
-    return false;  // Not duplicate
+    // 7. Update statistics
+    messages_processed_.fetch_add(1, std::memory_order_relaxed);
 }
 
-void MessageWorker::processMessage(const MessageBuffer* buf) {
+bool MessageWorker::checkDuplicate(const MessageView& view) {
+    // Keyed by source: streams share one queue in multi-stream mode, and a
+    // restarted publisher (new session) starts its sequence over (~5ns)
+    const MessageHeader& header = *view.header;
+    return dedup_.checkAndInsert(view.stream_index, header.publisher_id, header.session_id,
+                                 static_cast<int64_t>(header.sequence_number));
+}
+
+void MessageWorker::processMessage(const MessageView& view, const MessageBuffer* buf) {
     // Dispatch based on message type
-    switch (buf->header.message_type) {
+    switch (view.header->message_type) {
         case MSG_ORDER_NEW:
-            handleOrderNew(buf);
+            handleOrderNew(view);
             break;
 
         case MSG_ORDER_EXECUTION:
-            handleOrderExecution(buf);
+            handleOrderExecution(view);
             break;
 
         case MSG_ORDER_MODIFY:
-            handleOrderModify(buf);
+            handleOrderModify(view);
             break;
 
         case MSG_ORDER_CANCEL:
-            handleOrderCancel(buf);
+            handleOrderCancel(view);
             break;
 
         case MSG_QUOTE_UPDATE:
-            handleQuoteUpdate(buf);
+            handleQuoteUpdate(view);
             break;
 
         case MSG_TEST:
@@ -245,23 +423,27 @@ void MessageWorker::processMessage(const MessageBuffer* buf) {
             break;
 
         default:
-            std::cerr << "Unknown message type: " << buf->header.message_type << std::endl;
+            std::cerr << "Unknown message type: " << view.header->message_type << std::endl;
             break;
     }
 
-    // Call user-provided handler if registered
-    if (message_handler_) {
+    // Call user-provided handlers if registered
+    if (message_handler_ && buf) {
         message_handler_(buf);
     }
+    if (view_handler_) {
+        view_handler_(view);
+    }
 }
 
-void MessageWorker::sendToMonitoring(const MessageBuffer* buf) {
+void MessageWorker::sendToMonitoring(const MessageView& view) {
     // Create monitoring stats
     MessageStats stats;
-    stats.message_number = buf->header.sequence_number;
-    stats.send_timestamp = buf->header.publish_time_ns;
-    stats.recv_timestamp = buf->header.recv_time_ns;
-    stats.position = 0;  // Position not available in zero-copy mode
+    stats.message_number = view.header->sequence_number;
+    stats.send_timestamp = view.header->publish_time_ns;
+    stats.recv_timestamp = view.recv_time_ns;
+    stats.position = view.position;  // 0 in copy mode
+    stats.event_timestamp = view.header->event_time_ns;
 
     // Non-blocking enqueue
     if (!stats_queue_.enqueue(stats)) {
@@ -272,7 +454,7 @@ void MessageWorker::sendToMonitoring(const MessageBuffer* buf) {
 
 // Message type handlers (placeholders - customize for your business logic)
 
-void MessageWorker::handleOrderNew(const MessageBuffer* buf) {
+void MessageWorker::handleOrderNew([[maybe_unused]] const MessageView& view) {
     // TODO: Implement order new logic
     // Example:
     // - Parse order details from payload
@@ -281,7 +463,7 @@ void MessageWorker::handleOrderNew(const MessageBuffer* buf) {
     // - Send confirmation
 }
 
-void MessageWorker::handleOrderExecution(const MessageBuffer* buf) {
+void MessageWorker::handleOrderExecution([[maybe_unused]] const MessageView& view) {
     // TODO: Implement order execution logic
     // Example:
     // - Parse execution details
@@ -290,15 +472,15 @@ void MessageWorker::handleOrderExecution(const MessageBuffer* buf) {
     // - Send execution report
 }
 
-void MessageWorker::handleOrderModify(const MessageBuffer* buf) {
+void MessageWorker::handleOrderModify([[maybe_unused]] const MessageView& view) {
     // TODO: Implement order modify logic
 }
 
-void MessageWorker::handleOrderCancel(const MessageBuffer* buf) {
+void MessageWorker::handleOrderCancel([[maybe_unused]] const MessageView& view) {
     // TODO: Implement order cancel logic
 }
 
-void MessageWorker::handleQuoteUpdate(const MessageBuffer* buf) {
+void MessageWorker::handleQuoteUpdate([[maybe_unused]] const MessageView& view) {
     // TODO: Implement quote update logic
 }
 
@@ -307,6 +489,7 @@ MessageWorker::Statistics MessageWorker::getStatistics() const {
     stats.messages_processed = messages_processed_.load(std::memory_order_relaxed);
     stats.messages_invalid = messages_invalid_.load(std::memory_order_relaxed);
     stats.messages_duplicate = messages_duplicate_.load(std::memory_order_relaxed);
+    stats.messages_recovered = messages_recovered_.load(std::memory_order_relaxed);
     stats.queue_empty_count = queue_empty_count_.load(std::memory_order_relaxed);
 
     if (processing_count_ > 0) {
@@ -332,8 +515,19 @@ void MessageWorker::printStatistics() const {
     std::cout << "\n=== Worker Thread Statistics ===" << std::endl;
     std::cout << "Messages processed:  " << stats.messages_processed << std::endl;
     std::cout << "Messages invalid:    " << stats.messages_invalid << std::endl;
+    validator_.printStatistics("");
     std::cout << "Messages duplicate:  " << stats.messages_duplicate << std::endl;
+    if (recovered_queue_) {
+        std::cout << "Messages recovered:  " << stats.messages_recovered << std::endl;
+    }
     std::cout << "Queue empty count:   " << stats.queue_empty_count << std::endl;
+    std::cout << "Idle strategy:       " << idle_strategy_->name() << std::endl;
+    if (doorbell_attached_) {
+        const Doorbell::Statistics bell = doorbell_.getStatistics();
+        std::cout << "Doorbell:            " << bell.parks << " parks ("
+                  << bell.timeouts << " timed out, " << bell.cancelled_parks
+                  << " cancelled), " << bell.wakeups << " wakeups" << std::endl;
+    }
 
     if (stats.messages_processed > 0) {
         std::cout << std::fixed << std::setprecision(2);
@@ -351,6 +545,15 @@ void MessageWorker::printStatistics() const {
                   << " duplicate messages filtered" << std::endl;
     }
 
+    const DedupTable::Statistics dedup = dedup_.getStatistics();
+    std::cout << "Dedup sources:       " << dedup.sources
+              << " (evicted " << dedup.evictions << ", "
+              << dedup.memory_bytes / 1024 << " KB)" << std::endl;
+    if (dedup.too_old > 0) {
+        std::cout << "Dedup too old:       " << dedup.too_old
+                  << " (below window, dropped)" << std::endl;
+    }
+
     std::cout << "=================================\n" << std::endl;
 }
 
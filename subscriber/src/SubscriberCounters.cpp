@@ -0,0 +1,175 @@
+/**
+ * SubscriberCounters.cpp
+ *
+ * Component statistics → shared-memory counters (single writer)
+ */
+
+#include "SubscriberCounters.h"
+#include "GapFillAgent.h"
+
+namespace aeron {
+namespace example {
+
+void SubscriberCounters::addSubscriber(const AeronSubscriber& subscriber) {
+    Counter received = file_.allocate("subscriber: messages received");
+    Counter allocation_failures = file_.allocate("subscriber: buffer allocation failures");
+    Counter queue_full = file_.allocate("subscriber: queue full failures");
+    Counter inplace_aborts = file_.allocate("subscriber: in-place peek aborts");
+    Counter reassembled = file_.allocate("subscriber: reassembled messages");
+    Counter reassembly_drops = file_.allocate("subscriber: reassembly drops");
+    Counter batches_unpacked = file_.allocate("subscriber: batches unpacked");
+    Counter batch_errors = file_.allocate("subscriber: batch errors");
+    Counter backpressure_episodes = file_.allocate("subscriber: backpressure episodes");
+    Counter backpressure_ns = file_.allocate("subscriber: backpressure ns");
+
+    updaters_.push_back([&subscriber, received, allocation_failures, queue_full, inplace_aborts,
+                         reassembled, reassembly_drops, batches_unpacked, batch_errors,
+                         backpressure_episodes, backpressure_ns]() mutable {
+        const auto stats = subscriber.getZeroCopyStats();
+        received.set(static_cast<int64_t>(stats.messages_received));
+        allocation_failures.set(static_cast<int64_t>(stats.buffer_allocation_failures));
+        queue_full.set(static_cast<int64_t>(stats.queue_full_failures));
+        inplace_aborts.set(static_cast<int64_t>(stats.inplace_aborts));
+        reassembled.set(static_cast<int64_t>(stats.reassembled_messages));
+        reassembly_drops.set(static_cast<int64_t>(stats.reassembly_drops));
+        batches_unpacked.set(static_cast<int64_t>(stats.batches_unpacked));
+        batch_errors.set(static_cast<int64_t>(stats.batch_errors));
+        backpressure_episodes.set(static_cast<int64_t>(stats.backpressure_episodes));
+        backpressure_ns.set(static_cast<int64_t>(stats.backpressure_total_ns));
+    });
+
+    // Per stream: gaps / duplicates are only tracked here
+    struct StreamCounters {
+        Counter received;
+        Counter gaps;
+        Counter duplicates;
+        Counter queue_full;
+    };
+    std::vector<StreamCounters> streams;
+    for (const auto& stats : subscriber.getStreamStats()) {
+        const std::string prefix = "stream " + stats.name + ": ";
+        streams.push_back({file_.allocate(prefix + "messages received"),
+                           file_.allocate(prefix + "gaps detected"),
+                           file_.allocate(prefix + "duplicates detected"),
+                           file_.allocate(prefix + "queue full failures")});
+    }
+    updaters_.push_back([&subscriber, streams]() mutable {
+        const auto all = subscriber.getStreamStats();
+        for (size_t i = 0; i < all.size() && i < streams.size(); i++) {
+            streams[i].received.set(static_cast<int64_t>(all[i].messages_received));
+            streams[i].gaps.set(static_cast<int64_t>(all[i].gaps_detected));
+            streams[i].duplicates.set(static_cast<int64_t>(all[i].duplicates_detected));
+            streams[i].queue_full.set(static_cast<int64_t>(all[i].queue_full_failures));
+        }
+    });
+
+    const GapFillAgent* gap_fill = subscriber.getGapFillAgent();
+    if (gap_fill) {
+        Counter requests = file_.allocate("gap fill: requests");
+        Counter requests_dropped = file_.allocate("gap fill: requests dropped");
+        Counter replay_failures = file_.allocate("gap fill: replay failures");
+        Counter recovered = file_.allocate("gap fill: messages recovered");
+        Counter unrecovered = file_.allocate("gap fill: messages unrecovered");
+        Counter output_drops = file_.allocate("gap fill: output drops");
+
+        updaters_.push_back([gap_fill, requests, requests_dropped, replay_failures,
+                             recovered, unrecovered, output_drops]() mutable {
+            const auto stats = gap_fill->getStatistics();
+            requests.set(static_cast<int64_t>(stats.requests));
+            requests_dropped.set(static_cast<int64_t>(stats.requests_dropped));
+            replay_failures.set(static_cast<int64_t>(stats.replay_failures + stats.replay_timeouts));
+            recovered.set(static_cast<int64_t>(stats.messages_recovered));
+            unrecovered.set(static_cast<int64_t>(stats.messages_unrecovered));
+            output_drops.set(static_cast<int64_t>(stats.output_drops));
+        });
+    }
+}
+
+void SubscriberCounters::addWorker(const std::string& name, const MessageWorker& worker) {
+    Counter processed = file_.allocate(name + ": messages processed");
+    Counter invalid = file_.allocate(name + ": messages invalid");
+    Counter duplicate = file_.allocate(name + ": messages duplicate");
+    Counter recovered = file_.allocate(name + ": messages recovered");
+
+    updaters_.push_back([&worker, processed, invalid, duplicate, recovered]() mutable {
+        const auto stats = worker.getStatistics();
+        processed.set(static_cast<int64_t>(stats.messages_processed));
+        invalid.set(static_cast<int64_t>(stats.messages_invalid));
+        duplicate.set(static_cast<int64_t>(stats.messages_duplicate));
+        recovered.set(static_cast<int64_t>(stats.messages_recovered));
+    });
+
+    addValidator(name, worker.validator());
+}
+
+void SubscriberCounters::addValidator(const std::string& name, const MessageValidator& validator) {
+    Counter checked = file_.allocate(name + ": messages validated");
+    Counter checksums = file_.allocate(name + ": checksums verified");
+    std::vector<Counter> failures;
+    for (size_t i = 1; i < VALIDATION_RESULT_COUNT; i++) {
+        failures.push_back(file_.allocate(
+            name + ": invalid " + MessageValidator::reasonName(static_cast<ValidationResult>(i))));
+    }
+
+    updaters_.push_back([&validator, checked, checksums, failures]() mutable {
+        const auto stats = validator.getStatistics();
+        checked.set(static_cast<int64_t>(stats.checked));
+        checksums.set(static_cast<int64_t>(stats.checksums_verified));
+        for (size_t i = 1; i < VALIDATION_RESULT_COUNT; i++) {
+            failures[i - 1].set(static_cast<int64_t>(stats.failures[i]));
+        }
+    });
+}
+
+void SubscriberCounters::addPool(const MessageBufferPool& pool) {
+    Counter in_use = file_.allocate("buffer pool: buffers in use", CounterType::GAUGE);
+    Counter capacity = file_.allocate("buffer pool: capacity", CounterType::GAUGE);
+    Counter spills = file_.allocate("buffer pool: spills to larger class");
+    Counter oversize = file_.allocate("buffer pool: oversize requests");
+    capacity.set(static_cast<int64_t>(pool.capacity()));
+
+    updaters_.push_back([&pool, in_use, spills, oversize]() mutable {
+        in_use.set(static_cast<int64_t>(pool.capacity() - pool.available()));
+        spills.set(static_cast<int64_t>(pool.spills()));
+        oversize.set(static_cast<int64_t>(pool.oversizeRequests()));
+    });
+}
+
+void SubscriberCounters::addShardRouter(const ShardRouter& router) {
+    std::vector<Counter> routed;
+    std::vector<Counter> drops;
+    for (size_t i = 0; i < router.shardCount(); i++) {
+        const std::string prefix = "shard " + std::to_string(i) + ": ";
+        routed.push_back(file_.allocate(prefix + "messages routed"));
+        drops.push_back(file_.allocate(prefix + "drops"));
+    }
+
+    updaters_.push_back([&router, routed, drops]() mutable {
+        for (size_t i = 0; i < routed.size(); i++) {
+            routed[i].set(static_cast<int64_t>(router.routed(i)));
+            drops[i].set(static_cast<int64_t>(router.drops(i)));
+        }
+    });
+}
+
+void SubscriberCounters::addRing(const std::string& name, const MessageRingBuffer& ring) {
+    Counter used = file_.allocate(name + ": used bytes", CounterType::GAUGE);
+    Counter capacity = file_.allocate(name + ": capacity bytes", CounterType::GAUGE);
+    Counter depth = file_.allocate(name + ": records queued", CounterType::GAUGE);
+    capacity.set(static_cast<int64_t>(ring.capacity()));
+
+    updaters_.push_back([&ring, used, depth]() mutable {
+        used.set(static_cast<int64_t>(ring.usedBytes()));
+        depth.set(static_cast<int64_t>(ring.size()));
+    });
+}
+
+void SubscriberCounters::update() {
+    for (auto& updater : updaters_) {
+        updater();
+    }
+    file_.heartbeat();
+}
+
+} // namespace example
+} // namespace aeron
@@ -0,0 +1,218 @@
+/**
+ * WorkerGroup.cpp
+ *
+ * Key-sharded MessageWorkers with per-shard statistics and skew report
+ */
+
+#include "WorkerGroup.h"
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace aeron {
+namespace example {
+
+WorkerGroup::WorkerGroup(const ShardConfig& config,
+                         MessageBufferPool& pool,
+                         const std::vector<MessageStatsQueue*>& stats_queues,
+                         bool recovered,
+                         size_t queue_size,
+                         MemoryArena* arena)
+    : config_(config) {
+
+    if (config_.shards == 0) {
+        throw std::invalid_argument("Worker group needs at least one shard");
+    }
+    if (stats_queues.size() < config_.shards) {
+        throw std::invalid_argument("Worker group needs one stats queue per shard");
+    }
+
+    std::vector<MessageBufferQueue*> queues;
+    std::vector<MessageBufferQueue*> recovered_queues;
+
+    shards_.resize(config_.shards);
+    for (size_t i = 0; i < shards_.size(); i++) {
+        Shard& shard = shards_[i];
+        shard.queue = std::make_unique<MessageBufferQueue>(queue_size, arena);
+        shard.worker = std::make_unique<MessageWorker>(*shard.queue, pool, *stats_queues[i]);
+        queues.push_back(shard.queue.get());
+
+        if (recovered) {
+            shard.recovered_queue = std::make_unique<MessageBufferQueue>(queue_size, arena);
+            shard.worker->setRecoveredQueue(shard.recovered_queue.get());
+            recovered_queues.push_back(shard.recovered_queue.get());
+        }
+    }
+
+    router_ = std::make_unique<ShardRouter>(config_, queues, pool);
+    if (recovered) {
+        recovered_router_ = std::make_unique<ShardRouter>(config_, recovered_queues, pool);
+    }
+
+    std::cout << "WorkerGroup: " << shards_.size() << " shards by "
+              << ShardConfig::keyName(config_.key);
+    if (config_.key == ShardKey::PAYLOAD) {
+        std::cout << " (offset " << config_.payload_offset
+                  << ", " << config_.payload_width << " bytes)";
+    }
+    std::cout << std::endl;
+}
+
+WorkerGroup::~WorkerGroup() {
+    stop();
+}
+
+void WorkerGroup::setThreadSettings(const std::string& base_name, const ThreadSettings& settings,
+                                    const std::vector<int>& cpus) {
+    for (size_t i = 0; i < shards_.size(); i++) {
+        ThreadSettings thread = settings;
+        if (i < cpus.size()) {
+            thread.cpu = cpus[i];
+        }
+        shards_[i].worker->setThreadSettings(base_name + "-" + std::to_string(i), thread);
+    }
+}
+
+void WorkerGroup::setIdleStrategy(const IdleStrategyConfig& config) {
+    for (auto& shard : shards_) {
+        shard.worker->setIdleStrategy(IdleStrategy::create(config));
+    }
+}
+
+void WorkerGroup::setValidation(bool enabled) {
+    for (auto& shard : shards_) {
+        shard.worker->setValidation(enabled);
+    }
+}
+
+void WorkerGroup::setMessageHandler(MessageWorker::MessageHandler handler) {
+    for (auto& shard : shards_) {
+        shard.worker->setMessageHandler(handler);
+    }
+}
+
+void WorkerGroup::start() {
+    for (auto& shard : shards_) {
+        shard.worker->start();
+    }
+}
+
+void WorkerGroup::stop() {
+    for (auto& shard : shards_) {
+        if (shard.worker && shard.worker->isRunning()) {
+            shard.worker->stop();
+        }
+    }
+}
+
+MessageWorker::Statistics WorkerGroup::getStatistics() const {
+    MessageWorker::Statistics total{};
+    double processing_us = 0.0;
+    double queue_depth = 0.0;
+
+    for (const auto& shard : shards_) {
+        const auto stats = shard.worker->getStatistics();
+        total.messages_processed += stats.messages_processed;
+        total.messages_invalid += stats.messages_invalid;
+        total.messages_duplicate += stats.messages_duplicate;
+        total.messages_recovered += stats.messages_recovered;
+        total.queue_empty_count += stats.queue_empty_count;
+        processing_us += stats.avg_processing_time_us * stats.messages_processed;
+        queue_depth += stats.avg_queue_depth;
+    }
+
+    if (total.messages_processed > 0) {
+        total.avg_processing_time_us = processing_us / total.messages_processed;
+    }
+    total.avg_queue_depth = queue_depth / shards_.size();
+    return total;
+}
+
+IdleStats WorkerGroup::getIdleStats() const {
+    IdleStats total{};
+    for (const auto& shard : shards_) {
+        const IdleStats stats = shard.worker->getIdleStats();
+        total.idle_calls += stats.idle_calls;
+        total.busy_calls += stats.busy_calls;
+        total.spins += stats.spins;
+        total.yields += stats.yields;
+        total.parks += stats.parks;
+    }
+    return total;
+}
+
+size_t WorkerGroup::queuedMessages() const {
+    size_t queued = 0;
+    for (const auto& shard : shards_) {
+        queued += shard.queue->size();
+    }
+    return queued;
+}
+
+size_t WorkerGroup::queueCapacity() const {
+    return shards_.size() * shards_[0].queue->capacity();
+}
+
+void WorkerGroup::printStatistics() const {
+    std::cout << "\n=== Worker Group Statistics (" << shards_.size() << " shards by "
+              << ShardConfig::keyName(config_.key) << ") ===" << std::endl;
+    std::cout << "Shard      Routed       Drops   Processed   Dup   Avg μs" << std::endl;
+
+    uint64_t total_routed = 0;
+    uint64_t max_routed = 0;
+    size_t max_shard = 0;
+
+    for (size_t i = 0; i < shards_.size(); i++) {
+        const auto stats = shards_[i].worker->getStatistics();
+        const uint64_t routed = router_->routed(i);
+        total_routed += routed;
+        if (routed > max_routed) {
+            max_routed = routed;
+            max_shard = i;
+        }
+
+        std::cout << std::setw(5) << i
+                  << std::setw(12) << routed
+                  << std::setw(12) << router_->drops(i)
+                  << std::setw(12) << stats.messages_processed
+                  << std::setw(6) << stats.messages_duplicate
+                  << std::setw(9) << std::fixed << std::setprecision(2)
+                  << stats.avg_processing_time_us << std::endl;
+    }
+
+    const auto total = getStatistics();
+    std::cout << "Total: routed " << total_routed
+              << ", processed " << total.messages_processed
+              << ", invalid " << total.messages_invalid
+              << ", duplicate " << total.messages_duplicate;
+    if (recovered_router_) {
+        std::cout << ", recovered " << total.messages_recovered;
+    }
+    std::cout << std::endl;
+
+    // Skew: busiest shard vs. an even split (1.00 = perfectly balanced)
+    if (total_routed > 0) {
+        const double mean = static_cast<double>(total_routed) / shards_.size();
+        std::cout << "Skew (max/mean): " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(max_routed) / mean
+                  << " (shard " << max_shard << ")" << std::endl;
+
+        const auto hot_keys = router_->hotKeys();
+        const size_t shown = std::min<size_t>(hot_keys.size(), 5);
+        if (shown > 0) {
+            std::cout << "Hot keys (sampled, approx.):" << std::endl;
+        }
+        for (size_t i = 0; i < shown; i++) {
+            std::cout << "  key " << hot_keys[i].key
+                      << " → shard " << hot_keys[i].shard
+                      << ", ~" << hot_keys[i].count << " msgs ("
+                      << std::setprecision(1)
+                      << 100.0 * static_cast<double>(hot_keys[i].count) / total_routed
+                      << "%)" << std::endl;
+        }
+    }
+    std::cout << "==============================================\n" << std::endl;
+}
+
+} // namespace example
+} // namespace aeron
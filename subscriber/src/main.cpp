@@ -12,23 +12,70 @@
  * - Lock-free: 모든 큐와 풀은 lock-free
  * - 3-Thread 구조: 완전 독립적 처리
  *
+ * 수신 모드:
+ * - copy (기본): Aeron fragment를 Buffer Pool로 memcpy
+ * - in-place: Worker가 term buffer를 직접 읽음 (memcpy/Pool 없음)
+ * - ring: 가변 길이 record를 연속된 byte ring에 memcpy (Pool/포인터 큐 없음)
+ *
+ * Multi-stream ([stream.<name>] 섹션):
+ * - Subscriber 스레드 하나가 모든 스트림을 한 duty cycle에서 poll
+ * - queue = dedicated 스트림은 전용 Message Queue + Worker 사용
+ *
+ * Gap fill ([gap_fill] 섹션):
+ * - Subscriber 스레드는 gap 범위만 큐에 넣음 (Archive RPC 없음)
+ * - aeron-gapfill 스레드가 Archive에서 해당 범위만 replay → Worker로 전달
+ *
+ * Worker sharding ([workers] 섹션, copy 모드):
+ * - shared queue 대신 shard별 SPSC queue + worker (shards = N)
+ * - Subscriber가 key(session / publisher / payload 필드)로 shard 선택 → key별 순서 유지
+ * - 종료 시 shard별 통계 + skew(max/mean) + hot key 출력
+ *
+ * Thread 배치 ([threads] 섹션):
+ * - 스레드별 CPU affinity / SCHED_FIFO, 이름(aeron-sub, aeron-worker, ...)
+ * - Pool/Queue는 subscriber_cpu에 고정된 상태로 할당 (NUMA first-touch)
+ *
+ * Memory ([memory] 섹션):
+ * - Pool / queue / ring 크기를 INI에서 지정 (재컴파일 불필요)
+ * - 모두 하나의 MemoryArena(mmap, 2 MB / 1 GB hugepage) 위에 할당,
+ *   시작 시 pre-fault + 선택적 mlock
+ *
+ * Counters ([counters] 섹션):
+ * - 통계를 mmap counters 파일(<aeron_dir>/subscriber.counters)에 게시
+ *   → 다른 프로세스에서 aeron_substat 로 실시간 확인
+ * - Main thread가 update_interval_ms 마다 복사 (hot path 변경 없음)
+ * - print_stats = false: 100건마다 stdout 출력 안 함
+ *
  * Usage:
  *   ./aeron_subscriber
  *   ./aeron_subscriber --replay-auto
  *   ./aeron_subscriber --config config/aeron-local.ini --replay-auto
+ *   ./aeron_subscriber --in-place
+ *   ./aeron_subscriber --ring          (receive_mode = ring)
+ *   ./aeron_subscriber --lossless      (overflow_policy = backpressure)
  */
 
 #include "AeronSubscriber.h"
 #include "MessageWorker.h"
-#include "BufferPool.h"
+#include "WorkerGroup.h"
+#include "SizeClassBufferPool.h"
 #include "MessageQueue.h"
+#include "MessageViewQueue.h"
+#include "ByteRingBuffer.h"
 #include "SPSCQueue.h"
 #include "ConfigLoader.h"
+#include "IdleStrategy.h"
+#include "ThreadUtil.h"
+#include "NanoClock.h"
+#include "MemoryArena.h"
+#include "CountersFile.h"
+#include "SubscriberCounters.h"
 #include <iostream>
 #include <thread>
 #include <atomic>
 #include <csignal>
 #include <iomanip>
+#include <memory>
+#include <vector>
 #include <getopt.h>
 
 using namespace aeron::example;
@@ -51,6 +98,9 @@ void printUsage(const char* program_name) {
               << "  --replay-auto                   Auto-discover latest recording and replay\n"
               << "  --position <pos>                Start position for ReplayMerge (default: 0)\n"
               << "  --print-config                  Print current configuration and exit\n"
+              << "  --in-place                      In-place receive (no copy, controlled peek)\n"
+              << "  --ring                          Byte ring receive (contiguous records, no pool)\n"
+              << "  --lossless                      Backpressure instead of drop when pool/queue is full\n"
               << "\nGap Recovery Options (온프레미스 최적화):\n"
               << "  --no-gap-recovery               Disable gap recovery (default: enabled)\n"
               << "  --gap-tolerance <N>             Max gaps to recover immediately (default: 5)\n"
@@ -94,6 +144,9 @@ int main(int argc, char** argv) {
     bool duplicate_check_enabled = true;  // default: enabled
     int64_t gap_tolerance_override = -1;
     int64_t duplicate_window_override = -1;
+    bool in_place_override = false;
+    bool ring_override = false;
+    bool lossless_override = false;
 
     static struct option long_options[] = {
         {"config",           required_argument, 0, 'f'},
@@ -106,6 +159,9 @@ int main(int argc, char** argv) {
         {"gap-tolerance",    required_argument, 0, 'T'},
         {"no-duplicate-check", no_argument,     0, 'D'},
         {"duplicate-window", required_argument, 0, 'W'},
+        {"in-place",         no_argument,       0, 'I'},
+        {"ring",             no_argument,       0, 'B'},
+        {"lossless",         no_argument,       0, 'L'},
         {"help",             no_argument,       0, 'h'},
         {0, 0, 0, 0}
     };
@@ -147,6 +203,15 @@ int main(int argc, char** argv) {
             case 'W':
                 duplicate_window_override = std::stoll(optarg);
                 break;
+            case 'I':
+                in_place_override = true;
+                break;
+            case 'B':
+                ring_override = true;
+                break;
+            case 'L':
+                lossless_override = true;
+                break;
             case 'h':
                 printUsage(argv[0]);
                 return 0;
@@ -176,6 +241,24 @@ int main(int argc, char** argv) {
     if (!override_archive_control.empty()) {
         aeron_settings.archive_control_request_channel = override_archive_control;
     }
+    if (in_place_override) {
+        aeron_settings.receive_mode = "in-place";
+    }
+    if (ring_override) {
+        aeron_settings.receive_mode = "ring";
+    }
+    const bool in_place = (aeron_settings.receive_mode == "in-place");
+    const bool ring = (aeron_settings.receive_mode == "ring");
+    const bool copy_mode = !in_place && !ring;
+    if (lossless_override) {
+        aeron_settings.overflow_policy = "backpressure";
+    }
+
+    if (in_place && aeron_settings.streams.size() > 1) {
+        std::cerr << "In-place receive supports a single stream ("
+                  << aeron_settings.streams.size() << " configured)" << std::endl;
+        return 1;
+    }
 
     // Print config mode
     if (print_config_only) {
@@ -191,26 +274,169 @@ int main(int argc, char** argv) {
     } else {
         std::cout << "Mode: LIVE" << std::endl;
     }
+    std::cout << "Receive: " << (in_place ? "IN-PLACE (no copy)"
+        : ring ? "RING (byte ring)" : "COPY (buffer pool)") << std::endl;
+    std::cout << "Overflow: " << (aeron_settings.overflow_policy == "backpressure"
+        ? "BACKPRESSURE (lossless)" : "DROP") << std::endl;
+    std::cout << "Idle: subscriber=" << aeron_settings.subscriber_idle.name
+              << ", worker=" << aeron_settings.worker_idle.name
+              << ", monitor=" << aeron_settings.monitor_idle.name << std::endl;
+    std::cout << "Validation: " << (aeron_settings.validation.enabled
+        ? aeron_settings.validation.stage : std::string("OFF")) << std::endl;
+    if (!aeron_settings.streams.empty()) {
+        std::cout << "Streams: " << aeron_settings.streams.size() << std::endl;
+    }
     std::cout << "Config: " << (config_file.empty() ? "Default" : config_file) << std::endl;
     std::cout << "==========================================\n" << std::endl;
 
+    ThreadUtil::setCurrentThreadName("aeron-main");
+
+    // Hot path timestamps (TSC, CLOCK_REALTIME 기준 보정)
+    try {
+        NanoClock::start(aeron_settings.clock);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    // 모든 return 경로에서 calibration thread 정리
+    struct ClockStopper { ~ClockStopper() { NanoClock::stop(); } } clock_stopper;
+
+    // mlockall(MCL_FUTURE) 이후 할당은 즉시 fault-in (아래 first-touch scope 안에서)
+    if (aeron_settings.mlock_all) {
+        ThreadUtil::lockAllMemory();
+    }
+
+    // Streams routed to their own queue + worker (copy mode only)
+    std::vector<size_t> dedicated_streams;
+    for (size_t i = 0; i < aeron_settings.streams.size(); i++) {
+        if (aeron_settings.streams[i].dedicated_queue && copy_mode) {
+            dedicated_streams.push_back(i);
+        }
+    }
+
+    // Shared queue sharded by key over several workers (copy mode only)
+    if (!copy_mode && aeron_settings.workers.shards > 1) {
+        std::cerr << "Worker sharding requires receive_mode = copy (using 1 worker)" << std::endl;
+    }
+    const bool sharded = copy_mode && aeron_settings.workers.shards > 1;
+    const size_t shared_workers = sharded ? static_cast<size_t>(aeron_settings.workers.shards) : 1;
+
     // ============================================
-    // 1. Create Buffer Pool (사전 할당)
+    // 1. Create Buffer Pool (사전 할당, size class 256B/4KB/64KB/1MB)
+    //    in-place / ring 모드: fragment 재조립 + gap fill 용도로만 사용
     // ============================================
+    // NUMA first-touch: subscriber CPU에 고정한 채로 pool/queue 할당 + 초기화
+    //   → subscriber / worker가 접근하는 메모리가 같은 노드에 배치
+    auto first_touch = std::make_unique<ScopedCpuBinding>(
+        aeron_settings.numa_first_touch ? aeron_settings.subscriber_thread.cpu : -1);
+    if (first_touch->isBound()) {
+        std::cout << "NUMA first-touch on CPU " << aeron_settings.subscriber_thread.cpu
+                  << " (node " << ThreadUtil::numaNodeOfCpu(aeron_settings.subscriber_thread.cpu)
+                  << ")" << std::endl;
+    }
+
+    // Backing memory for every pool / queue below (pre-faulted on this node);
+    // declared first so it outlives them
+    const MemorySettings& memory = aeron_settings.memory;
+    MemoryConfig memory_config;
+    memory_config.hugepages = MemoryConfig::parseHugePages(memory.hugepages);
+    memory_config.prefault = memory.prefault;
+    memory_config.lock = memory.lock;
+    auto arena = std::make_unique<MemoryArena>(memory_config);
+
     std::cout << "Creating Buffer Pool..." << std::endl;
-    MessageBufferPool buffer_pool;  // 1024 buffers (~4.2 MB)
+    PoolSizing pool_sizing;
+    pool_sizing.small = static_cast<size_t>(memory.pool_small);
+    pool_sizing.medium = static_cast<size_t>(memory.pool_medium);
+    pool_sizing.large = static_cast<size_t>(memory.pool_large);
+    pool_sizing.huge = static_cast<size_t>(memory.pool_huge);
+    auto buffer_pool = std::make_unique<MessageBufferPool>(pool_sizing, arena.get());  // ~18 MB default
+    const size_t queue_size = static_cast<size_t>(memory.message_queue);
+    std::unique_ptr<MessageBufferQueue> message_queue;
+    std::unique_ptr<InPlaceMessageQueue> view_queue;
+    std::unique_ptr<MessageRingBuffer> ring_buffer;
+
+    if (in_place) {
+        // ============================================
+        // 2. Create View Queue (in-place)
+        // ============================================
+        std::cout << "Creating View Queue..." << std::endl;
+        view_queue = std::make_unique<InPlaceMessageQueue>(
+            static_cast<size_t>(memory.view_queue), arena.get());  // 4096 views (~160 KB) default
+    } else if (ring) {
+        // ============================================
+        // 2. Create Byte Ring (variable-length records)
+        // ============================================
+        std::cout << "Creating Byte Ring..." << std::endl;
+        ring_buffer = std::make_unique<MessageRingBuffer>(
+            static_cast<size_t>(memory.ring_bytes), arena.get());  // 4 MB default
+    } else if (!sharded) {
+        // ============================================
+        // 2. Create Message Queue (zero-copy)
+        //    sharded: one queue per shard, created by the WorkerGroup
+        // ============================================
+        std::cout << "Creating Message Queue..." << std::endl;
+        message_queue = std::make_unique<MessageBufferQueue>(queue_size, arena.get());  // 4096 slots (~32 KB) default
+    }
 
-    // ============================================
-    // 2. Create Message Queue (zero-copy)
-    // ============================================
-    std::cout << "Creating Message Queue..." << std::endl;
-    MessageBufferQueue message_queue;  // 4096 slots (~32 KB)
+    // Dedicated stream queues (one SPSC queue per worker)
+    std::vector<std::unique_ptr<MessageBufferQueue>> stream_queues;
+    for (size_t i = 0; i < dedicated_streams.size(); i++) {
+        stream_queues.push_back(std::make_unique<MessageBufferQueue>(queue_size, arena.get()));
+    }
+
+    // Gap fill output (agent → worker, one SPSC queue per worker)
+    // [0]: shared worker (sharded: per-shard queues in the WorkerGroup)
+    const bool gap_fill = aeron_settings.gap_fill.enabled
+        && !(gap_recovery_override && !gap_recovery_enabled);
+    std::vector<std::unique_ptr<MessageBufferQueue>> recovered_queues;
+    if (gap_fill) {
+        for (size_t i = 0; i < 1 + dedicated_streams.size(); i++) {
+            recovered_queues.push_back(i == 0 && sharded
+                ? nullptr : std::make_unique<MessageBufferQueue>(queue_size, arena.get()));
+        }
+    }
 
     // ============================================
-    // 3. Create Monitoring Queue
+    // 3. Create Monitoring Queues (one per worker)
     // ============================================
     std::cout << "Creating Monitoring Queue..." << std::endl;
-    MessageStatsQueue stats_queue;  // 16384 items (~512 KB)
+    std::vector<std::unique_ptr<MessageStatsQueue>> stats_queues;
+    for (size_t i = 0; i < shared_workers + dedicated_streams.size(); i++) {
+        stats_queues.push_back(std::make_unique<MessageStatsQueue>(
+            static_cast<size_t>(memory.stats_queue), arena.get()));  // 16384 items (~640 KB) default
+    }
+
+    // Sharded workers: shard queues allocated here (first-touch node)
+    std::unique_ptr<WorkerGroup> worker_group;
+    if (sharded) {
+        ShardConfig shard_config;
+        shard_config.shards = shared_workers;
+        shard_config.key = ShardConfig::parseKey(aeron_settings.workers.key);
+        shard_config.payload_offset = static_cast<size_t>(aeron_settings.workers.payload_offset);
+        shard_config.payload_width = static_cast<size_t>(aeron_settings.workers.payload_width);
+
+        std::vector<MessageStatsQueue*> shard_stats;
+        for (size_t i = 0; i < shared_workers; i++) {
+            shard_stats.push_back(stats_queues[i].get());
+        }
+        worker_group = std::make_unique<WorkerGroup>(shard_config, *buffer_pool, shard_stats, gap_fill,
+                                                     queue_size, arena.get());
+    }
+
+    first_touch.reset();  // 원래 affinity 복원
+
+    // Shared-memory counters (aeron_substat); failure only disables them
+    std::unique_ptr<CountersFile> counters_file;
+    if (aeron_settings.counters.enabled) {
+        try {
+            counters_file = std::make_unique<CountersFile>(
+                aeron_settings.counters.path(aeron_settings.aeron_dir),
+                static_cast<size_t>(aeron_settings.counters.max_counters));
+        } catch (const std::exception& e) {
+            std::cerr << "WARNING: " << e.what() << " (counters disabled)" << std::endl;
+        }
+    }
 
     // ============================================
     // 4. Create Monitoring Thread
@@ -218,17 +444,44 @@ int main(int argc, char** argv) {
     std::cout << "Starting Monitoring Thread..." << std::endl;
     std::atomic<bool> monitoring_running{true};
     std::atomic<int64_t> skipped_count{0};
+    std::unique_ptr<IdleStrategy> monitor_idle = IdleStrategy::create(aeron_settings.monitor_idle);
+
+    // Written by the monitor thread only
+    Counter monitor_messages;
+    Counter monitor_latency_avg;
+    Counter monitor_latency_max;
+    Counter monitor_corrected_max;
+    if (counters_file) {
+        monitor_messages = counters_file->allocate("monitor: messages sampled");
+        monitor_latency_avg = counters_file->allocate("monitor: latency avg us", CounterType::GAUGE);
+        monitor_latency_max = counters_file->allocate("monitor: latency max us", CounterType::GAUGE);
+        monitor_corrected_max = counters_file->allocate("monitor: corrected latency max us", CounterType::GAUGE);
+    }
+    const bool print_stats = aeron_settings.counters.print_stats;
 
     std::thread monitor_thread([&]() {
+        ThreadUtil::configureCurrentThread("aeron-monitor", aeron_settings.monitor_thread);
+
         int64_t counter = 0;
         int64_t total_latency_us = 0;
         int64_t min_latency_us = INT64_MAX;
         int64_t max_latency_us = 0;
 
+        // From event_time_ns (load generator: intended send time → coordinated omission 보정)
+        int64_t corrected_samples = 0;
+        int64_t total_corrected_us = 0;
+        int64_t max_corrected_us = 0;
+
         MessageStats stats;
 
         while (monitoring_running.load(std::memory_order_relaxed)) {
-            if (stats_queue.dequeue(stats)) {
+            int dequeued = 0;
+
+            for (auto& stats_queue : stats_queues) {
+                if (!stats_queue->dequeue(stats)) {
+                    continue;
+                }
+                dequeued++;
                 counter++;
 
                 // Calculate latency
@@ -238,12 +491,26 @@ int main(int argc, char** argv) {
                     min_latency_us = std::min(min_latency_us, static_cast<int64_t>(latency));
                     max_latency_us = std::max(max_latency_us, static_cast<int64_t>(latency));
                 }
+                double corrected = stats.corrected_latency_us();
+                if (corrected > 0) {
+                    corrected_samples++;
+                    total_corrected_us += static_cast<int64_t>(corrected);
+                    max_corrected_us = std::max(max_corrected_us, static_cast<int64_t>(corrected));
+                }
 
-                // Print every 100 messages
+                // Publish + print every 100 messages
                 if (counter % 100 == 0) {
                     double avg_latency = counter > 0 ?
                         static_cast<double>(total_latency_us) / counter : 0.0;
 
+                    monitor_messages.set(counter);
+                    monitor_latency_avg.set(static_cast<int64_t>(avg_latency));
+                    monitor_latency_max.set(max_latency_us);
+                    monitor_corrected_max.set(max_corrected_us);
+                    if (!print_stats) {
+                        continue;
+                    }
+
                     std::cout << "\n==========================================" << std::endl;
                     std::cout << "📊 Zero-Copy Stats (last 100 messages)" << std::endl;
                     std::cout << "==========================================" << std::endl;
@@ -256,21 +523,49 @@ int main(int argc, char** argv) {
                         std::cout << "Min latency:      " << min_latency_us << " μs" << std::endl;
                         std::cout << "Max latency:      " << max_latency_us << " μs" << std::endl;
                     }
+                    if (corrected_samples > 0) {
+                        std::cout << std::fixed << std::setprecision(2);
+                        std::cout << "Corrected avg:    "
+                                  << static_cast<double>(total_corrected_us) / corrected_samples
+                                  << " μs (from event / intended time)" << std::endl;
+                        std::cout << "Corrected max:    " << max_corrected_us << " μs" << std::endl;
+                    }
 
                     // Buffer pool and queue stats
                     std::cout << "\nResource Usage:" << std::endl;
-                    std::cout << "Buffer pool:      " << buffer_pool.available()
-                              << " / " << buffer_pool.capacity()
-                              << " (util: " << std::fixed << std::setprecision(1)
-                              << (buffer_pool.utilization() * 100.0) << "%)" << std::endl;
-
-                    std::cout << "Message queue:    " << message_queue.size()
-                              << " / " << message_queue.capacity()
+                    std::cout << "Buffer pool:      " << buffer_pool->available()
+                              << " / " << buffer_pool->capacity()
                               << " (util: " << std::fixed << std::setprecision(1)
-                              << (message_queue.utilization() * 100.0) << "%)" << std::endl;
+                              << (buffer_pool->utilization() * 100.0) << "%)" << std::endl;
+
+                    if (message_queue) {
+                        std::cout << "Message queue:    " << message_queue->size()
+                                  << " / " << message_queue->capacity()
+                                  << " (util: " << std::fixed << std::setprecision(1)
+                                  << (message_queue->utilization() * 100.0) << "%)" << std::endl;
+                    } else if (worker_group) {
+                        std::cout << "Shard queues:     " << worker_group->queuedMessages()
+                                  << " / " << worker_group->queueCapacity()
+                                  << " (" << worker_group->shardCount() << " shards)" << std::endl;
+                    } else if (ring_buffer) {
+                        std::cout << "Byte ring:        " << ring_buffer->usedBytes()
+                                  << " / " << ring_buffer->capacity() << " bytes"
+                                  << " (util: " << std::fixed << std::setprecision(1)
+                                  << (ring_buffer->utilization() * 100.0) << "%)" << std::endl;
+                    } else {
+                        std::cout << "View queue:       " << view_queue->size()
+                                  << " / " << view_queue->capacity()
+                                  << " (util: " << std::fixed << std::setprecision(1)
+                                  << (view_queue->utilization() * 100.0) << "%)" << std::endl;
+                    }
 
-                    std::cout << "Stats queue:      " << stats_queue.size()
-                              << " / " << stats_queue.capacity() << std::endl;
+                    size_t stats_pending = 0;
+                    for (const auto& queue : stats_queues) {
+                        stats_pending += queue->size();
+                    }
+                    std::cout << "Stats queue:      " << stats_pending
+                              << " / " << stats_queues.size() * stats_queues[0]->capacity()
+                              << std::endl;
 
                     int64_t skipped = skipped_count.load(std::memory_order_relaxed);
                     if (skipped > 0) {
@@ -279,10 +574,9 @@ int main(int argc, char** argv) {
 
                     std::cout << "==========================================\n" << std::endl;
                 }
-            } else {
-                // Queue empty - wait briefly
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
             }
+
+            monitor_idle->idle(dequeued);
         }
 
         std::cout << "✓ Monitoring thread stopped (total: " << counter << " messages)" << std::endl;
@@ -292,10 +586,72 @@ int main(int argc, char** argv) {
     // 5. Create Worker Thread
     // ============================================
     std::cout << "Creating Message Worker..." << std::endl;
-    MessageWorker worker(message_queue, buffer_pool, stats_queue);
+    // workers: [shared worker (not sharded)] + one per dedicated stream
+    std::vector<std::unique_ptr<MessageWorker>> workers;
+    if (!sharded) {
+        if (in_place) {
+            workers.push_back(std::make_unique<MessageWorker>(
+                *view_queue, *stats_queues[0], buffer_pool.get()));
+        } else if (ring) {
+            workers.push_back(std::make_unique<MessageWorker>(
+                *ring_buffer, *stats_queues[0], buffer_pool.get()));
+        } else {
+            workers.push_back(std::make_unique<MessageWorker>(
+                *message_queue, *buffer_pool, *stats_queues[0]));
+        }
+    }
+    const size_t dedicated_base = workers.size();
+    for (size_t i = 0; i < dedicated_streams.size(); i++) {
+        workers.push_back(std::make_unique<MessageWorker>(
+            *stream_queues[i], *buffer_pool, *stats_queues[shared_workers + i]));
+    }
+    MessageWorker& worker = worker_group ? worker_group->worker(0) : *workers[0];
+
+    auto stopWorkers = [&workers, &worker_group]() {
+        if (worker_group) {
+            worker_group->stop();
+        }
+        for (auto& w : workers) {
+            w->stop();
+        }
+    };
 
-    std::cout << "Starting Worker Thread..." << std::endl;
-    worker.start();
+    if (worker_group) {
+        worker_group->setThreadSettings("aeron-worker", aeron_settings.worker_thread,
+                                        aeron_settings.workers.cpus);
+    } else {
+        worker.setThreadSettings("aeron-worker", aeron_settings.worker_thread);
+    }
+    for (size_t i = 0; i < dedicated_streams.size(); i++) {
+        ThreadSettings thread = aeron_settings.worker_thread;
+        thread.cpu = aeron_settings.streams[dedicated_streams[i]].worker_cpu;
+        workers[dedicated_base + i]->setThreadSettings(
+            "aeron-worker-" + std::to_string(shared_workers + i), thread);
+    }
+
+    for (size_t i = 0; i < recovered_queues.size(); i++) {
+        if (recovered_queues[i]) {
+            workers[i == 0 ? 0 : dedicated_base + i - 1]->setRecoveredQueue(recovered_queues[i].get());
+        }
+    }
+
+    // Validation stage: worker (batched per burst) or receiver (subscriber thread)
+    const bool validate_on_receive =
+        aeron_settings.validation.enabled && aeron_settings.validation.stage == "receiver";
+    const bool validate_on_worker =
+        aeron_settings.validation.enabled && aeron_settings.validation.stage == "worker";
+
+    std::cout << "Starting Worker Thread(s): " << shared_workers + dedicated_streams.size() << std::endl;
+    if (worker_group) {
+        worker_group->setIdleStrategy(aeron_settings.worker_idle);
+        worker_group->setValidation(validate_on_worker);
+        worker_group->start();
+    }
+    for (auto& w : workers) {
+        w->setIdleStrategy(IdleStrategy::create(aeron_settings.worker_idle));
+        w->setValidation(validate_on_worker);
+        w->start();
+    }
 
     // ============================================
     // 6. Create and Initialize Subscriber
@@ -308,6 +664,28 @@ int main(int argc, char** argv) {
     config.subscription_channel = aeron_settings.subscription_channel;
     config.subscription_stream_id = aeron_settings.subscription_stream_id;
     config.replay_destination = aeron_settings.replay_channel;
+    config.receive_mode = in_place ? ReceiveMode::IN_PLACE
+        : ring ? ReceiveMode::RING : ReceiveMode::COPY;
+    config.overflow_policy = (aeron_settings.overflow_policy == "backpressure")
+        ? OverflowPolicy::BACKPRESSURE : OverflowPolicy::DROP;
+    config.idle_strategy = aeron_settings.subscriber_idle;
+    config.validate_on_receive = validate_on_receive;
+
+    config.gap_fill.enabled = gap_fill;
+    config.gap_fill.replay_channel = aeron_settings.gap_fill.replay_channel;
+    config.gap_fill.replay_stream_id = aeron_settings.gap_fill.replay_stream_id;
+    config.gap_fill.max_replay_bytes = aeron_settings.gap_fill.max_replay_bytes;
+    config.gap_fill.timeout_ms = aeron_settings.gap_fill.timeout_ms;
+    config.gap_fill.thread = aeron_settings.gap_fill_thread;
+
+    for (const auto& stream : aeron_settings.streams) {
+        StreamConfig stream_config;
+        stream_config.name = stream.name;
+        stream_config.channel = stream.channel;
+        stream_config.stream_id = stream.stream_id;
+        stream_config.dedicated_queue = stream.dedicated_queue;
+        config.streams.push_back(stream_config);
+    }
 
     // Apply gap recovery CLI overrides
     if (gap_recovery_override) {
@@ -331,6 +709,13 @@ int main(int argc, char** argv) {
     }
     std::cout << std::endl;
 
+    std::cout << "Gap Fill: " << (gap_fill ? "ENABLED" : "DISABLED");
+    if (gap_fill) {
+        std::cout << " (replay: " << config.gap_fill.replay_channel
+                  << ", stream " << config.gap_fill.replay_stream_id << ")";
+    }
+    std::cout << std::endl;
+
     std::cout << "Duplicate Check: " << (config.duplicate_check_enabled ? "ENABLED" : "DISABLED");
     if (config.duplicate_check_enabled) {
         std::cout << " (window: " << config.duplicate_window_size << ")";
@@ -344,30 +729,56 @@ int main(int argc, char** argv) {
         std::cerr << "Failed to initialize subscriber" << std::endl;
         monitoring_running = false;
         monitor_thread.join();
-        worker.stop();
+        stopWorkers();
         return 1;
     }
 
     // ============================================
     // 7. Initialize Zero-Copy (REQUIRED)
     // ============================================
-    std::cout << "Initializing Zero-Copy..." << std::endl;
-    subscriber.initializeZeroCopy(&buffer_pool, &message_queue);
+    if (in_place) {
+        std::cout << "Initializing In-Place Receive..." << std::endl;
+        subscriber.initializeInPlace(view_queue.get(), buffer_pool.get());
+    } else if (ring) {
+        std::cout << "Initializing Byte Ring Receive..." << std::endl;
+        subscriber.initializeRing(ring_buffer.get(), buffer_pool.get());
+    } else {
+        std::cout << "Initializing Zero-Copy..." << std::endl;
+        if (worker_group) {
+            subscriber.initializeZeroCopy(buffer_pool.get(), &worker_group->router().queue(0));
+            subscriber.setShardRouter(&worker_group->router());
+        } else {
+            subscriber.initializeZeroCopy(buffer_pool.get(), message_queue.get());
+        }
+
+        for (size_t i = 0; i < dedicated_streams.size(); i++) {
+            subscriber.setStreamQueue(dedicated_streams[i], stream_queues[i].get(),
+                                      gap_fill ? recovered_queues[i + 1].get() : nullptr);
+        }
+    }
+
+    // Gap fill agent (own thread + archive connection)
+    if (gap_fill) {
+        subscriber.enableGapFill(recovered_queues[0].get(),
+                                 worker_group ? worker_group->recoveredRouter() : nullptr);
+    }
 
     // ============================================
     // 8. Enable Checkpoint
     // ============================================
     std::string checkpoint_file = config.aeron_dir + "/subscriber.checkpoint";
-    subscriber.enableCheckpoint(checkpoint_file, 1);  // Flush every 1 second
+    subscriber.enableCheckpoint(checkpoint_file, 1,   // Flush every 1 second
+                                aeron_settings.checkpoint_thread);
 
     // Load checkpoint for restart (if exists)
-    CheckpointManager* checkpoint = subscriber.getCheckpointManager();
-    int64_t checkpoint_position = checkpoint ? checkpoint->getLastPosition() : 0;
-
-    if (checkpoint_position > 0) {
-        std::cout << "✓ Checkpoint found - resuming from position: " << checkpoint_position << std::endl;
-        if (replay_auto_mode) {
-            start_position = checkpoint_position;
+    // startReplayMergeAuto resumes each stream from its own checkpoint
+    for (size_t i = 0; i < subscriber.streamCount(); i++) {
+        CheckpointManager* checkpoint = subscriber.getCheckpointManager(i);
+        int64_t checkpoint_position = checkpoint ? checkpoint->getLastPosition() : 0;
+
+        if (checkpoint_position > 0) {
+            std::cout << "✓ Checkpoint found (stream " << i
+                      << ") - resuming from position: " << checkpoint_position << std::endl;
         }
     }
 
@@ -382,7 +793,7 @@ int main(int argc, char** argv) {
                 std::cerr << "Failed to start live mode" << std::endl;
                 monitoring_running = false;
                 monitor_thread.join();
-                worker.stop();
+                stopWorkers();
                 return 1;
             }
         }
@@ -392,7 +803,7 @@ int main(int argc, char** argv) {
             std::cerr << "Failed to start live mode" << std::endl;
             monitoring_running = false;
             monitor_thread.join();
-            worker.stop();
+            stopWorkers();
             return 1;
         }
     }
@@ -409,14 +820,55 @@ int main(int argc, char** argv) {
     // 10. Run Subscriber in separate thread
     // ============================================
     std::thread subscriber_thread([&]() {
+        ThreadUtil::configureCurrentThread("aeron-sub", aeron_settings.subscriber_thread);
         subscriber.run();
     });
 
     // ============================================
     // 11. Main thread waits for shutdown signal
+    //     (and publishes statistics to the counters file)
     // ============================================
+    std::unique_ptr<SubscriberCounters> counters;
+    if (counters_file) {
+        counters = std::make_unique<SubscriberCounters>(*counters_file);
+        counters->addSubscriber(subscriber);
+        if (subscriber.getValidator()) {
+            counters->addValidator("subscriber", *subscriber.getValidator());
+        }
+        if (worker_group) {
+            for (size_t i = 0; i < worker_group->shardCount(); i++) {
+                counters->addWorker("worker " + std::to_string(i), worker_group->worker(i));
+                counters->addQueue("shard " + std::to_string(i) + " queue",
+                                   worker_group->router().queue(i));
+            }
+            counters->addShardRouter(worker_group->router());
+        } else {
+            counters->addWorker("worker", worker);
+        }
+        for (size_t i = 0; i < dedicated_streams.size(); i++) {
+            const std::string& name = aeron_settings.streams[dedicated_streams[i]].name;
+            counters->addWorker("worker " + name, *workers[dedicated_base + i]);
+            counters->addQueue("stream " + name + " queue", *stream_queues[i]);
+        }
+        counters->addPool(*buffer_pool);
+        if (message_queue) {
+            counters->addQueue("message queue", *message_queue);
+        } else if (view_queue) {
+            counters->addQueue("view queue", *view_queue);
+        } else if (ring_buffer) {
+            counters->addRing("byte ring", *ring_buffer);
+        }
+        std::cout << "Counters: " << counters_file->counterCount() << " published to "
+                  << counters_file->path() << " (aeron_substat)" << std::endl;
+    }
+
+    const auto tick = std::chrono::milliseconds(
+        counters ? aeron_settings.counters.update_interval_ms : 100);
     while (g_running.load()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (counters) {
+            counters->update();
+        }
+        std::this_thread::sleep_for(tick);
     }
 
     // ============================================
@@ -431,15 +883,20 @@ int main(int argc, char** argv) {
     subscriber.shutdown();
     subscriber_thread.join();
 
-    // Stop worker
-    std::cout << "2. Stopping worker thread..." << std::endl;
-    worker.stop();
+    // Stop worker(s)
+    std::cout << "2. Stopping worker thread(s)..." << std::endl;
+    stopWorkers();
 
     // Stop monitoring
     std::cout << "3. Stopping monitoring thread..." << std::endl;
     monitoring_running = false;
     monitor_thread.join();
 
+    // Final values stay in the counters file after exit
+    if (counters) {
+        counters->update();
+    }
+
     // ============================================
     // 13. Print Final Statistics
     // ============================================
@@ -453,16 +910,66 @@ int main(int argc, char** argv) {
     std::cout << "  Messages received:     " << zc_stats.messages_received << std::endl;
     std::cout << "  Buffer alloc failures: " << zc_stats.buffer_allocation_failures << std::endl;
     std::cout << "  Queue full failures:   " << zc_stats.queue_full_failures << std::endl;
+    if (in_place) {
+        std::cout << "  In-place peek aborts:  " << zc_stats.inplace_aborts << std::endl;
+        std::cout << "  In-place term stalls:  " << zc_stats.inplace_term_stalls << std::endl;
+    }
+    std::cout << "  Reassembled messages:  " << zc_stats.reassembled_messages << std::endl;
+    std::cout << "  Reassembly drops:      " << zc_stats.reassembly_drops << std::endl;
+    std::cout << "  Batches unpacked:      " << zc_stats.batches_unpacked
+              << " (" << zc_stats.batch_errors << " rejected)" << std::endl;
+    std::cout << "  Backpressure episodes: " << zc_stats.backpressure_episodes
+              << " (" << zc_stats.backpressure_aborts << " aborted polls)" << std::endl;
+    std::cout << "  Backpressure time:     " << zc_stats.backpressure_total_ns / 1000
+              << " us total, " << zc_stats.backpressure_max_ns / 1000 << " us max" << std::endl;
+    if (subscriber.getValidator()) {
+        subscriber.getValidator()->printStatistics("  ");
+    }
 
     // Worker stats
-    std::cout << "\nWorker Thread:" << std::endl;
-    worker.printStatistics();
+    if (worker_group) {
+        std::cout << "\nWorker Threads (sharded):" << std::endl;
+        worker_group->printStatistics();
+    } else {
+        std::cout << "\nWorker Thread:" << std::endl;
+        worker.printStatistics();
+    }
+    for (size_t i = 0; i < dedicated_streams.size(); i++) {
+        std::cout << "\nWorker Thread (stream "
+                  << aeron_settings.streams[dedicated_streams[i]].name << "):" << std::endl;
+        workers[dedicated_base + i]->printStatistics();
+    }
 
-    // Buffer pool stats
-    buffer_pool.printStatistics();
+    // Buffer pool stats (per size class)
+    buffer_pool->printStatistics();
+
+    if (in_place) {
+        // View queue stats
+        view_queue->printStatistics();
+    } else if (ring_buffer) {
+        // Byte ring stats
+        ring_buffer->printStatistics();
+    } else if (message_queue) {
+        // Message queue stats
+        message_queue->printStatistics();
+    }
+
+    // Backing memory (hugepage fallbacks, locked bytes)
+    arena->printStatistics();
+
+    // Idle strategy stats (busy ratio ≈ CPU 사용 대비 실제 작업 비율)
+    std::cout << "\nIdle Strategies:" << std::endl;
+    auto printIdle = [](const char* label, const char* name, const IdleStats& s) {
+        std::cout << "  " << label << name << " (busy " << s.busy_calls
+                  << " / idle " << s.idle_calls << ", spins " << s.spins
+                  << ", yields " << s.yields << ", parks " << s.parks << ")" << std::endl;
+    };
+    printIdle("Subscriber: ", aeron_settings.subscriber_idle.name.c_str(), subscriber.getIdleStats());
+    printIdle("Worker:     ", aeron_settings.worker_idle.name.c_str(),
+              worker_group ? worker_group->getIdleStats() : worker.getIdleStats());
+    printIdle("Monitor:    ", monitor_idle->name(), monitor_idle->stats());
 
-    // Message queue stats
-    message_queue.printStatistics();
+    NanoClock::printStatistics();
 
     std::cout << "\n==========================================" << std::endl;
     std::cout << "  ✓ Zero-Copy Subscriber Shutdown Complete" << std::endl;
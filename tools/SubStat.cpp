@@ -0,0 +1,212 @@
+/**
+ * aeron_substat
+ *
+ * Live view of the subscriber's counters file (like Aeron's AeronStat)
+ *
+ * Reads <aeron_dir>/subscriber.counters (or [counters] file) through a
+ * read-only mapping: no connection to the subscriber, nothing printed by
+ * it, safe to start / stop at any time.
+ *
+ * Output per counter: value, rate since the previous refresh (COUNT
+ * counters only) and label. The header shows the writer pid and how old
+ * its last heartbeat is; when the subscriber restarts (file replaced)
+ * the new file is picked up automatically.
+ *
+ * Usage:
+ *   ./aeron_substat
+ *   ./aeron_substat --config config/aeron-local.ini
+ *   ./aeron_substat --file /dev/shm/aeron/subscriber.counters --interval 500
+ *   ./aeron_substat --filter worker --once
+ */
+
+#include "CountersFile.h"
+#include "ConfigLoader.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <getopt.h>
+
+using namespace aeron::example;
+
+static std::atomic<bool> g_running{true};
+
+void signalHandler(int) {
+    g_running.store(false);
+}
+
+void printUsage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [OPTIONS]\n"
+              << "\nOptions:\n"
+              << "  --config <file>       Subscriber INI ([aeron] dir, [counters] file)\n"
+              << "  --file <path>         Counters file (overrides --config)\n"
+              << "  --interval <ms>       Refresh interval (default: 1000)\n"
+              << "  --filter <text>       Only counters whose label contains <text>\n"
+              << "  --once                Print once and exit (no screen clear)\n"
+              << "  -h, --help            Show this help message\n"
+              << std::endl;
+}
+
+/**
+ * Open the counters file, retrying while the subscriber is not up yet
+ */
+std::unique_ptr<CountersReader> openReader(const std::string& path, bool once) {
+    std::string last_error;
+    while (g_running.load()) {
+        try {
+            return std::make_unique<CountersReader>(path);
+        } catch (const std::exception& e) {
+            if (once) {
+                std::cerr << e.what() << std::endl;
+                return nullptr;
+            }
+            if (last_error != e.what()) {
+                last_error = e.what();
+                std::cerr << last_error << " (waiting...)" << std::endl;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+    return nullptr;
+}
+
+int main(int argc, char** argv) {
+    std::signal(SIGINT, signalHandler);
+    std::signal(SIGTERM, signalHandler);
+
+    std::string config_file;
+    std::string file;
+    std::string filter;
+    int64_t interval_ms = 1000;
+    bool once = false;
+
+    static struct option long_options[] = {
+        {"config",   required_argument, 0, 'f'},
+        {"file",     required_argument, 0, 'F'},
+        {"interval", required_argument, 0, 'i'},
+        {"filter",   required_argument, 0, 'x'},
+        {"once",     no_argument,       0, 'o'},
+        {"help",     no_argument,       0, 'h'},
+        {0, 0, 0, 0}
+    };
+
+    int opt;
+    int option_index = 0;
+    while ((opt = getopt_long(argc, argv, "h", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'f':
+                config_file = optarg;
+                break;
+            case 'F':
+                file = optarg;
+                break;
+            case 'i':
+                interval_ms = std::max<int64_t>(std::stoll(optarg), 10);
+                break;
+            case 'x':
+                filter = optarg;
+                break;
+            case 'o':
+                once = true;
+                break;
+            case 'h':
+                printUsage(argv[0]);
+                return 0;
+            default:
+                printUsage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (file.empty()) {
+        try {
+            const AeronSettings settings = config_file.empty()
+                ? ConfigLoader::loadDefault() : ConfigLoader::loadFromFile(config_file);
+            file = settings.counters.path(settings.aeron_dir);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load configuration: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    std::unique_ptr<CountersReader> reader = openReader(file, once);
+    if (!reader) {
+        return once ? 1 : 0;
+    }
+
+    std::vector<int64_t> previous;
+    auto previous_time = std::chrono::steady_clock::now();
+
+    while (g_running.load()) {
+        // Subscriber restarted → new file (old mapping stays readable until now)
+        if (reader->isReplaced()) {
+            reader.reset();
+            previous.clear();
+            reader = openReader(file, once);
+            if (!reader) {
+                break;
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        const double elapsed_s = std::chrono::duration<double>(now - previous_time).count();
+        previous_time = now;
+
+        const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        const std::time_t wall = std::time(nullptr);
+        char clock_text[16];
+        std::strftime(clock_text, sizeof(clock_text), "%H:%M:%S", std::localtime(&wall));
+
+        if (!once) {
+            std::cout << "\033[H\033[2J";
+        }
+        std::cout << clock_text << " - " << reader->path()
+                  << " (pid " << reader->pid() << ", ";
+        if (reader->isWriterAlive()) {
+            std::cout << "heartbeat " << (now_ms - reader->heartbeatMs()) << " ms ago)";
+        } else {
+            std::cout << "NOT RUNNING, last values)";
+        }
+        std::cout << std::endl;
+        std::cout << std::string(78, '=') << std::endl;
+
+        // Rates only for counters seen on the previous refresh
+        const size_t count = reader->count();
+        const size_t known = previous.size();
+        previous.resize(count, 0);
+        for (size_t i = 0; i < count; i++) {
+            const std::string label = reader->label(i);
+            const int64_t value = reader->value(i);
+            const int64_t delta = value - previous[i];
+            previous[i] = value;
+
+            if (!filter.empty() && label.find(filter) == std::string::npos) {
+                continue;
+            }
+
+            std::cout << std::setw(3) << i << ": " << std::setw(20) << value;
+            if (reader->type(i) == CounterType::COUNT && i < known && elapsed_s > 0) {
+                std::cout << std::setw(14) << std::fixed << std::setprecision(0)
+                          << delta / elapsed_s << "/s";
+            } else {
+                std::cout << std::setw(16) << "";
+            }
+            std::cout << " - " << label << std::endl;
+        }
+
+        if (once) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+
+    return 0;
+}